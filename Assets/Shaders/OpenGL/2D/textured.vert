@@ -4,13 +4,18 @@ layout (location = 0) in vec2 aPos;
 layout (location = 1) in vec2 aTexCoord;
 
 uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection; 
+uniform vec4 uvRect = vec4(0.0, 0.0, 1.0, 1.0);   // Atlas sub-rect: offset.xy, scale.zw
+// Camera matrices, shared by every program through one uniform buffer
+// (binding 0) that OpenGLRenderer updates when the active camera changes.
+layout (std140, binding = 0) uniform CameraBlock {
+    mat4 view;
+    mat4 projection;
+};
 
 out vec2 TexCoord;
 
 void main()
 {
     gl_Position = projection * view * model * vec4(aPos.x, aPos.y, 0.0, 1.0);
-    TexCoord = aTexCoord;
+    TexCoord = uvRect.xy + aTexCoord * uvRect.zw;
 }
\ No newline at end of file
@@ -0,0 +1,14 @@
+// Assets/Shaders/OpenGL/2D/textured_instanced.frag
+#version 450 core
+out vec4 fragment_color;
+
+in vec2 TexCoord;
+in vec4 Tint;
+
+uniform sampler2D texture_sampler;
+
+void main()
+{
+    vec4 sampled_color = texture(texture_sampler, vec2(TexCoord.x, 1.0 - TexCoord.y));
+    fragment_color = sampled_color * Tint;
+}
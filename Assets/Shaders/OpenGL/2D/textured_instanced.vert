@@ -0,0 +1,25 @@
+// Assets/Shaders/OpenGL/2D/textured_instanced.vert
+#version 450 core
+layout (location = 0) in vec2 aPos;
+layout (location = 1) in vec2 aTexCoord;
+// Per instance (see SpriteInstance): the model matrix fills locations 2-5.
+layout (location = 2) in mat4 aModel;
+layout (location = 6) in vec4 aTint;
+layout (location = 7) in vec4 aUVRect;    // Atlas sub-rect: offset.xy, scale.zw
+
+// Camera matrices, shared by every program through one uniform buffer
+// (binding 0) that OpenGLRenderer updates when the active camera changes.
+layout (std140, binding = 0) uniform CameraBlock {
+    mat4 view;
+    mat4 projection;
+};
+
+out vec2 TexCoord;
+out vec4 Tint;
+
+void main()
+{
+    gl_Position = projection * view * aModel * vec4(aPos.x, aPos.y, 0.0, 1.0);
+    TexCoord = aUVRect.xy + aTexCoord * aUVRect.zw;
+    Tint = aTint;
+}
@@ -0,0 +1,10 @@
+// Assets/Shaders/OpenGL/3D/debug_line.frag
+#version 450 core
+out vec4 FragColor;
+
+in vec4 vertex_color;
+
+void main()
+{
+    FragColor = vertex_color;
+}
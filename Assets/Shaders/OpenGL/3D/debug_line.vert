@@ -0,0 +1,19 @@
+// Assets/Shaders/OpenGL/3D/debug_line.vert
+#version 450 core
+
+// Debug lines are appended in world space, so there is no model matrix.
+layout(location = 0) in vec3 aPos;
+layout(location = 1) in vec4 aColor;
+
+// Shared camera uniform buffer (binding 0), updated by OpenGLRenderer.
+layout(std140, binding = 0) uniform CameraBlock {
+    mat4 view;
+    mat4 projection;
+};
+
+out vec4 vertex_color;
+
+void main() {
+    gl_Position = projection * view * vec4(aPos, 1.0);
+    vertex_color = aColor;
+}
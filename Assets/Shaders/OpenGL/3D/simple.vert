@@ -7,8 +7,11 @@ layout(location = 1) in vec3 aColor; // The color of the vertex.
 
 // Uniforms (data sent from the CPU)
 uniform mat4 model;         // Transforms the vertex from model space to world space
-uniform mat4 view;          // Transforms the vertex from world space to view (camera) space
-uniform mat4 projection;    // Transforms the vertex from view space to screen space
+// Shared camera uniform buffer (binding 0), updated by OpenGLRenderer.
+layout(std140, binding = 0) uniform CameraBlock {
+    mat4 view;              // Transforms the vertex from world space to view (camera) space
+    mat4 projection;        // Transforms the vertex from view space to screen space
+};
 
 // Output to the fragment shader
 out vec4 vertex_color;
@@ -144,7 +144,9 @@ namespace Salix {
             
             live_element->on_load(context);
             // --- NEW: Write derived data back to the archetype ---
-                if (auto* live_sprite = dynamic_cast<Sprite2D*>(live_element)) {
+                auto* live_sprite = dynamic_cast<Sprite2D*>(live_element);
+                // A streamed texture still showing its placeholder has no real size yet.
+                if (live_sprite && live_sprite->is_texture_ready()) {
                 // If the element is a Sprite2D, update its archetype's data node
                 // with the actual dimensions from the loaded texture.
                 element_archetype.data["width"].as<int>(live_sprite->get_texture_width());
@@ -237,7 +239,9 @@ namespace Salix {
             // +++ START FIX +++
             // NEW: Write derived data back to the archetype
             // This is a mutable reference, so we can modify the original archetype in the vector.
-            if (auto* live_sprite = dynamic_cast<Sprite2D*>(live_element)) {
+            auto* live_sprite = dynamic_cast<Sprite2D*>(live_element);
+            // A streamed texture still showing its placeholder has no real size yet.
+            if (live_sprite && live_sprite->is_texture_ready()) {
                 // Find the corresponding element archetype to modify it.
                 // This assumes the `archetype` parameter is the one being instantiated.
                 for (auto& element_arch : archetype.elements) {
@@ -56,6 +56,17 @@ namespace Salix {
         float get_effective_size(const RealmSettings& realm) const {
             return realm.use_realm_bounds ? size : std::numeric_limits<float>::max();
         }
+        // Lets cached grid geometry tell when it has to be rebuilt.
+        bool operator==(const GridSettings& other) const {
+            return size == other.size &&
+                   major_division == other.major_division &&
+                   minor_division == other.minor_division &&
+                   snap_enabled == other.snap_enabled &&
+                   snap_size == other.snap_size &&
+                   color == other.color;
+        }
+        bool operator!=(const GridSettings& other) const { return !(*this == other); }
+
         // Simplified static default - now just returns default-constructed object
         static constexpr GridSettings Default() {
             return GridSettings(); // Uses the constructor's defaults
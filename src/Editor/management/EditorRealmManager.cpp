@@ -2,6 +2,7 @@
 #include <Salix/serialization/YamlConverters.h>
 #include <Editor/management/EditorRealmManager.h>
 #include <Editor/management/RealmLoader.h>
+#include <Editor/management/RealmSaver.h>
 #include <Editor/management/RealmSnapshot.h>
 #include <Editor/EditorContext.h>
 #include <Editor/ArchetypeFactory.h>
@@ -23,6 +24,7 @@
 #include <memory>
 #include <unordered_map>
 #include <algorithm> 
+#include <filesystem>
 #include <functional> 
 
 namespace Salix {
@@ -34,7 +36,26 @@ namespace Salix {
         std::vector<std::shared_ptr<WorldTreeNode>> realm_hierarchy;
         std::unique_ptr<RealmSnapshot> snapshot;
         EditorContext* context = nullptr;
+        std::unique_ptr<RealmLoadTask> load_task;   // Set while a background load runs.
+        std::string realm_file_path;                // Where the snapshot's state is on disk.
     };
+
+    namespace {
+        bool has_unsaved_changes(const EntityArchetype& archetype) {
+            if (archetype.state != ArchetypeState::UnModified) return true;
+            for (const auto& element : archetype.elements) {
+                if (element.state != ArchetypeState::UnModified) return true;
+            }
+            return false;
+        }
+
+        void mark_saved(EntityArchetype& archetype) {
+            archetype.state = ArchetypeState::UnModified;
+            for (auto& element : archetype.elements) {
+                element.state = ArchetypeState::UnModified;
+            }
+        }
+    }
     
     // --- Constructor & Destructor ---
     EditorRealmManager::EditorRealmManager() : pimpl(std::make_unique<Pimpl>()) {}
@@ -124,10 +145,42 @@ namespace Salix {
 
     void EditorRealmManager::load_realm_from_file(const std::string& filepath) {
         pimpl->realm = load_archetypes_from_file(filepath);
+        pimpl->realm_file_path = filepath;
         synchronize(); // Sync map and hierarchy after loading
         take_snapshot(); // Take a new snapshot of the freshly loaded realm
     }
 
+    void EditorRealmManager::begin_loading_realm(const std::string& filepath) {
+        pimpl->load_task = std::make_unique<RealmLoadTask>(filepath);
+        pimpl->realm_file_path = filepath;
+    }
+
+    bool EditorRealmManager::is_loading_realm() const {
+        return pimpl->load_task != nullptr;
+    }
+
+    float EditorRealmManager::get_realm_load_progress() const {
+        return pimpl->load_task ? pimpl->load_task->get_progress() : 1.0f;
+    }
+
+    size_t EditorRealmManager::get_realm_load_entity_total() const {
+        return pimpl->load_task ? pimpl->load_task->get_entity_total() : pimpl->realm.size();
+    }
+
+    bool EditorRealmManager::finish_loading_realm() {
+        if (!pimpl->load_task || !pimpl->load_task->is_done()) {
+            return false;
+        }
+        pimpl->realm = pimpl->load_task->take_result();
+        pimpl->load_task.reset();
+        synchronize(); // Sync map and hierarchy after loading
+        take_snapshot(); // Take a new snapshot of the freshly loaded realm
+        if (pimpl->context) {
+            pimpl->context->realm_is_dirty = true;
+        }
+        return true;
+    }
+
     void EditorRealmManager::take_snapshot() {
         // This single line does all the work:
         // 1. It calls the static factory function on the RealmSnapshot class.
@@ -158,8 +211,62 @@ namespace Salix {
         return false; // No changes found
     }
 
+    bool EditorRealmManager::save_realm(const std::string& filepath) {
+        if (pimpl->load_task) return false;
+        if (filepath != pimpl->realm_file_path || !pimpl->snapshot || !std::filesystem::exists(filepath)) {
+            return save_realm_full(filepath);
+        }
+
+        // The snapshot holds what is on disk, so anything it has that the
+        // realm no longer does was purged since the last save.
+        std::vector<const EntityArchetype*> changed;
+        std::vector<SimpleGuid> purged_ids;
+        for (const auto& archetype : pimpl->realm) {
+            if (has_unsaved_changes(archetype)) changed.push_back(&archetype);
+        }
+        for (const auto& [entity_id, saved_archetype] : pimpl->snapshot->get_entity_map()) {
+            if (pimpl->realm_map.find(entity_id) == pimpl->realm_map.end()) purged_ids.push_back(entity_id);
+        }
+        if (changed.empty() && purged_ids.empty()) return true;
+
+        if (!append_realm_journal(filepath, changed, purged_ids)) {
+            return save_realm_full(filepath);
+        }
+        if (realm_journal_needs_compaction(filepath)) {
+            std::cout << "[EditorRealmManager] Compacting realm journal for " << filepath << std::endl;
+            return save_realm_full(filepath);
+        }
+
+        for (const EntityArchetype* archetype : changed) {
+            mark_saved(*get_archetype(archetype->id));
+        }
+        pimpl->snapshot->update_entities(changed, purged_ids);
+        std::cout << "[EditorRealmManager] Saved " << changed.size() << " changed and "
+                  << purged_ids.size() << " purged entities to the journal." << std::endl;
+        return true;
+    }
+
+    bool EditorRealmManager::save_realm_full(const std::string& filepath) {
+        if (pimpl->load_task) return false;
+        if (!save_archetypes_to_file(filepath, pimpl->realm)) {
+            return false;
+        }
+        for (auto& archetype : pimpl->realm) {
+            mark_saved(archetype);
+        }
+        pimpl->realm_file_path = filepath;
+        take_snapshot();
+        return true;
+    }
+
+    const std::string& EditorRealmManager::get_realm_file_path() const {
+        return pimpl->realm_file_path;
+    }
+
     void EditorRealmManager::clear_realm() {
         pimpl->realm.clear();
+        // The empty snapshot no longer matches the file, so the next save is a full one.
+        pimpl->realm_file_path.clear();
         synchronize();
         take_snapshot();
     }
@@ -297,16 +404,20 @@ namespace Salix {
 
         if (descendants_to_purge.empty()) return;
 
-        // 2. (SAFETY FIX) Fire the "heads-up" event for EACH descendant.
+        // 2. (SAFETY FIX) Fire one "heads-up" event covering every descendant.
         //    This warns all systems to clear their pointers before the live objects are deleted.
+        std::vector<Entity*> live_descendants;
         for (const auto& descendant_id : descendants_to_purge) {
             Entity* live_entity = pimpl->context->preview_scene->get_entity_by_id(descendant_id);
             if (live_entity) {
-                pimpl->context->event_manager->dispatch(
-                    std::make_unique<BeforeEntityPurgedEvent>(live_entity)
-                );
+                live_descendants.push_back(live_entity);
             }
         }
+        if (!live_descendants.empty()) {
+            pimpl->context->event_manager->dispatch(
+                std::make_unique<BeforeEntityPurgedEvent>(std::move(live_descendants))
+            );
+        }
 
         // 3. (CRASH FIX) Use a safe backward loop to remove the archetypes from the data.
         for (int i = static_cast<int>(pimpl->realm.size()) - 1; i >= 0; --i) {
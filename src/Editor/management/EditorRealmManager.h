@@ -6,6 +6,7 @@
 #include <Salix/core/SimpleGuid.h>
 #include <vector>
 #include <memory>
+#include <string>
 #include <unordered_map>
 
 namespace Salix {
@@ -24,10 +25,27 @@ namespace Salix {
         void validate_realm() const;
         // --- Realm Loading & State Management ---
         void load_realm_from_file(const std::string& filepath);
+        // Loads on a background thread instead; poll finish_loading_realm() once
+        // per frame. It returns true on the frame the new realm is swapped in.
+        void begin_loading_realm(const std::string& filepath);
+        bool is_loading_realm() const;
+        float get_realm_load_progress() const;
+        size_t get_realm_load_entity_total() const;
+        bool finish_loading_realm();
         void take_snapshot();
         bool is_dirty() const;
         void clear_realm();
 
+        // --- Saving ---
+        // Saving to the file the realm was loaded from (or last saved to) only
+        // appends the new, modified and purged entities to its journal; the
+        // file is rewritten once the journal passes REALM_JOURNAL_COMPACT_RATIO.
+        // Any other path gets a full save.
+        bool save_realm(const std::string& filepath);
+        bool save_realm_full(const std::string& filepath);
+        // Empty until a realm has been loaded or saved.
+        const std::string& get_realm_file_path() const;
+
         // --- Modifying Functions ---
         void add_entity(EntityArchetype archetype);
         void purge_entity(SimpleGuid entity_id);
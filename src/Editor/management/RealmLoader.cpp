@@ -1,127 +1,560 @@
 // Editor/management/RealmLoader.cpp
 #include <Salix/serialization/YamlConverters.h>
 #include <Editor/management/RealmLoader.h>
+#include <Editor/management/RealmSaver.h>
 #include <Editor/Archetypes.h>
 #include <yaml-cpp/yaml.h>
 #include <Salix/core/SimpleGuid.h>
+#include <Salix/core/JobSystem.h>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <unordered_map>
 
 
 namespace Salix {
 
-    // This is the function DEFINITION.
-    // It provides the actual implementation.
-    std::vector<EntityArchetype> load_archetypes_from_file(const std::string& filepath) {
-        std::vector<EntityArchetype> archetypes;
-        
-        try {
-            YAML::Node realm_yaml = YAML::LoadFile(filepath);
-            
-            if (!realm_yaml["Entities"] || !realm_yaml["Entities"].IsSequence()) {
-                std::cerr << "[RealmLoader] Invalid or missing 'Entities' node in YAML file: " << filepath << std::endl;
-                return archetypes;
-            }
+    namespace {
+        // Turns one entity node into an archetype. The node is only read through
+        // const access, which never inserts into the shared document, so workers
+        // can build different entities at the same time.
+        bool build_entity_archetype(const YAML::Node& entity_node, EntityArchetype& entity) {
+            try {
+                if (!entity_node.IsMap()) {
+                    std::cerr << "[RealmLoader] Invalid entity node (expected map)" << std::endl;
+                    return false;
+                }
 
-            std::cout << "[RealmLoader] Parsing " << realm_yaml["Entities"].size() << " entities..." << std::endl;
+                // Required fields
+                if (!entity_node["name"] || !entity_node["id"]) {
+                    std::cerr << "[RealmLoader] Entity missing required fields (name or id)" << std::endl;
+                    return false;
+                }
 
-            for (const auto& entity_node : realm_yaml["Entities"]) {
-                try {
-                    if (!entity_node.IsMap()) {
-                        std::cerr << "[RealmLoader] Invalid entity node (expected map)" << std::endl;
-                        continue;
-                    }
+                entity.name = entity_node["name"].as<std::string>();
+                entity.id = entity_node["id"].as<SimpleGuid>();
 
-                    EntityArchetype entity;
+                // Optional parent
+                if (entity_node["parent"] && !entity_node["parent"].IsNull()) {
+                    // Convert parent to uint64_t first
+                    uint64_t parent_value = entity_node["parent"].as<uint64_t>(0); // default to 0 if missing
+                    entity.parent_id = (parent_value != 0) ? SimpleGuid::from_value(parent_value) : SimpleGuid::invalid();
 
-                    // Required fields
-                    if (!entity_node["name"] || !entity_node["id"]) {
-                        std::cerr << "[RealmLoader] Entity missing required fields (name or id)" << std::endl;
-                        continue;
+                    // Safety check: prevent self-parenting
+                    if (entity.parent_id == entity.id) {
+                        std::cerr << "[RealmLoader] WARNING: Entity " << entity.id.get_value()
+                                << " cannot be its own parent! Setting as root." << std::endl;
+                        entity.parent_id = SimpleGuid::invalid();
                     }
+                } else {
+                    entity.parent_id = SimpleGuid::invalid(); // root entity
+                }
 
-                    entity.name = entity_node["name"].as<std::string>();
-                    entity.id = entity_node["id"].as<SimpleGuid>();
+                // Parse elements if they exist
+                const YAML::Node elements_node = entity_node["elements"];
+                if (elements_node && elements_node.IsMap()) {
+                    for (const auto& element_kv : elements_node) {
+                        const std::string type_name = element_kv.first.as<std::string>();
+                        const YAML::Node& element_data = element_kv.second;
 
-                    // Optional parent
-                    if (entity_node["parent"] && !entity_node["parent"].IsNull()) {
-                        // Convert parent to uint64_t first
-                        uint64_t parent_value = entity_node["parent"].as<uint64_t>(0); // default to 0 if missing
-                        entity.parent_id = (parent_value != 0) ? SimpleGuid::from_value(parent_value) : SimpleGuid::invalid();
+                        if (!element_data.IsMap()) {
+                            std::cerr << "    [Element] Invalid element data for type: " << type_name << std::endl;
+                            continue;
+                        }
 
-                        // Safety check: prevent self-parenting
-                        if (entity.parent_id == entity.id) {
-                            std::cerr << "[RealmLoader] WARNING: Entity " << entity.id.get_value()
-                                    << " cannot be its own parent! Setting as root." << std::endl;
-                            entity.parent_id = SimpleGuid::invalid();
+                        if (!element_data["id"]) {
+                            std::cerr << "    [Element] Missing ID for element of type: " << type_name << std::endl;
+                            continue;
                         }
-                    } else {
-                        entity.parent_id = SimpleGuid::invalid(); // root entity
-                    }
 
-                    // Parse elements if they exist
-                    if (entity_node["elements"] && entity_node["elements"].IsMap()) {
-                        for (const auto& element_kv : entity_node["elements"]) {
-                            const std::string type_name = element_kv.first.as<std::string>();
-                            const YAML::Node& element_data = element_kv.second;
+                        try {
+                            ElementArchetype element;
+                            element.type_name = type_name;
+                            element.id = element_data["id"].as<SimpleGuid>();
+                            // If the flag exists in the file, load it. Otherwise, the C++
+                            // default of 'true' will be used. This makes it backwards-compatible.
 
-                            if (!element_data.IsMap()) {
-                                std::cerr << "    [Element] Invalid element data for type: " << type_name << std::endl;
-                                continue;
-                            }
+                            // Assign the parent entity's ID to the element archetype
+                            element.owner_id = entity.id;
 
-                            if (!element_data["id"]) {
-                                std::cerr << "    [Element] Missing ID for element of type: " << type_name << std::endl;
-                                continue;
+                            if (element_data["allows_duplication"]) {
+                                element.allows_duplication = element_data["allows_duplication"].as<bool>();
                             }
 
-                            try {
-                                ElementArchetype element;
-                                element.type_name = type_name;
-                                element.id = element_data["id"].as<SimpleGuid>();
-                                // If the flag exists in the file, load it. Otherwise, the C++
-                                // default of 'true' will be used. This makes it backwards-compatible.
-
-                                // Assign the parent entity's ID to the element archetype
-                                element.owner_id = entity.id;
-
-                                if (element_data["allows_duplication"]) {
-                                    element.allows_duplication = element_data["allows_duplication"].as<bool>();
-                                }
-
-                                // new implementation with a deep copy
-                                element.data = YAML::Load(YAML::Dump(element_data)); // deep copy
-                                element.data.remove("id");
-                                element.data.remove("allows_duplication");
-
-                                if (element.data["name"]) {
-                                    // If a 'name' property exists in the YAML, use it.
-                                    element.name = element.data["name"].as<std::string>();
-                                } else {
-                                    // Otherwise (for older files), default the name to the type_name
-                                    // and add it to the data node for future saves.
-                                    element.name = element.type_name;
-                                    element.data["name"] = element.type_name;
-                                }
-
-                                entity.elements.push_back(element);
-                            } catch (const YAML::Exception& e) {
-                                std::cerr << "    [Element] Error parsing element '" << type_name 
-                                        << "': " << e.what() << std::endl;
+                            // new implementation with a deep copy
+                            element.data = YAML::Load(YAML::Dump(element_data)); // deep copy
+                            element.data.remove("id");
+                            element.data.remove("allows_duplication");
+
+                            if (element.data["name"]) {
+                                // If a 'name' property exists in the YAML, use it.
+                                element.name = element.data["name"].as<std::string>();
+                            } else {
+                                // Otherwise (for older files), default the name to the type_name
+                                // and add it to the data node for future saves.
+                                element.name = element.type_name;
+                                element.data["name"] = element.type_name;
                             }
+
+                            entity.elements.push_back(std::move(element));
+                        } catch (const YAML::Exception& e) {
+                            std::cerr << "    [Element] Error parsing element '" << type_name
+                                    << "': " << e.what() << std::endl;
+                        }
+                    }
+                }
+                return true;
+
+            } catch (const YAML::Exception& e) {
+                std::cerr << "[RealmLoader] Error parsing entity: " << e.what()
+                        << " (line " << e.mark.line << ")" << std::endl;
+                return false;
+            }
+        }
+
+        // --- Archetype cache ---
+        // Layout: RealmCacheHeader, then per entity its name, id, parent id and
+        // elements; per element its type name, name, id, allows_duplication and
+        // the data node tree. Strings are a uint32 length and the bytes; a node is
+        // a kind byte, a style byte and its tag, then the scalar text or the
+        // uint32 child count and children (key, value pairs for a map).
+        constexpr char REALM_CACHE_MAGIC[4] = { 'S', 'R', 'A', 'C' };
+        // Bump when the layout below changes; other versions are rebuilt from the YAML.
+        constexpr uint32_t REALM_CACHE_VERSION = 1;
+
+        enum class CachedNodeKind : uint8_t { Null, Scalar, Sequence, Map };
+
+        struct RealmCacheHeader {
+            char magic[4];
+            uint32_t version;
+            // The YAML the cache was built from; any other size or time means it was edited.
+            uint64_t yaml_size;
+            int64_t yaml_write_time;
+            uint64_t entity_count;
+        };
+
+        template<typename T>
+        void write_value(std::string& out, const T& value) {
+            out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        void write_string(std::string& out, const std::string& str) {
+            write_value(out, static_cast<uint32_t>(str.size()));
+            out.append(str);
+        }
+
+        void write_node(std::string& out, const YAML::Node& node) {
+            CachedNodeKind kind = CachedNodeKind::Null;
+            if (node.IsScalar()) kind = CachedNodeKind::Scalar;
+            else if (node.IsSequence()) kind = CachedNodeKind::Sequence;
+            else if (node.IsMap()) kind = CachedNodeKind::Map;
+            write_value(out, static_cast<uint8_t>(kind));
+            write_value(out, static_cast<uint8_t>(node.IsDefined() ? node.Style() : YAML::EmitterStyle::Default));
+            write_string(out, node.IsDefined() ? node.Tag() : std::string());
+
+            switch (kind) {
+                case CachedNodeKind::Scalar:
+                    write_string(out, node.Scalar());
+                    break;
+                case CachedNodeKind::Sequence:
+                    write_value(out, static_cast<uint32_t>(node.size()));
+                    for (const auto& child : node) write_node(out, child);
+                    break;
+                case CachedNodeKind::Map:
+                    write_value(out, static_cast<uint32_t>(node.size()));
+                    for (const auto& child : node) {
+                        write_node(out, child.first);
+                        write_node(out, child.second);
+                    }
+                    break;
+                case CachedNodeKind::Null:
+                    break;
+            }
+        }
+
+        // Reads the cache from memory; any short read clears 'ok' and the rest
+        // of the values come back empty.
+        struct CacheReader {
+            const char* data;
+            size_t size;
+            size_t offset = 0;
+            bool ok = true;
+
+            template<typename T>
+            T read_value() {
+                T value{};
+                if (!ok || size - offset < sizeof(T)) { ok = false; return value; }
+                std::memcpy(&value, data + offset, sizeof(T));
+                offset += sizeof(T);
+                return value;
+            }
+
+            std::string read_string() {
+                const uint32_t length = read_value<uint32_t>();
+                if (!ok || size - offset < length) { ok = false; return std::string(); }
+                std::string result(data + offset, length);
+                offset += length;
+                return result;
+            }
+
+            YAML::Node read_node() {
+                const auto kind = static_cast<CachedNodeKind>(read_value<uint8_t>());
+                const auto style = static_cast<YAML::EmitterStyle::value>(read_value<uint8_t>());
+                const std::string tag = read_string();
+                if (!ok) return YAML::Node();
+
+                YAML::Node node;
+                switch (kind) {
+                    case CachedNodeKind::Scalar:
+                        node = YAML::Node(read_string());
+                        break;
+                    case CachedNodeKind::Sequence: {
+                        node = YAML::Node(YAML::NodeType::Sequence);
+                        const uint32_t count = read_value<uint32_t>();
+                        for (uint32_t i = 0; ok && i < count; ++i) node.push_back(read_node());
+                        break;
+                    }
+                    case CachedNodeKind::Map: {
+                        node = YAML::Node(YAML::NodeType::Map);
+                        const uint32_t count = read_value<uint32_t>();
+                        for (uint32_t i = 0; ok && i < count; ++i) {
+                            YAML::Node key = read_node();
+                            YAML::Node value = read_node();
+                            node.force_insert(key, value);
+                        }
+                        break;
+                    }
+                    case CachedNodeKind::Null:
+                        node = YAML::Node(YAML::NodeType::Null);
+                        break;
+                    default:
+                        ok = false;
+                        return YAML::Node();
+                }
+                if (!tag.empty()) node.SetTag(tag);
+                node.SetStyle(style);
+                return node;
+            }
+        };
+
+        bool write_realm_cache(const std::string& yaml_path, const std::vector<EntityArchetype>& archetypes) {
+            RealmCacheHeader header{};
+            std::memcpy(header.magic, REALM_CACHE_MAGIC, sizeof(header.magic));
+            header.version = REALM_CACHE_VERSION;
+            header.entity_count = archetypes.size();
+            RealmFileStamp stamp;
+            if (!get_realm_file_stamp(yaml_path, stamp)) return false;
+            header.yaml_size = stamp.size;
+            header.yaml_write_time = stamp.write_time;
+
+            std::string out;
+            write_value(out, header);
+            for (const EntityArchetype& entity : archetypes) {
+                write_string(out, entity.name);
+                write_value(out, entity.id.get_value());
+                write_value(out, entity.parent_id.get_value());
+                write_value(out, static_cast<uint32_t>(entity.elements.size()));
+                for (const ElementArchetype& element : entity.elements) {
+                    write_string(out, element.type_name);
+                    write_string(out, element.name);
+                    write_value(out, element.id.get_value());
+                    write_value(out, static_cast<uint8_t>(element.allows_duplication));
+                    write_node(out, element.data);
+                }
+            }
+
+            // Written beside the real cache and renamed over it, so a reader
+            // never sees half a file.
+            const std::string cache_path = get_realm_cache_path(yaml_path);
+            const std::string temp_path = cache_path + ".tmp";
+            {
+                std::ofstream stream(temp_path, std::ios::binary | std::ios::trunc);
+                if (!stream.is_open()) return false;
+                stream.write(out.data(), static_cast<std::streamsize>(out.size()));
+                if (!stream) return false;
+            }
+            std::error_code error;
+            std::filesystem::rename(temp_path, cache_path, error);
+            if (error) {
+                std::filesystem::remove(temp_path, error);
+                return false;
+            }
+            return true;
+        }
+
+        bool read_realm_cache(const std::string& yaml_path, std::vector<EntityArchetype>& out_archetypes) {
+            std::ifstream stream(get_realm_cache_path(yaml_path), std::ios::binary | std::ios::ate);
+            if (!stream.is_open()) return false;
+            std::string bytes(static_cast<size_t>(stream.tellg()), '\0');
+            stream.seekg(0);
+            stream.read(&bytes[0], static_cast<std::streamsize>(bytes.size()));
+            if (!stream) return false;
+
+            CacheReader reader{ bytes.data(), bytes.size() };
+            const RealmCacheHeader header = reader.read_value<RealmCacheHeader>();
+            RealmFileStamp stamp;
+            if (!reader.ok
+                || std::memcmp(header.magic, REALM_CACHE_MAGIC, sizeof(header.magic)) != 0
+                || header.version != REALM_CACHE_VERSION
+                || !get_realm_file_stamp(yaml_path, stamp)
+                || header.yaml_size != stamp.size
+                || header.yaml_write_time != stamp.write_time) {
+                return false;
+            }
+
+            std::vector<EntityArchetype> archetypes;
+            // Every entity takes at least 24 bytes, which bounds a corrupt count.
+            archetypes.reserve(static_cast<size_t>(std::min<uint64_t>(header.entity_count, bytes.size() / 24)));
+            for (uint64_t i = 0; reader.ok && i < header.entity_count; ++i) {
+                EntityArchetype entity;
+                entity.name = reader.read_string();
+                entity.id = SimpleGuid::from_value(reader.read_value<uint64_t>());
+                const uint64_t parent_value = reader.read_value<uint64_t>();
+                entity.parent_id = parent_value != 0 ? SimpleGuid::from_value(parent_value) : SimpleGuid::invalid();
+                const uint32_t element_count = reader.read_value<uint32_t>();
+                for (uint32_t e = 0; reader.ok && e < element_count; ++e) {
+                    ElementArchetype element;
+                    element.type_name = reader.read_string();
+                    element.name = reader.read_string();
+                    element.id = SimpleGuid::from_value(reader.read_value<uint64_t>());
+                    element.owner_id = entity.id;
+                    element.allows_duplication = reader.read_value<uint8_t>() != 0;
+                    element.data = reader.read_node();
+                    entity.elements.push_back(std::move(element));
+                }
+                archetypes.push_back(std::move(entity));
+            }
+            if (!reader.ok || reader.offset != reader.size) return false;
+
+            out_archetypes = std::move(archetypes);
+            return true;
+        }
+
+        // --- Journal ---
+
+        // Splits the journal into its '---' documents.
+        std::vector<std::string> split_journal_documents(const std::string& text) {
+            std::vector<std::string> documents;
+            size_t line_start = 0;
+            while (line_start < text.size()) {
+                size_t line_end = text.find('\n', line_start);
+                if (line_end == std::string::npos) line_end = text.size();
+                std::string line = text.substr(line_start, line_end - line_start);
+                if (!line.empty() && line.back() == '\r') line.pop_back();
+                if (line == "---") {
+                    documents.emplace_back();
+                } else if (!documents.empty()) {
+                    documents.back().append(text, line_start, line_end - line_start).push_back('\n');
+                }
+                line_start = line_end + 1;
+            }
+            return documents;
+        }
+
+        // Replays the saves in the journal over the base realm. Entities keep
+        // their first position; new ones go to the end. Stops at the first save
+        // that is cut short or unreadable, so a crash mid-append loses only
+        // that save.
+        void apply_realm_journal(const std::string& filepath, std::vector<EntityArchetype>& archetypes) {
+            std::ifstream stream(get_realm_journal_path(filepath), std::ios::binary);
+            if (!stream.is_open()) return;
+            const std::string text((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+            const std::vector<std::string> documents = split_journal_documents(text);
+            if (documents.empty()) return;
+
+            // The journal only applies to the exact file it was started against.
+            try {
+                const YAML::Node header = YAML::Load(documents[0]);
+                RealmFileStamp stamp;
+                if (!header["Journal"] || header["Journal"].as<uint32_t>() != REALM_JOURNAL_VERSION
+                    || !header["Base"] || !get_realm_file_stamp(filepath, stamp)
+                    || header["Base"]["size"].as<uint64_t>() != stamp.size
+                    || header["Base"]["write_time"].as<int64_t>() != stamp.write_time) {
+                    std::cerr << "[RealmLoader] Ignoring journal written against another version of: " << filepath << std::endl;
+                    return;
+                }
+            } catch (const YAML::Exception& e) {
+                std::cerr << "[RealmLoader] Ignoring unreadable journal for " << filepath << ": " << e.what() << std::endl;
+                return;
+            }
+
+            std::unordered_map<SimpleGuid, size_t> index_by_id;
+            for (size_t i = 0; i < archetypes.size(); ++i) {
+                index_by_id[archetypes[i].id] = i;
+            }
+            std::vector<char> is_purged(archetypes.size(), 0);
+            size_t saves_applied = 0;
+
+            for (size_t d = 1; d < documents.size(); ++d) {
+                YAML::Node save;
+                try {
+                    save = YAML::Load(documents[d]);
+                } catch (const YAML::Exception&) {
+                    save = YAML::Node();
+                }
+                const YAML::Node upserts = save["Upsert"];
+                const YAML::Node purges = save["Purge"];
+                const size_t record_count = (upserts ? upserts.size() : 0) + (purges ? purges.size() : 0);
+                if (!save.IsMap() || !save["Commit"] || save["Commit"].as<size_t>(0) != record_count) {
+                    std::cerr << "[RealmLoader] Journal save " << d << " is incomplete; "
+                              << "the saves after it are ignored." << std::endl;
+                    break;
+                }
+
+                if (upserts) {
+                    for (const auto& entity_node : upserts) {
+                        EntityArchetype entity;
+                        if (!build_entity_archetype(entity_node, entity)) continue;
+                        auto it = index_by_id.find(entity.id);
+                        if (it != index_by_id.end()) {
+                            archetypes[it->second] = std::move(entity);
+                            is_purged[it->second] = 0;
+                        } else {
+                            index_by_id[entity.id] = archetypes.size();
+                            archetypes.push_back(std::move(entity));
+                            is_purged.push_back(0);
                         }
                     }
+                }
+                if (purges) {
+                    for (const auto& id_node : purges) {
+                        auto it = index_by_id.find(SimpleGuid::from_value(id_node.as<uint64_t>(0)));
+                        if (it != index_by_id.end()) is_purged[it->second] = 1;
+                    }
+                }
+                ++saves_applied;
+            }
 
-                    archetypes.push_back(entity);
+            size_t write_index = 0;
+            for (size_t i = 0; i < archetypes.size(); ++i) {
+                if (is_purged[i]) continue;
+                if (write_index != i) archetypes[write_index] = std::move(archetypes[i]);
+                ++write_index;
+            }
+            archetypes.resize(write_index);
+            std::cout << "[RealmLoader] Replayed " << saves_applied << " journal saves" << std::endl;
+        }
+    }
+
+    bool get_realm_file_stamp(const std::string& filepath, RealmFileStamp& out_stamp) {
+        std::error_code error;
+        const auto write_time = std::filesystem::last_write_time(filepath, error);
+        if (error) return false;
+        const auto size = std::filesystem::file_size(filepath, error);
+        if (error) return false;
+        out_stamp.size = static_cast<uint64_t>(size);
+        out_stamp.write_time = static_cast<int64_t>(write_time.time_since_epoch().count());
+        return true;
+    }
 
-                } catch (const YAML::Exception& e) {
-                    std::cerr << "[RealmLoader] Error parsing entity: " << e.what() 
-                            << " (line " << e.mark.line << ")" << std::endl;
+    std::string get_realm_cache_path(const std::string& filepath) {
+        return std::filesystem::path(filepath).replace_extension(".cache").string();
+    }
+
+    std::string get_realm_journal_path(const std::string& filepath) {
+        return std::filesystem::path(filepath).replace_extension(".journal").string();
+    }
+
+    std::vector<EntityArchetype> load_archetypes_from_file(const std::string& filepath) {
+        return load_archetypes_from_file(filepath, RealmLoadProgressCallback());
+    }
+
+    // This is the function DEFINITION.
+    // It provides the actual implementation.
+    std::vector<EntityArchetype> load_archetypes_from_file(const std::string& filepath,
+        const RealmLoadProgressCallback& on_progress, JobSystem* job_system) {
+        std::vector<EntityArchetype> archetypes;
+
+        // Fast path: an unchanged realm comes straight from its binary cache.
+        if (read_realm_cache(filepath, archetypes)) {
+            std::cout << "[RealmLoader] Loaded " << archetypes.size() << " entities from cache" << std::endl;
+            if (on_progress) {
+                on_progress(0, archetypes.size());
+                on_progress(archetypes.size(), archetypes.size());
+            }
+            apply_realm_journal(filepath, archetypes);
+            return archetypes;
+        }
+
+        try {
+            YAML::Node realm_yaml = YAML::LoadFile(filepath);
+
+            if (!realm_yaml["Entities"] || !realm_yaml["Entities"].IsSequence()) {
+                std::cerr << "[RealmLoader] Invalid or missing 'Entities' node in YAML file: " << filepath << std::endl;
+                return archetypes;
+            }
+
+            // Collect the entity nodes up front; the workers index into this.
+            const YAML::Node entities_node = realm_yaml["Entities"];
+            std::vector<YAML::Node> entity_nodes;
+            entity_nodes.reserve(entities_node.size());
+            for (const auto& entity_node : entities_node) {
+                entity_nodes.push_back(entity_node);
+            }
+            const size_t entity_total = entity_nodes.size();
+            std::cout << "[RealmLoader] Parsing " << entity_total << " entities..." << std::endl;
+            if (on_progress) on_progress(0, entity_total);
+
+            std::vector<EntityArchetype> built(entity_total);
+            std::vector<char> is_valid(entity_total, 0);
+            const size_t batch_count = (entity_total + REALM_LOAD_BATCH_SIZE - 1) / REALM_LOAD_BATCH_SIZE;
+            std::atomic<size_t> next_batch{0};
+            std::atomic<size_t> entities_done{0};
+
+            // Workers and the calling thread pull batches until none are left.
+            // Each batch writes only its own slots, so no locking is needed.
+            auto run_next_batch = [&]() -> bool {
+                const size_t batch = next_batch.fetch_add(1, std::memory_order_relaxed);
+                if (batch >= batch_count) return false;
+                const size_t begin = batch * REALM_LOAD_BATCH_SIZE;
+                const size_t end = std::min(begin + REALM_LOAD_BATCH_SIZE, entity_total);
+                for (size_t i = begin; i < end; ++i) {
+                    const YAML::Node& entity_node = entity_nodes[i];
+                    is_valid[i] = build_entity_archetype(entity_node, built[i]) ? 1 : 0;
+                }
+                entities_done.fetch_add(end - begin, std::memory_order_release);
+                return true;
+            };
+
+            JobSystem& jobs = job_system ? *job_system : JobSystem::get();
+            JobGroup group;
+            // One batch per job, never a loop: a thread that helps out while
+            // waiting on its own group (the UI thread in Realm::update, say) may
+            // pick one of these up, and must be back within a batch.
+            if (jobs.get_worker_count() > 0) {
+                for (size_t i = 0; i < batch_count; ++i) {
+                    jobs.submit(group, [&run_next_batch]() { run_next_batch(); });
+                }
+            }
+            // Progress is reported from here, between the batches this thread runs.
+            while (run_next_batch()) {
+                if (on_progress) on_progress(entities_done.load(std::memory_order_acquire), entity_total);
+            }
+            jobs.wait(group);
+
+            // Merge in file order, dropping the entities that failed to parse.
+            archetypes.reserve(entity_total);
+            for (size_t i = 0; i < entity_total; ++i) {
+                if (is_valid[i]) {
+                    archetypes.push_back(std::move(built[i]));
                 }
             }
+            if (on_progress) on_progress(entity_total, entity_total);
 
             std::cout << "[RealmLoader] Successfully loaded " << archetypes.size() << " entities" << std::endl;
-            
+
+            if (!write_realm_cache(filepath, archetypes)) {
+                std::cerr << "[RealmLoader] Could not write the archetype cache for: " << filepath << std::endl;
+            }
+            // The cache holds the base file only; the journal is replayed on every load.
+            apply_realm_journal(filepath, archetypes);
+
         } catch (const YAML::Exception& e) {
-            std::cerr << "[RealmLoader] YAML error: " << e.what() 
+            std::cerr << "[RealmLoader] YAML error: " << e.what()
                     << " (line " << e.mark.line << ")" << std::endl;
         } catch (const std::exception& e) {
             std::cerr << "[RealmLoader] Unexpected error: " << e.what() << std::endl;
@@ -129,4 +562,68 @@ namespace Salix {
 
         return archetypes;
     }
-} // namespace Salix
\ No newline at end of file
+
+
+    // --- RealmLoadTask ---
+
+    struct RealmLoadTask::Pimpl {
+        // Used when the caller passes no job system, so the load never shares
+        // queues with the per-frame work on JobSystem::get().
+        std::unique_ptr<JobSystem> own_jobs;
+        std::thread thread;
+        std::atomic<bool> done{false};
+        std::atomic<size_t> entities_done{0};
+        std::atomic<size_t> entity_total{0};
+        std::vector<EntityArchetype> result;
+    };
+
+    RealmLoadTask::RealmLoadTask(const std::string& filepath, JobSystem* job_system)
+        : pimpl(std::make_unique<Pimpl>()) {
+        Pimpl* state = pimpl.get();
+        if (!job_system) {
+            state->own_jobs = std::make_unique<JobSystem>(std::max(1u, std::thread::hardware_concurrency()) - 1);
+            job_system = state->own_jobs.get();
+        }
+        state->thread = std::thread([state, filepath, job_system]() {
+            state->result = load_archetypes_from_file(filepath,
+                [state](size_t entities_done, size_t entity_total) {
+                    state->entity_total.store(entity_total, std::memory_order_relaxed);
+                    state->entities_done.store(entities_done, std::memory_order_relaxed);
+                },
+                job_system);
+            state->done.store(true, std::memory_order_release);
+        });
+    }
+
+    RealmLoadTask::~RealmLoadTask() {
+        if (pimpl->thread.joinable()) {
+            pimpl->thread.join();
+        }
+    }
+
+    bool RealmLoadTask::is_done() const {
+        return pimpl->done.load(std::memory_order_acquire);
+    }
+
+    size_t RealmLoadTask::get_entities_done() const {
+        return pimpl->entities_done.load(std::memory_order_relaxed);
+    }
+
+    size_t RealmLoadTask::get_entity_total() const {
+        return pimpl->entity_total.load(std::memory_order_relaxed);
+    }
+
+    float RealmLoadTask::get_progress() const {
+        if (is_done()) return 1.0f;
+        const size_t total = get_entity_total();
+        return total ? static_cast<float>(get_entities_done()) / static_cast<float>(total) : 0.0f;
+    }
+
+    std::vector<EntityArchetype> RealmLoadTask::take_result() {
+        if (pimpl->thread.joinable()) {
+            pimpl->thread.join();
+        }
+        return std::move(pimpl->result);
+    }
+
+} // namespace Salix
@@ -3,13 +3,77 @@
 #pragma once
 #include <Editor/EditorAPI.h>
 #include <Editor/Archetypes.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <vector>
 #include <string>
 
 namespace Salix {
 
+    class JobSystem;
+
+    // Called with (entities_done, entity_total) on the thread that runs the load,
+    // never from two threads at once. entity_total is known once the file is parsed.
+    using RealmLoadProgressCallback = std::function<void(size_t entities_done, size_t entity_total)>;
+
+    // Entities are handed to the workers in batches of this many.
+    constexpr size_t REALM_LOAD_BATCH_SIZE = 32;
+
+    // Identifies one version of a file on disk without reading it.
+    struct RealmFileStamp {
+        uint64_t size = 0;
+        int64_t write_time = 0;
+    };
+    // False if the file is missing.
+    EDITOR_API bool get_realm_file_stamp(const std::string& filepath, RealmFileStamp& out_stamp);
+
     // This is the function DECLARATION.
     // It tells the compiler "this function exists somewhere."
-    std::vector<EntityArchetype> load_archetypes_from_file(const std::string& filepath);
+    // The YAML is parsed once, then the entities are turned into archetypes on
+    // the JobSystem's workers; the result is always in file order.
+    // A successful parse also writes a binary cache next to the file (see
+    // get_realm_cache_path); while the YAML's size and write time still match
+    // it, later loads read the cache and skip the YAML entirely.
+    // Saves appended to the realm's journal (see RealmSaver.h) are then
+    // replayed on top, in the order they were written.
+    EDITOR_API std::vector<EntityArchetype> load_archetypes_from_file(const std::string& filepath);
+    // job_system == nullptr means JobSystem::get().
+    EDITOR_API std::vector<EntityArchetype> load_archetypes_from_file(const std::string& filepath,
+        const RealmLoadProgressCallback& on_progress, JobSystem* job_system = nullptr);
+
+    // The realm file with its extension replaced by ".cache".
+    EDITOR_API std::string get_realm_cache_path(const std::string& filepath);
+    // The realm file with its extension replaced by ".journal".
+    EDITOR_API std::string get_realm_journal_path(const std::string& filepath);
+
+    // Runs load_archetypes_from_file() on a background thread so the UI thread
+    // can keep drawing (and show a progress bar) while a big realm loads.
+    // job_system == nullptr gives the task a JobSystem of its own for the
+    // load's lifetime, rather than JobSystem::get().
+    class EDITOR_API RealmLoadTask {
+    public:
+        explicit RealmLoadTask(const std::string& filepath, JobSystem* job_system = nullptr);
+        // Waits for the load if it is still running.
+        ~RealmLoadTask();
+
+        bool is_done() const;
+        size_t get_entities_done() const;
+        // 0 until the YAML has been parsed.
+        size_t get_entity_total() const;
+        // 0..1, for a progress bar.
+        float get_progress() const;
+
+        // Waits for the load, then hands over the archetypes. Call once.
+        std::vector<EntityArchetype> take_result();
+
+    private:
+        RealmLoadTask(const RealmLoadTask&) = delete;
+        RealmLoadTask& operator=(const RealmLoadTask&) = delete;
+
+        struct Pimpl;
+        std::unique_ptr<Pimpl> pimpl;
+    };
 
-} // namespace Salix
\ No newline at end of file
+} // namespace Salix
@@ -0,0 +1,248 @@
+// Editor/management/RealmSaver.cpp
+#include <Editor/management/RealmSaver.h>
+#include <Editor/management/RealmLoader.h>
+#include <yaml-cpp/yaml.h>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+
+namespace Salix {
+
+    namespace {
+        // The inverse of the loader's build_entity_archetype(): id and
+        // allows_duplication go back into each element's data map.
+        YAML::Node make_entity_node(const EntityArchetype& entity) {
+            YAML::Node entity_node(YAML::NodeType::Map);
+            entity_node["id"] = entity.id.get_value();
+            entity_node["name"] = entity.name;
+            entity_node["visible"] = entity.is_visible;
+            // 0 marks a root, as in the hand-written realms.
+            entity_node["parent"] = entity.parent_id.get_value();
+
+            YAML::Node elements_node(YAML::NodeType::Map);
+            for (const ElementArchetype& element : entity.elements) {
+                YAML::Node element_node(YAML::NodeType::Map);
+                element_node["id"] = element.id.get_value();
+                element_node["allows_duplication"] = element.allows_duplication;
+                if (element.data.IsMap()) {
+                    for (const auto& property : element.data) {
+                        const std::string key = property.first.as<std::string>();
+                        if (key == "id" || key == "allows_duplication") continue;
+                        element_node[key] = property.second;
+                    }
+                }
+                // Elements are keyed by type, and duplicable types repeat the key.
+                elements_node.force_insert(element.type_name, element_node);
+            }
+            entity_node["elements"] = elements_node;
+            return entity_node;
+        }
+
+        // Every top-level block of the existing file except Entities, so a
+        // full save keeps the version line, settings and their comments.
+        std::string read_realm_preamble(const std::string& filepath) {
+            std::ifstream in(filepath);
+            if (!in.is_open()) return "RealmFileVersion: 1.0\n";
+
+            std::string preamble;
+            std::string line;
+            bool in_entities = false;
+            while (std::getline(in, line)) {
+                if (!line.empty() && line.back() == '\r') line.pop_back();
+                // Comments, indented lines and '-' items belong to the block above them.
+                const bool starts_block = !line.empty() && line[0] != ' ' && line[0] != '\t'
+                    && line[0] != '#' && line[0] != '-';
+                if (starts_block) {
+                    in_entities = line.compare(0, 9, "Entities:") == 0;
+                }
+                if (!in_entities) {
+                    preamble.append(line).push_back('\n');
+                }
+            }
+            while (preamble.size() >= 2 && preamble[preamble.size() - 1] == '\n' && preamble[preamble.size() - 2] == '\n') {
+                preamble.pop_back();
+            }
+            return preamble;
+        }
+
+        // Where the complete saves in filepath's journal end, or npos if there
+        // is no journal started against filepath as it is now. Every append
+        // first cuts the journal back to this point, so only the last save
+        // can ever be one cut short by a crash; the saves before it were
+        // checked when they were appended.
+        size_t find_journal_end(const std::string& filepath, size_t& out_journal_size) {
+            std::ifstream in(get_realm_journal_path(filepath), std::ios::binary);
+            if (!in.is_open()) return std::string::npos;
+            const std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+            out_journal_size = text.size();
+
+            // Offsets of the "---" lines that start each document.
+            std::vector<size_t> separators;
+            size_t line_start = 0;
+            while (line_start < text.size()) {
+                size_t line_end = text.find('\n', line_start);
+                if (line_end == std::string::npos) line_end = text.size();
+                size_t length = line_end - line_start;
+                if (length > 0 && text[line_start + length - 1] == '\r') --length;
+                if (length == 3 && text.compare(line_start, 3, "---") == 0) separators.push_back(line_start);
+                line_start = line_end + 1;
+            }
+            if (separators.empty() || separators[0] != 0) return std::string::npos;
+
+            RealmFileStamp stamp;
+            if (!get_realm_file_stamp(filepath, stamp)) return std::string::npos;
+            try {
+                const size_t header_end = separators.size() > 1 ? separators[1] : text.size();
+                const YAML::Node header = YAML::Load(text.substr(0, header_end));
+                const bool matches = header["Journal"] && header["Journal"].as<uint32_t>() == REALM_JOURNAL_VERSION
+                    && header["Base"]
+                    && header["Base"]["size"].as<uint64_t>() == stamp.size
+                    && header["Base"]["write_time"].as<int64_t>() == stamp.write_time;
+                if (!matches) return std::string::npos;
+            } catch (const YAML::Exception&) {
+                return std::string::npos;
+            }
+
+            // A write that stopped mid-line leaves no newline at the end; the
+            // next "---" would run into it.
+            const bool ends_cleanly = text.back() == '\n';
+            const size_t last_start = separators.back();
+            if (last_start == 0) return ends_cleanly ? text.size() : std::string::npos;
+            if (!ends_cleanly) return last_start;
+
+            // The same completeness test the loader applies.
+            try {
+                const YAML::Node save = YAML::Load(text.substr(last_start));
+                const YAML::Node upserts = save["Upsert"];
+                const YAML::Node purges = save["Purge"];
+                const size_t record_count = (upserts ? upserts.size() : 0) + (purges ? purges.size() : 0);
+                if (save.IsMap() && save["Commit"] && save["Commit"].as<size_t>(0) == record_count) {
+                    return text.size();
+                }
+            } catch (const YAML::Exception&) {
+            }
+            return last_start;
+        }
+    }
+
+    bool save_archetypes_to_file(const std::string& filepath, const std::vector<EntityArchetype>& archetypes) {
+        try {
+            YAML::Emitter out;
+            out << YAML::BeginMap << YAML::Key << "Entities" << YAML::Value << YAML::BeginSeq;
+            for (const EntityArchetype& entity : archetypes) {
+                out << make_entity_node(entity);
+            }
+            out << YAML::EndSeq << YAML::EndMap;
+            if (!out.good()) {
+                std::cerr << "[RealmSaver] Could not emit realm: " << out.GetLastError() << std::endl;
+                return false;
+            }
+
+            // Written beside the realm and renamed over it, so a failed save
+            // leaves the old file (and its journal) intact.
+            const std::string temp_path = filepath + ".tmp";
+            {
+                std::ofstream stream(temp_path, std::ios::binary | std::ios::trunc);
+                if (!stream.is_open()) {
+                    std::cerr << "[RealmSaver] Could not open for writing: " << temp_path << std::endl;
+                    return false;
+                }
+                stream << read_realm_preamble(filepath) << "\n" << out.c_str() << "\n";
+                if (!stream) return false;
+            }
+            std::error_code error;
+            std::filesystem::rename(temp_path, filepath, error);
+            if (error) {
+                std::cerr << "[RealmSaver] Could not replace " << filepath << ": " << error.message() << std::endl;
+                std::filesystem::remove(temp_path, error);
+                return false;
+            }
+            // A leftover journal would no longer match the file's stamp, but
+            // there is no reason to keep it.
+            std::filesystem::remove(get_realm_journal_path(filepath), error);
+
+        } catch (const YAML::Exception& e) {
+            std::cerr << "[RealmSaver] YAML error: " << e.what() << std::endl;
+            return false;
+        }
+
+        std::cout << "[RealmSaver] Saved " << archetypes.size() << " entities to " << filepath << std::endl;
+        return true;
+    }
+
+    bool append_realm_journal(const std::string& filepath,
+        const std::vector<const EntityArchetype*>& upserted, const std::vector<SimpleGuid>& purged_ids) {
+        RealmFileStamp stamp;
+        if (!get_realm_file_stamp(filepath, stamp)) {
+            std::cerr << "[RealmSaver] Cannot journal a save for a missing realm: " << filepath << std::endl;
+            return false;
+        }
+
+        try {
+            YAML::Emitter out;
+            out << YAML::BeginMap;
+            out << YAML::Key << "Upsert" << YAML::Value << YAML::BeginSeq;
+            for (const EntityArchetype* entity : upserted) {
+                out << make_entity_node(*entity);
+            }
+            out << YAML::EndSeq;
+            out << YAML::Key << "Purge" << YAML::Value << YAML::Flow << YAML::BeginSeq;
+            for (const SimpleGuid& id : purged_ids) {
+                out << id.get_value();
+            }
+            out << YAML::EndSeq;
+            out << YAML::Key << "Commit" << YAML::Value << (upserted.size() + purged_ids.size());
+            out << YAML::EndMap;
+            if (!out.good()) {
+                std::cerr << "[RealmSaver] Could not emit journal save: " << out.GetLastError() << std::endl;
+                return false;
+            }
+
+            const std::string journal_path = get_realm_journal_path(filepath);
+            size_t journal_size = 0;
+            const size_t journal_end = find_journal_end(filepath, journal_size);
+            const bool start_journal = journal_end == std::string::npos;
+            if (!start_journal && journal_end != journal_size) {
+                // Left by a crash mid-save. Appending after it would leave every
+                // later save behind an incomplete one, where the loader stops.
+                std::cerr << "[RealmSaver] Dropping an incomplete save from " << journal_path << std::endl;
+                std::error_code error;
+                std::filesystem::resize_file(journal_path, journal_end, error);
+                if (error) {
+                    std::cerr << "[RealmSaver] Could not truncate " << journal_path << ": " << error.message() << std::endl;
+                    return false;
+                }
+            }
+            std::ofstream stream(journal_path, std::ios::binary | (start_journal ? std::ios::trunc : std::ios::app));
+            if (!stream.is_open()) {
+                std::cerr << "[RealmSaver] Could not open for writing: " << journal_path << std::endl;
+                return false;
+            }
+            if (start_journal) {
+                stream << "---\n"
+                       << "Journal: " << REALM_JOURNAL_VERSION << "\n"
+                       << "Base: {size: " << stamp.size << ", write_time: " << stamp.write_time << "}\n";
+            }
+            stream << "---\n" << out.c_str() << "\n";
+            stream.flush();
+            if (!stream) return false;
+
+        } catch (const YAML::Exception& e) {
+            std::cerr << "[RealmSaver] YAML error: " << e.what() << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    bool realm_journal_needs_compaction(const std::string& filepath) {
+        RealmFileStamp realm_stamp;
+        RealmFileStamp journal_stamp;
+        if (!get_realm_file_stamp(filepath, realm_stamp) || !get_realm_file_stamp(get_realm_journal_path(filepath), journal_stamp)) {
+            return false;
+        }
+        return static_cast<double>(journal_stamp.size) > static_cast<double>(realm_stamp.size) * REALM_JOURNAL_COMPACT_RATIO;
+    }
+
+} // namespace Salix
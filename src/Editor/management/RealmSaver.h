@@ -0,0 +1,44 @@
+// Editor/management/RealmSaver.h
+
+#pragma once
+#include <Editor/EditorAPI.h>
+#include <Editor/Archetypes.h>
+#include <Salix/core/SimpleGuid.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Salix {
+
+    // A realm on disk is its YAML file plus an optional journal next to it
+    // (get_realm_journal_path). Small saves append to the journal instead of
+    // rewriting the whole file; load_archetypes_from_file() replays it.
+    //
+    // Journal layout, plain YAML documents:
+    //   ---
+    //   Journal: 1                        REALM_JOURNAL_VERSION
+    //   Base: {size: N, write_time: T}    RealmFileStamp of the realm file it extends
+    //   ---                               then one document per save:
+    //   Upsert: [entity, ...]             same shape as the realm's Entities entries
+    //   Purge: [id, ...]
+    //   Commit: <upserts + purges>        written last; a save without it is ignored
+    constexpr uint32_t REALM_JOURNAL_VERSION = 1;
+
+    // Once the journal is this large next to the realm file, the next save
+    // compacts: the file is rewritten in full and the journal dropped.
+    constexpr double REALM_JOURNAL_COMPACT_RATIO = 0.25;
+
+    // Rewrites filepath with every entity, keeping its other top-level keys
+    // (RealmFileVersion, Settings, ...), and deletes the journal.
+    EDITOR_API bool save_archetypes_to_file(const std::string& filepath, const std::vector<EntityArchetype>& archetypes);
+
+    // Appends one save to filepath's journal, starting a new journal if there
+    // is none or it belongs to an older version of the file. A last save left
+    // incomplete by a crash is cut off first, so it cannot hide this one.
+    // filepath must already exist; use save_archetypes_to_file() for a first save.
+    EDITOR_API bool append_realm_journal(const std::string& filepath,
+        const std::vector<const EntityArchetype*>& upserted, const std::vector<SimpleGuid>& purged_ids);
+
+    EDITOR_API bool realm_journal_needs_compaction(const std::string& filepath);
+
+} // namespace Salix
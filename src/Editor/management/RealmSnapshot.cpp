@@ -21,7 +21,9 @@ namespace Salix {
         // This map will store the truly immutable, deep-copied YAML data as a string.
         std::unordered_map<SimpleGuid, std::string> initial_element_data_map;
         std::string source_file_path;
-        
+
+        void add_entity(const EntityArchetype& source_entity);
+        void remove_entity(const SimpleGuid& entity_id);
     };
 
 
@@ -92,15 +94,13 @@ namespace Salix {
 
 
 
-    // Create an immutable RealmSnapshot from a vector of EntityArchetypes
-    RealmSnapshot RealmSnapshot::load_from_entity_archetype_vector(const std::vector<EntityArchetype>& archetype_vector) {
-    RealmSnapshot snapshot;
-    std::cout << "\n--- CREATING IMMUTABLE REALM SNAPSHOT ---\n";
+    // Deep copies one entity into the maps, replacing any older copy of it.
+    void RealmSnapshot::Pimpl::add_entity(const EntityArchetype& source_entity) {
+        remove_entity(source_entity.id);
 
-    for (const auto& source_entity : archetype_vector) {
         // 1. Create a copy of the entity archetype's metadata.
         EntityArchetype entity_copy;
-        
+
         // We now correctly copy the name from the source to the new copy.
         entity_copy.name = source_entity.name;
 
@@ -112,7 +112,7 @@ namespace Salix {
         // 2. Deep copy each element and populate the fossilized string map.
         for (const auto& source_element : source_entity.elements) {
             ElementArchetype element_copy;
-            
+
             element_copy.type_name = source_element.type_name;
             element_copy.id = source_element.id;
             element_copy.name = source_element.name;
@@ -121,45 +121,76 @@ namespace Salix {
             element_copy.state = source_element.state;
 
             element_copy.data = YAML::Load(YAML::Dump(source_element.data));
-            
-            snapshot.pimpl->initial_element_data_map[element_copy.id] = YAML::Dump(element_copy.data);
-            
 
-        // This populates the fossilized_element_data_map for direct value comparison.
-        const TypeInfo* type_info = ByteMirror::get_type_info_by_name(source_element.type_name);
-        if (type_info) {
-            std::map<std::string, PropertyValue> property_map;
-            // Iterate through all reflected properties for this element type
-            for (const auto& prop : ByteMirror::get_all_properties_for_type(type_info)) {
-                // If the property exists in the YAML data...
-                if (source_element.data[prop.name]) {
-                    // ...convert it to a PropertyValue and store it in our map.
-                    property_map[prop.name] = YAML::node_to_property_value(source_element.data[prop.name], prop);
+            initial_element_data_map[element_copy.id] = YAML::Dump(element_copy.data);
+
+
+            // This populates the fossilized_element_data_map for direct value comparison.
+            const TypeInfo* type_info = ByteMirror::get_type_info_by_name(source_element.type_name);
+            if (type_info) {
+                std::map<std::string, PropertyValue> property_map;
+                // Iterate through all reflected properties for this element type
+                for (const auto& prop : ByteMirror::get_all_properties_for_type(type_info)) {
+                    // If the property exists in the YAML data...
+                    if (source_element.data[prop.name]) {
+                        // ...convert it to a PropertyValue and store it in our map.
+                        property_map[prop.name] = YAML::node_to_property_value(source_element.data[prop.name], prop);
+                    }
                 }
+                // Store the complete property map for this element in the snapshot
+                fossilized_element_data_map[element_copy.id] = property_map;
             }
-            // Store the complete property map for this element in the snapshot
-            snapshot.pimpl->fossilized_element_data_map[element_copy.id] = property_map;
-        }
 
             entity_copy.elements.push_back(std::move(element_copy));
         }
 
         // 3. Move the complete, deep-copied entity into the snapshot's map.
-        auto [it, inserted] = snapshot.pimpl->entity_archetype_map.emplace(entity_copy.id, std::move(entity_copy));
+        auto [it, inserted] = entity_archetype_map.emplace(entity_copy.id, std::move(entity_copy));
 
         if (inserted) {
             EntityArchetype& stored_entity = it->second;
 
             // 4. Populate the element pointer map for fast lookups.
             for (const ElementArchetype& stored_element : stored_entity.elements) {
-                snapshot.pimpl->element_archetype_map[stored_element.id] = &stored_element;
+                element_archetype_map[stored_element.id] = &stored_element;
             }
         }
     }
 
-    std::cout << "--- IMMUTABLE SNAPSHOT CREATION COMPLETE ---\n";
-    return snapshot;
-}
+    void RealmSnapshot::Pimpl::remove_entity(const SimpleGuid& entity_id) {
+        auto it = entity_archetype_map.find(entity_id);
+        if (it == entity_archetype_map.end()) return;
+        for (const ElementArchetype& element : it->second.elements) {
+            element_archetype_map.erase(element.id);
+            fossilized_element_data_map.erase(element.id);
+            initial_element_data_map.erase(element.id);
+        }
+        entity_archetype_map.erase(it);
+    }
+
+
+    // Create an immutable RealmSnapshot from a vector of EntityArchetypes
+    RealmSnapshot RealmSnapshot::load_from_entity_archetype_vector(const std::vector<EntityArchetype>& archetype_vector) {
+        RealmSnapshot snapshot;
+        std::cout << "\n--- CREATING IMMUTABLE REALM SNAPSHOT ---\n";
+
+        for (const auto& source_entity : archetype_vector) {
+            snapshot.pimpl->add_entity(source_entity);
+        }
+
+        std::cout << "--- IMMUTABLE SNAPSHOT CREATION COMPLETE ---\n";
+        return snapshot;
+    }
+
+    void RealmSnapshot::update_entities(const std::vector<const EntityArchetype*>& saved_entities,
+        const std::vector<SimpleGuid>& purged_entity_ids) {
+        for (const SimpleGuid& entity_id : purged_entity_ids) {
+            pimpl->remove_entity(entity_id);
+        }
+        for (const EntityArchetype* entity : saved_entities) {
+            pimpl->add_entity(*entity);
+        }
+    }
 
 
     bool RealmSnapshot::validate_snapshot(const std::vector<EntityArchetype>& source) const {
@@ -378,11 +409,8 @@ namespace Salix {
             
             // b. Convert the live YAML node to a PropertyValue for a direct, type-safe comparison.
             PropertyValue current_value;
-            for (const auto& prop : ByteMirror::get_all_properties_for_type(type_info)) {
-                if (prop.name == property_name) {
-                    current_value = YAML::node_to_property_value(live_value_node, prop);
-                    break;
-                }
+            if (const Property* prop = ByteMirror::find_property(type_info, property_name)) {
+                current_value = YAML::node_to_property_value(live_value_node, *prop);
             }
 
             // c. The Direct Comparison.
@@ -31,6 +31,11 @@ namespace Salix {
         // This is now a regular member function so it can access this snapshot's data.
         bool validate_snapshot(const std::vector<EntityArchetype>& source) const;
 
+        // Re-copies the given entities and drops the purged ones, so a save
+        // that only touched a few entities does not need a whole new snapshot.
+        void update_entities(const std::vector<const EntityArchetype*>& saved_entities,
+            const std::vector<SimpleGuid>& purged_entity_ids);
+
         // These are also regular member functions.
         const std::string& get_source_file_path() const;
         void set_source_file_path(const std::string& source_file_path);
@@ -11,8 +11,10 @@
 #include <Salix/core/InitContext.h>
 #include <Salix/reflection/EditorDataMode.h>
 #include <Salix/rendering/IRenderer.h>
+#include <Salix/rendering/DebugDrawList.h>
 #include <Salix/rendering/opengl/OpenGLRenderer.h>
 #include <Salix/ecs/Realm.h>
+#include <Salix/ecs/RealmView.h>
 #include <Salix/ecs/Entity.h>
 #include <Salix/ecs/Element.h>
 #include <Salix/ecs/Sprite2D.h>
@@ -76,6 +78,11 @@ namespace Salix {
         SimpleGuid selected_entity_id = SimpleGuid::invalid();
         Ray last_picking_ray;
         ImGuizmo::OPERATION CurrentGizmoOperation = ImGuizmo::TRANSLATE;
+        // Reused by draw_scene() so collecting sprites does not allocate every frame.
+        std::vector<RenderJob> render_queue;
+        // The grid is uploaded once and redrawn until the grid settings change.
+        uint32_t grid_mesh_id = 0;
+        GridSettings grid_mesh_settings;
 
         
         GLint render_pass_begin();
@@ -730,7 +737,7 @@ namespace Salix {
         pimpl->draw_test_cube(); // draw 3D first.
         pimpl->draw_scene(); // draw 2D (in game gui/HUD elements).
         pimpl->draw_bounding_boxes();
-        pimpl->context->renderer->draw_line(
+        pimpl->context->renderer->debug_line(
             pimpl->last_picking_ray.origin,
             pimpl->last_picking_ray.origin + pimpl->last_picking_ray.direction * 1000.0f, // A long line
             {1.0f, 1.0f, 0.0f, 1.0f} // Yellow
@@ -775,28 +782,20 @@ namespace Salix {
         if (!renderer || !active_realm) return;
 
         // --- STEP 1: COLLECT all visible sprites into a render queue ---
-        std::vector<RenderJob> render_queue;
-        for (Entity* entity : active_realm->get_entities()) {
-            if (!entity || entity->is_purged() || !entity->is_visible()) continue;
-            
-            Transform* transform = entity->get_transform();
-            if (!transform) continue;
-
-            std::vector<Element*> sprites = entity->get_elements_by_type_name("Sprite2D");
-            for (auto* element : sprites) {
-                Sprite2D* sprite = dynamic_cast<Sprite2D*>(element);
-                if (sprite && sprite->is_visible() && sprite->get_texture()) {
-                    render_queue.push_back({sprite, transform, sprite->get_sorting_layer()});
+        render_queue.clear();
+        active_realm->view<Transform, Sprite2D>().each([this](Entity& entity, Transform& transform, Sprite2D&) {
+            if (!entity.is_visible()) return;
+            // The view only picks the entities; each of them may carry several sprites.
+            entity.for_each_element<Sprite2D>([this, &transform](Sprite2D& sprite) {
+                if (sprite.is_visible() && sprite.get_texture()) {
+                    render_queue.push_back({&sprite, &transform, sprite.get_sorting_layer()});
                 }
-            }
-        }
-
-        // --- STEP 2: SORT the render queue by sorting_layer ---
-        std::sort(render_queue.begin(), render_queue.end(), [](const RenderJob& a, const RenderJob& b) {
-            return a.sorting_layer < b.sorting_layer;
+            });
         });
 
-        // --- STEP 3: RENDER the sorted queue ---
+        // --- STEP 2: RENDER the queue as one sprite batch ---
+        // The batch orders by sorting_layer (then texture) and draws instanced.
+        renderer->begin_sprite_batch();
         for (const auto& job : render_queue) {
             const Sprite2D* sprite = job.sprite;
             const Transform* transform = job.transform;
@@ -841,12 +840,14 @@ namespace Salix {
             glm::mat4 final_model_matrix = entity_model_matrix * local_sprite_matrix;
             
             // Make the clean draw call with the FINAL calculated matrix
-            renderer->draw_sprite(
+            renderer->submit_sprite(
                 sprite->get_texture(),
                 final_model_matrix,
-                sprite->color
+                sprite->color,
+                job.sorting_layer
             );
         }
+        renderer->end_sprite_batch();
     }
  
 
@@ -902,14 +903,11 @@ namespace Salix {
         if (!type_info) return;
 
         // 2. Apply the incoming property change to the live element.
-        for (const auto& prop : ByteMirror::get_all_properties_for_type(type_info)) {
-            if (prop.name == e.property_name) {
-                std::visit([&](auto&& arg) {
-                    auto value_copy = arg;
-                    prop.set_data(element_to_update, &value_copy);
-                }, e.new_value);
-                break;
-            }
+        if (const Property* prop = ByteMirror::find_property(type_info, e.property_name)) {
+            std::visit([&](auto&& arg) {
+                auto value_copy = arg;
+                prop->set_data(element_to_update, &value_copy);
+            }, e.new_value);
         }
         
         // 3. --- GENERIC RELOADER LOGIC ---
@@ -1231,7 +1229,7 @@ namespace Salix {
     }   
 
     void RealmDesignerPanel::Pimpl::draw_bounding_boxes() {
-        OpenGLRenderer* renderer = context->renderer->as_opengl_renderer();
+        IRenderer* renderer = context->renderer;
         if (!renderer) return;
         // Define a color for the bounding boxes
         Color box_color = {0.0f, 1.0f, 0.0f, 1.0f}; // Green
@@ -1241,24 +1239,21 @@ namespace Salix {
             active_realm = context->preview_realm.get();
         }
 
-        for (Entity* entity : active_realm->get_entities()) {
-            if (!entity || entity->is_purged()) continue;
-            Transform* transform = entity->get_transform(); 
-            BoxCollider* collider = entity->get_element<BoxCollider>(); 
+        if (!active_realm) return;
 
-            // Only draw boxes for entities that have a transform and a collider
-            if (transform && collider && collider->is_visible()) { 
-                // Get the base model matrix from the entity's transform
-                glm::mat4 model_matrix = transform->get_model_matrix();
+        // Only entities that have a transform and a collider are visited.
+        active_realm->view<Transform, BoxCollider>().each([renderer, &box_color](Entity&, Transform& transform, BoxCollider& collider) {
+            if (!collider.is_visible()) return;
+            // Get the base model matrix from the entity's transform
+            glm::mat4 model_matrix = transform.get_model_matrix();
 
-                // Get the size from the collider and scale the model matrix
-                glm::vec3 collider_size = collider->get_size().to_glm();
-                model_matrix = glm::scale(model_matrix, collider_size);
+            // Get the size from the collider and scale the model matrix
+            glm::vec3 collider_size = collider.get_size().to_glm();
+            model_matrix = glm::scale(model_matrix, collider_size);
 
-                // Draw the wireframe box
-                renderer->draw_wire_box(model_matrix, box_color);
-            }
-        }
+            // Draw the wireframe box
+            renderer->debug_wire_box(model_matrix, box_color);
+        });
     }
 
 
@@ -1271,65 +1266,19 @@ namespace Salix {
 
         IRenderer* renderer = context->renderer;
         const auto& grid = context->grid_settings;
-        
-        // Get camera information
-        Vector3 camera_pos = context->editor_camera->get_transform()->get_position();
-        float visible_range = context->editor_camera->get_far_plane(); // Assuming this is now available
-        
-        // Calculate grid bounds based on camera position and visible range
-        float min_x = std::floor((camera_pos.x - visible_range) / grid.major_division) * grid.major_division;
-        float max_x = std::ceil((camera_pos.x + visible_range) / grid.major_division) * grid.major_division;
-        float min_z = std::floor((camera_pos.z - visible_range) / grid.major_division) * grid.major_division;
-        float max_z = std::ceil((camera_pos.z + visible_range) / grid.major_division) * grid.major_division;
-        
-        // Clamp to grid size limits
-        min_x = std::max(min_x, -grid.size);
-        max_x = std::min(max_x, grid.size);
-        min_z = std::max(min_z, -grid.size);
-        max_z = std::min(max_z, grid.size);
-        
-        // Draw grid lines
-        for (float x = min_x; x <= max_x; x += grid.major_division) {
-            renderer->draw_line(
-                {x, 0, min_z}, 
-                {x, 0, max_z},
-                grid.color
-            );
-        }
-        
-        for (float z = min_z; z <= max_z; z += grid.major_division) {
-            renderer->draw_line(
-                {min_x, 0, z}, 
-                {max_x, 0, z},
-                grid.color
-            );
-        }
-        
-        // Draw minor grid lines if enabled
-        if (grid.minor_division > 0 && grid.minor_division < grid.major_division) {
-            Color minor_color = grid.color * 0.7f; // Slightly dimmer color for minor lines
-            
-            for (float x = min_x; x <= max_x; x += grid.minor_division) {
-                // Skip major division lines
-                if (std::fmod(x, grid.major_division) < 0.001f) continue;
-                
-                renderer->draw_line(
-                    {x, 0, min_z}, 
-                    {x, 0, max_z},
-                    minor_color
-                );
-            }
-            
-            for (float z = min_z; z <= max_z; z += grid.minor_division) {
-                // Skip major division lines
-                if (std::fmod(z, grid.major_division) < 0.001f) continue;
-                
-                renderer->draw_line(
-                    {min_x, 0, z}, 
-                    {max_x, 0, z},
-                    minor_color
-                );
+
+        // The grid only depends on its settings, so it is built once over its
+        // full extent and left to the GPU to clip.
+        if (grid_mesh_id == 0 || grid != grid_mesh_settings) {
+            if (grid_mesh_id != 0) {
+                renderer->delete_line_mesh(grid_mesh_id);
             }
+            DebugDrawList grid_lines;
+            Color minor_color = grid.color * 0.7f; // Slightly dimmer color for minor lines
+            grid_lines.add_grid(grid.size, grid.major_division, grid.minor_division, grid.color, minor_color);
+            grid_mesh_id = renderer->create_line_mesh(grid_lines);
+            grid_mesh_settings = grid;
         }
+        renderer->draw_line_mesh(grid_mesh_id);
     }
 }  // namespace Salix
\ No newline at end of file
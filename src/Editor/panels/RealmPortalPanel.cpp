@@ -270,12 +270,9 @@ struct RenderJob {
             }
         }
 
-        // --- STEP 2: SORT the render queue by sorting_layer ---
-        std::sort(render_queue.begin(), render_queue.end(), [](const RenderJob& a, const RenderJob& b) {
-            return a.sorting_layer < b.sorting_layer;
-        });
-
-        // --- STEP 3: RENDER the sorted queue ---
+        // --- STEP 2: RENDER the queue as one sprite batch ---
+        // The batch orders by sorting_layer (then texture) and draws instanced.
+        renderer->begin_sprite_batch();
         for (const auto& job : render_queue) {
             const Sprite2D* sprite = job.sprite;
             const Transform* transform = job.transform;
@@ -316,12 +313,14 @@ struct RenderJob {
             glm::mat4 final_model_matrix = entity_model_matrix * local_sprite_matrix;
 
             // Make the clean draw call with the FINAL calculated matrix
-            renderer->draw_sprite(
+            renderer->submit_sprite(
                 sprite->get_texture(),
                 final_model_matrix,
-                sprite->color
+                sprite->color,
+                job.sorting_layer
             );
         }
+        renderer->end_sprite_batch();
     }
 
     void RealmPortalPanel::on_event(IEvent& event) {
@@ -355,8 +354,8 @@ struct RenderJob {
                 // Safely cast the ICamera* to an Element* to access the get_owner() method.
                 Element* camera_as_element = dynamic_cast<Element*>(pimpl->game_camera);
 
-                // Now we can safely check if the owner is the entity being purged.
-                if (camera_as_element && e.entity == camera_as_element->get_owner()) {
+                // Now we can safely check if the owner is one of the entities being purged.
+                if (camera_as_element && e.contains(camera_as_element->get_owner())) {
                     // If it is, clear the pointer to prevent it from dangling.
                     pimpl->game_camera = nullptr;
                 }
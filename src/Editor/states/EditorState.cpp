@@ -30,6 +30,7 @@
 #include <Salix/management/ProjectManager.h>
 #include <Salix/management/Project.h>
 #include <Salix/management/RealmManager.h>
+#include <Editor/management/EditorRealmManager.h>
 #include <Editor/management/RealmLoader.h>
 #include <Editor/management/RealmSnapshot.h>
 // Editor-specific systems
@@ -94,6 +95,9 @@ namespace Salix {
         void draw_test_cube(); 
         void process_input();
         void draw_debug_window();
+        void on_realm_loaded();
+        void draw_realm_load_progress();
+        void save_realm(bool full_rewrite);
        
     };
 
@@ -285,13 +289,9 @@ namespace Salix {
                 std::filesystem::path path_to_realm = std::filesystem::absolute(project_directory_path / relative_path_to_realm);
                 
                 std::cout << "REALM TO LOAD: " << path_to_realm<< std::endl;
-                pimpl->editor_context->editor_realm_manager->load_realm_from_file(path_to_realm.string());
-
-                std::cout << "DEBUG: Load completed. Vector size: " 
-                        << pimpl->editor_context->editor_realm_manager->get_realm_size() << std::endl;
-
-                pimpl->editor_context->editor_realm_manager->validate_realm();
-                pimpl->editor_context->editor_realm_manager->print_hierarchy();
+                // Loads in the background; update() shows a progress bar and calls
+                // on_realm_loaded() once the archetypes are in.
+                pimpl->editor_context->editor_realm_manager->begin_loading_realm(path_to_realm.string());
             }
             else {
                 std::cerr << "EditorState::initialize - Invalid EditorDataMode detected!" << std::endl;
@@ -299,24 +299,9 @@ namespace Salix {
         }
          // Make the active_scene pointer refer to our preview_scene for the editor's lifetime.
         pimpl->editor_context->active_realm = pimpl->editor_context->preview_realm.get();
-        for (auto& entity : pimpl->editor_context->editor_realm_manager->get_realm()) {
-            for (auto& element : entity.elements){
-                if (element.type_name == "Camera" && element.data["active"].as<bool>() == true){
-                    SimpleGuid entity_camera_id = entity.id;
-                    pimpl->editor_context->active_realm->set_active_camera_entity(entity_camera_id);
-                    // This event notifies all panels (like RealmPortalPanel)
-                    // about the initial active camera that was just set from the YAML file.
-                    pimpl->editor_context->event_manager->dispatch(
-                        std::make_unique<OnMainCameraChangedEvent>(entity_camera_id)
-                    );
-                    
-
-                    break; // We found the one active camera, no need to keep searching
-                }
-                
-            }
+        if (!pimpl->editor_context->editor_realm_manager->is_loading_realm()) {
+            pimpl->on_realm_loaded();
         }
-        
     }
 
 
@@ -431,6 +416,10 @@ namespace Salix {
         if (pimpl->camera) {
             pimpl->camera->on_update(delta_time);
         }
+        EditorRealmManager* realm_manager = pimpl->editor_context->editor_realm_manager.get();
+        if (realm_manager && realm_manager->finish_loading_realm()) {
+            pimpl->on_realm_loaded();
+        }
 
         // ====================================================================
         // 2. MAIN UI UPDATE PHASE
@@ -453,6 +442,9 @@ namespace Salix {
         // Update Panels (This populates the deferred_commands queue)
         pimpl->draw_debug_window();
         pimpl->update_menu_bar_and_panels(); 
+        if (realm_manager && realm_manager->is_loading_realm()) {
+            pimpl->draw_realm_load_progress();
+        }
         if (pimpl->editor_context && pimpl->editor_context->gui) {
             pimpl->editor_context->gui->display_dialogs();
         }
@@ -498,11 +490,13 @@ namespace Salix {
             }
             pimpl->editor_context->realm_is_dirty = false;
         }
+    }
 
-        // e. Update the scene's scripts (if in game mode).
+    // The scene's scripts run here (in game mode), once per simulation step.
+    void EditorState::simulate(float step) {
         if (pimpl->editor_context->preview_realm) {
             if (pimpl->editor_context->init_context->engine_mode == EngineMode::Game) {
-                pimpl->editor_context->preview_realm->update(delta_time);
+                pimpl->editor_context->preview_realm->update(step);
             }
         }
     }
@@ -549,15 +543,14 @@ namespace Salix {
         if (event.get_event_type() == EventType::BeforeEntityPurged) {
             // Cast the event to access its data
             BeforeEntityPurgedEvent& e = static_cast<BeforeEntityPurgedEvent&>(event);
-            Entity* purged_entity = e.entity;
 
             // --- THE CRASH FIX ---
-            // Check our context's pointers and nullify them if they match the purged entity.
-            if (pimpl->editor_context->selected_entity == purged_entity) {
+            // Check our context's pointers and nullify them if they match a purged entity.
+            if (e.contains(pimpl->editor_context->selected_entity)) {
                 pimpl->editor_context->selected_entity = nullptr;
             }
 
-            if (pimpl->editor_context->main_camera && pimpl->editor_context->main_camera->get_owner() == purged_entity) {
+            if (pimpl->editor_context->main_camera && e.contains(pimpl->editor_context->main_camera->get_owner())) {
                 pimpl->editor_context->main_camera = nullptr;
             }
 
@@ -567,7 +560,7 @@ namespace Salix {
                 Camera* active_cam = dynamic_cast<Camera*>(
                     pimpl->editor_context->renderer->get_active_camera());
                 if (!active_cam) { return; }
-                if (active_cam && active_cam->get_owner() == purged_entity) {
+                if (active_cam && e.contains(active_cam->get_owner())) {
                     pimpl->editor_context->renderer->set_active_camera(nullptr);
                 }
             }
@@ -594,6 +587,53 @@ namespace Salix {
 
 
 
+    void EditorState::Pimpl::on_realm_loaded() {
+        std::cout << "DEBUG: Load completed. Vector size: "
+                << editor_context->editor_realm_manager->get_realm_size() << std::endl;
+
+        editor_context->editor_realm_manager->validate_realm();
+        editor_context->editor_realm_manager->print_hierarchy();
+
+        for (auto& entity : editor_context->editor_realm_manager->get_realm()) {
+            for (auto& element : entity.elements){
+                if (element.type_name == "Camera" && element.data["active"].as<bool>() == true){
+                    SimpleGuid entity_camera_id = entity.id;
+                    editor_context->active_realm->set_active_camera_entity(entity_camera_id);
+                    // This event notifies all panels (like RealmPortalPanel)
+                    // about the initial active camera that was just set from the YAML file.
+                    editor_context->event_manager->dispatch(
+                        std::make_unique<OnMainCameraChangedEvent>(entity_camera_id)
+                    );
+                    
+
+                    break; // We found the one active camera, no need to keep searching
+                }
+                
+            }
+        }
+    }
+
+
+
+    void EditorState::Pimpl::draw_realm_load_progress() {
+        EditorRealmManager* realm_manager = editor_context->editor_realm_manager.get();
+        const ImGuiIO& io = ImGui::GetIO();
+        ImGui::SetNextWindowPos(ImVec2(io.DisplaySize.x * 0.5f, io.DisplaySize.y * 0.5f), ImGuiCond_Always, ImVec2(0.5f, 0.5f));
+        ImGui::SetNextWindowSize(ImVec2(360.0f, 0.0f));
+        ImGui::Begin("Loading Realm", nullptr,
+            ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoDocking);
+        const size_t entity_total = realm_manager->get_realm_load_entity_total();
+        if (entity_total == 0) {
+            ImGui::Text("Parsing realm file...");
+        } else {
+            ImGui::Text("Building %zu entities...", entity_total);
+        }
+        ImGui::ProgressBar(realm_manager->get_realm_load_progress(), ImVec2(-1.0f, 0.0f));
+        ImGui::End();
+    }
+
+
+
     void EditorState::Pimpl::handle_first_frame_setup() {
         if (!is_first_frame) {
             return; // Only run this once
@@ -659,6 +699,9 @@ namespace Salix {
                 if (ImGui::MenuItem("New Project...")) { /* TODO */ }
                 if (ImGui::MenuItem("Open Project...")) { /* TODO */ }
                 ImGui::Separator();
+                if (ImGui::MenuItem("Save Realm", "Ctrl+S")) { save_realm(false); }
+                if (ImGui::MenuItem("Save Realm (Full Rewrite)")) { save_realm(true); }
+                ImGui::Separator();
                 if (ImGui::MenuItem("Exit")) { editor_context->init_context->engine->is_running(false);}
                 ImGui::EndMenu();
             }
@@ -810,7 +853,24 @@ namespace Salix {
 
     
     void EditorState::Pimpl::process_input() {
-        
+        IInputManager* input = editor_context->init_context->input_manager;
+        if (input && input->is_held_down(KeyCode::LeftControl) && input->is_down(KeyCode::S)) {
+            save_realm(false);
+        }
+    }
+
+    void EditorState::Pimpl::save_realm(bool full_rewrite) {
+        EditorRealmManager* realm_manager = editor_context->editor_realm_manager.get();
+        if (!realm_manager || realm_manager->is_loading_realm()) return;
+        const std::string& path = realm_manager->get_realm_file_path();
+        if (path.empty()) {
+            std::cerr << "[Editor] The realm has no file to save to." << std::endl;
+            return;
+        }
+        const bool saved = full_rewrite ? realm_manager->save_realm_full(path) : realm_manager->save_realm(path);
+        if (!saved) {
+            std::cerr << "[Editor] Failed to save realm: " << path << std::endl;
+        }
     }
 
     void EditorState::Pimpl::draw_debug_window() {
@@ -21,6 +21,7 @@ namespace Salix {
         void on_enter(const InitContext& new_context) override;
         void on_exit() override;
         void update(float delta_time) override;
+        void simulate(float step) override;
         void render(IRenderer* renderer_param) override;
         void on_event(IEvent& event) override;
     private:
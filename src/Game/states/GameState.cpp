@@ -118,9 +118,12 @@ namespace Salix {
         }
     }
 
-    void GameState::update(float delta_time) {
+    void GameState::update(float /*delta_time*/) {
+    }
+
+    void GameState::simulate(float step) {
         if (project_manager) {
-            project_manager->update(delta_time);
+            project_manager->update(step);
         }
     }
 
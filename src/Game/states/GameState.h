@@ -22,6 +22,7 @@ namespace Salix {
             void on_enter(const InitContext& new_context) override;
             void on_exit() override;
             void update(float delta_time) override;
+            void simulate(float step) override;
             void render(IRenderer* renderer) override;
         
         private:
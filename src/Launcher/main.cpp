@@ -15,6 +15,7 @@
 #include <Salix/states/IAppState.h>
 #include <Salix/core/ApplicationConfig.h>
 #include <Salix/management/SettingsManager.h>
+#include <Salix/ecs/Realm.h>
 #include <iostream>
 #include <memory>
 #define _CRTDBG_MAP_ALLOC
@@ -37,6 +38,30 @@ std::string get_arg_value(const std::vector<std::string>& args, const std::strin
 int main(int argc, char* argv[]) {
     std::vector<std::string> args(argv + 1, argv + argc);  // for parsing command line arguments
     std::cout << "SalixGameStudio.exe" << std::endl;
+
+    // Offline realm conversion: --convert-realm <source> <destination> [--realm-format json|binary]
+    // Converts and exits without starting the engine.
+    std::string convert_source = get_arg_value(args, "--convert-realm");
+    if (!convert_source.empty()) {
+        std::string convert_destination;
+        for (size_t i = 0; i + 2 < args.size(); ++i) {
+            if (args[i] == "--convert-realm") {
+                convert_destination = args[i + 2];
+            }
+        }
+        if (convert_destination.empty()) {
+            std::cerr << "Usage: --convert-realm <source> <destination> [--realm-format json|binary]" << std::endl;
+            return 1;
+        }
+        Salix::RealmFileFormat format = get_arg_value(args, "--realm-format") == "json"
+            ? Salix::RealmFileFormat::Json : Salix::RealmFileFormat::Binary;
+        if (!Salix::Realm::convert_file(convert_source, convert_destination, format)) {
+            std::cerr << "Fatal Error: Could not convert realm '" << convert_source << "'." << std::endl;
+            return 1;
+        }
+        std::cout << "Converted '" << convert_source << "' to '" << convert_destination << "'." << std::endl;
+        return 0;
+    }
  
     // Enable memory leak checks at shutdown
     _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
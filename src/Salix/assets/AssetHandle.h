@@ -0,0 +1,90 @@
+// =================================================================================
+// Filename:    Salix/assets/AssetHandle.h
+// Author:      SalixGameStudio
+// Description: Declares AssetHandle, a counted reference to an asset owned by
+//              the AssetManager. Assets with no handles left may be evicted.
+// =================================================================================
+#pragma once
+
+#include <Salix/core/Core.h>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace Salix {
+
+    // Forward declarations
+    class ITexture;
+
+    // Shared between the AssetManager's cache entry and every handle to it.
+    // It outlives the entry, so a handle released after its asset was dropped
+    // (for example after AssetManager::shutdown()) is still safe to destroy.
+    struct AssetRefCount {
+        std::atomic<uint32_t> handles{0};
+    };
+
+    // Copying a handle adds a reference; destroying or resetting it removes
+    // one. Handles are cheap to pass around, but the asset is only kept alive
+    // by the AssetManager, never by the handle itself: while any handle
+    // exists the manager will not evict it. A handle without a count refers
+    // to an asset that is never evicted (atlas regions, pinned textures).
+    template<typename T>
+    class AssetHandle {
+        public:
+            AssetHandle() = default;
+            AssetHandle(T* asset_ptr, std::shared_ptr<AssetRefCount> ref_count)
+                : asset(asset_ptr), refs(std::move(ref_count)) {
+                if (refs) refs->handles.fetch_add(1, std::memory_order_relaxed);
+            }
+            ~AssetHandle() { reset(); }
+
+            AssetHandle(const AssetHandle& other) : AssetHandle(other.asset, other.refs) {}
+            AssetHandle(AssetHandle&& other) noexcept
+                : asset(std::exchange(other.asset, nullptr)), refs(std::move(other.refs)) {}
+
+            AssetHandle& operator=(AssetHandle other) noexcept {
+                std::swap(asset, other.asset);
+                std::swap(refs, other.refs);
+                return *this;
+            }
+
+            void reset() {
+                if (refs) refs->handles.fetch_sub(1, std::memory_order_acq_rel);
+                refs.reset();
+                asset = nullptr;
+            }
+
+            T* get() const { return asset; }
+            T* operator->() const { return asset; }
+            explicit operator bool() const { return asset != nullptr; }
+
+            // Handles currently referring to the asset (0 for unmanaged ones).
+            uint32_t get_ref_count() const {
+                return refs ? refs->handles.load(std::memory_order_acquire) : 0;
+            }
+
+        private:
+            T* asset = nullptr;
+            std::shared_ptr<AssetRefCount> refs;
+    };
+
+    using TextureHandle = AssetHandle<ITexture>;
+
+    // Reported by AssetManager::get_texture_cache_stats().
+    struct AssetCacheStats {
+        size_t resident_bytes = 0;      // Estimated GPU memory held by cached textures.
+        size_t resident_count = 0;
+        size_t budget_bytes = 0;
+        uint64_t hits = 0;              // Lookups served from the cache (or the atlas).
+        uint64_t misses = 0;            // Lookups that had to load.
+        uint64_t evictions = 0;
+        size_t evicted_bytes = 0;
+
+        double get_hit_rate() const {
+            const uint64_t lookups = hits + misses;
+            return lookups ? static_cast<double>(hits) / static_cast<double>(lookups) : 0.0;
+        }
+    };
+
+} // namespace Salix
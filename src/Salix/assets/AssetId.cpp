@@ -0,0 +1,63 @@
+// =================================================================================
+// Filename:    Salix/assets/AssetId.cpp
+// Author:      SalixGameStudio
+// Description: Implements AssetId hashing and the process-wide intern table.
+// =================================================================================
+#include <Salix/assets/AssetId.h>
+#include <filesystem>
+#include <iostream>
+#include <mutex>
+#include <unordered_map>
+
+namespace Salix {
+
+    namespace {
+        // Entries are never removed, so references into 'paths' stay valid.
+        struct AssetIdTable {
+            std::mutex mutex;
+            std::unordered_map<uint64_t, std::string> paths;
+        };
+
+        AssetIdTable& get_asset_id_table() {
+            static AssetIdTable table;
+            return table;
+        }
+
+        uint64_t hash_path(const std::string& path) {
+            uint64_t hash = 14695981039346656037ull;   // FNV-1a
+            for (unsigned char c : path) {
+                hash ^= c;
+                hash *= 1099511628211ull;
+            }
+            return hash != 0 ? hash : 1;   // 0 is the invalid id.
+        }
+    }
+
+
+    AssetId AssetId::from_path(const std::string& asset_path) {
+        if (asset_path.empty()) return AssetId();
+
+        const std::string normalized = std::filesystem::path(asset_path).lexically_normal().generic_string();
+        const uint64_t value = hash_path(normalized);
+
+        AssetIdTable& table = get_asset_id_table();
+        std::lock_guard<std::mutex> lock(table.mutex);
+        auto inserted = table.paths.emplace(value, normalized);
+        if (!inserted.second && inserted.first->second != normalized) {
+            std::cerr << "AssetId: Hash collision between '" << inserted.first->second
+                      << "' and '" << normalized << "'" << std::endl;
+        }
+        return AssetId(value);
+    }
+
+    const std::string& AssetId::get_path() const {
+        static const std::string empty;
+        if (!is_valid()) return empty;
+
+        AssetIdTable& table = get_asset_id_table();
+        std::lock_guard<std::mutex> lock(table.mutex);
+        auto found = table.paths.find(value);
+        return found != table.paths.end() ? found->second : empty;
+    }
+
+} // namespace Salix
@@ -0,0 +1,45 @@
+// =================================================================================
+// Filename:    Salix/assets/AssetId.h
+// Author:      SalixGameStudio
+// Description: Declares AssetId, a 64-bit interned key for a project-relative
+//              asset path.
+// =================================================================================
+#pragma once
+
+#include <Salix/core/Core.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Salix {
+
+    // The FNV-1a hash of the normalised path ("a/../b\\c.png" and "b/c.png" are
+    // the same asset). Normalising and hashing happen once in from_path();
+    // afterwards comparing and looking up an id is integer work. Every id made
+    // by from_path() is interned, so get_path() can turn it back into the path.
+    class SALIX_API AssetId {
+        public:
+            AssetId() = default;
+
+            static AssetId from_path(const std::string& asset_path);
+
+            bool is_valid() const { return value != 0; }
+            uint64_t get_value() const { return value; }
+
+            // The normalised path this id was made from ("" for an invalid id).
+            const std::string& get_path() const;
+
+            bool operator==(const AssetId& other) const { return value == other.value; }
+            bool operator!=(const AssetId& other) const { return value != other.value; }
+            bool operator<(const AssetId& other) const { return value < other.value; }
+
+        private:
+            explicit AssetId(uint64_t id_value) : value(id_value) {}
+            uint64_t value = 0;
+    };
+
+    struct AssetIdHash {
+        size_t operator()(const AssetId& id) const { return static_cast<size_t>(id.get_value()); }
+    };
+
+} // namespace Salix
@@ -1,54 +1,514 @@
 // Salix/assets/AssetManager.cpp
 
 #include <Salix/assets/AssetManager.h>
+#include <Salix/assets/AssetHandle.h>
+#include <Salix/assets/TextureAtlas.h>
+#include <Salix/assets/TextureCache.h>
+#include <Salix/core/JobSystem.h>
 #include <Salix/rendering/IRenderer.h>
 #include <Salix/rendering/ITexture.h>
+#include <algorithm>
+#include <atomic>
 #include <filesystem>
 #include <iostream>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace Salix {
     extern std::filesystem::path g_project_root_path;
 
+    namespace {
+        // Handed out by request_texture(). Draws as the placeholder until the
+        // decoded image has been uploaded, then as the real texture.
+        class StreamedTexture : public ITexture {
+            public:
+                explicit StreamedTexture(ITexture* placeholder_texture) : placeholder(placeholder_texture) {}
+
+                int get_width() const override { return current()->get_width(); }
+                int get_height() const override { return current()->get_height(); }
+                ImTextureID get_imgui_texture_id() const override { return current()->get_imgui_texture_id(); }
+                ITexture* resolve() override { return current(); }
+                bool is_ready() const override { return loaded != nullptr; }
+
+                void set_loaded(ITexture* texture) { loaded.reset(texture); }
+
+            private:
+                ITexture* current() const { return loaded ? loaded.get() : placeholder; }
+
+                ITexture* placeholder;
+                std::unique_ptr<ITexture> loaded;
+        };
+
+        // One cached texture and its book-keeping.
+        struct TextureEntry {
+            std::unique_ptr<ITexture> texture;
+            std::shared_ptr<AssetRefCount> refs = std::make_shared<AssetRefCount>();
+            size_t bytes = 0;           // Estimated GPU memory.
+            uint64_t last_used = 0;     // Pimpl::use_clock at the last lookup.
+            bool pinned = false;        // Handed out raw by get_texture(); never evicted.
+            std::vector<AssetId> ids;   // Every id indexed to this entry.
+        };
+
+        // Without better information a texture is counted as RGBA8, no mips.
+        size_t estimate_bytes(const ITexture& texture) {
+            return static_cast<size_t>(texture.get_width()) * static_cast<size_t>(texture.get_height()) * 4;
+        }
+
+        // An image a worker has loaded, waiting for its GPU upload.
+        struct DecodedImage {
+            TextureEntry* entry = nullptr;      // Not evicted while its upload is pending.
+            StreamedTexture* target = nullptr;
+            std::string path;
+            std::unique_ptr<CookedTexture> texture;   // nullptr if loading failed.
+
+            size_t byte_size() const {
+                return texture ? texture->get_data_size() : 0;
+            }
+        };
+
+        // Two workers keep decoding off the frame's critical path without
+        // competing with the per-frame JobSystem for every core.
+        constexpr unsigned int DECODE_WORKERS = 2;
+
+        // A 2x2 magenta/black checker, the conventional "not loaded yet" look.
+        constexpr unsigned char PLACEHOLDER_PIXELS[] = {
+            255, 0, 255, 255,    0, 0, 0, 255,
+            0, 0, 0, 255,    255, 0, 255, 255
+        };
+    }
+
     // Define the implementation struct here, inside the .cpp file.
     struct AssetManager::Pimpl {
         IRenderer* renderer;
-        std::map<std::string, std::unique_ptr<ITexture>> texture_cache;
+        std::map<std::string, std::unique_ptr<TextureEntry>> texture_cache;
+        TextureAtlas atlas;     // Checked before texture_cache.
+
+        // Id indexes over texture_cache and the atlas, filled on first lookup.
+        // They are only valid for the project root they were built under.
+        std::unordered_map<AssetId, TextureEntry*, AssetIdHash> entries_by_id;
+        std::unordered_map<AssetId, ITexture*, AssetIdHash> regions_by_id;
+        std::filesystem::path indexed_root;
+
+        // --- Memory accounting ---
+        size_t memory_budget = DEFAULT_TEXTURE_MEMORY_BUDGET;
+        size_t resident_bytes = 0;
+        uint64_t use_clock = 0;
+        AssetCacheStats stats;
+
+        // --- Streaming (only set up when the renderer can upload from memory) ---
+        std::unique_ptr<ITexture> placeholder;
+        std::unique_ptr<JobSystem> decode_jobs;
+        JobGroup decode_group;
+        std::mutex decoded_mutex;
+        std::vector<DecodedImage> decoded;      // Filled by workers, drained on the render thread.
+        std::atomic<bool> cancelled{false};
+        size_t pending_count = 0;               // Requested but not yet uploaded.
+        size_t upload_budget = DEFAULT_TEXTURE_UPLOAD_BUDGET;
+
+        // Cooked texture cache. Empty means "<project root>/.cache/textures".
+        std::string cooked_directory;
+        bool cooked_cache_enabled = true;
+
+        std::string get_cooked_directory() const {
+            if (!cooked_cache_enabled) return {};
+            if (!cooked_directory.empty()) return cooked_directory;
+            if (Salix::g_project_root_path.empty()) return {};
+            return (Salix::g_project_root_path / ".cache" / "textures").lexically_normal().string();
+        }
+
+        std::string to_absolute_path(const std::string& relative_path) const {
+            // 1. Combine the project root with the relative path to get the true absolute path.
+            std::filesystem::path absolute_path = Salix::g_project_root_path / relative_path;
+            return absolute_path.lexically_normal().string();
+        }
+
+        struct Lookup {
+            ITexture* region = nullptr;
+            TextureEntry* entry = nullptr;
+            std::string absolute_path;  // Only filled in when both probes missed.
+        };
+
+        // The hot path is two integer probes. Only an id seen for the first
+        // time pays for building and normalising the absolute path.
+        Lookup lookup(AssetId id) {
+            Lookup result;
+            if (!id.is_valid()) return result;
+
+            if (Salix::g_project_root_path.native() != indexed_root.native()) {
+                entries_by_id.clear();
+                regions_by_id.clear();
+                indexed_root = Salix::g_project_root_path;
+            }
+
+            auto region_it = regions_by_id.find(id);
+            if (region_it != regions_by_id.end()) {
+                ++stats.hits;
+                result.region = region_it->second;
+                return result;
+            }
+            auto entry_it = entries_by_id.find(id);
+            if (entry_it != entries_by_id.end()) {
+                ++stats.hits;
+                entry_it->second->last_used = ++use_clock;
+                result.entry = entry_it->second;
+                return result;
+            }
+
+            result.absolute_path = to_absolute_path(id.get_path());
+            if (ITexture* region = atlas.find(result.absolute_path)) {
+                ++stats.hits;
+                regions_by_id[id] = region;
+                result.region = region;
+                return result;
+            }
+            auto cached = texture_cache.find(result.absolute_path);
+            if (cached != texture_cache.end()) {
+                ++stats.hits;
+                TextureEntry* entry = cached->second.get();
+                entry->last_used = ++use_clock;
+                entry->ids.push_back(id);
+                entries_by_id[id] = entry;
+                result.entry = entry;
+            }
+            return result;
+        }
+
+        TextureEntry* insert_entry(AssetId id, const std::string& absolute_path, ITexture* texture, size_t bytes) {
+            auto entry = std::make_unique<TextureEntry>();
+            entry->texture.reset(texture);
+            entry->bytes = bytes;
+            entry->last_used = ++use_clock;
+            entry->ids.push_back(id);
+            resident_bytes += bytes;
+            ++stats.misses;
+            TextureEntry* raw = entry.get();
+            texture_cache[absolute_path] = std::move(entry);
+            entries_by_id[id] = raw;
+            return raw;
+        }
+
+        // Loads on the calling thread. Renderers that can upload from memory
+        // go through the cooked cache.
+        TextureEntry* load_entry(AssetId id, const std::string& absolute_path) {
+            ITexture* texture = nullptr;
+            size_t bytes = 0;
+            if (decode_jobs) {
+                if (std::unique_ptr<CookedTexture> cooked = TextureCache(get_cooked_directory()).load(absolute_path)) {
+                    texture = create_from_cooked(*cooked);
+                    bytes = cooked->get_data_size();
+                }
+            } else {
+                texture = renderer->load_texture(absolute_path.c_str());
+                if (texture) bytes = estimate_bytes(*texture);
+            }
+            return texture ? insert_entry(id, absolute_path, texture, bytes) : nullptr;
+        }
+
+        // Drops unreferenced textures, least recently used first, until the
+        // cache fits the budget. Pinned and still-streaming entries stay.
+        size_t evict_to_budget() {
+            if (resident_bytes <= memory_budget) return 0;
+
+            std::vector<std::map<std::string, std::unique_ptr<TextureEntry>>::iterator> candidates;
+            for (auto it = texture_cache.begin(); it != texture_cache.end(); ++it) {
+                const TextureEntry& entry = *it->second;
+                if (!entry.pinned && entry.texture->is_ready() &&
+                    entry.refs->handles.load(std::memory_order_acquire) == 0) {
+                    candidates.push_back(it);
+                }
+            }
+            std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) {
+                return a->second->last_used < b->second->last_used;
+            });
+
+            size_t evicted = 0;
+            for (auto& it : candidates) {
+                if (resident_bytes <= memory_budget) break;
+                for (AssetId id : it->second->ids) {
+                    entries_by_id.erase(id);
+                }
+                resident_bytes -= it->second->bytes;
+                stats.evicted_bytes += it->second->bytes;
+                ++stats.evictions;
+                ++evicted;
+                texture_cache.erase(it);
+            }
+            return evicted;
+        }
+
+        ITexture* create_from_cooked(const CookedTexture& cooked) {
+            std::vector<const unsigned char*> levels(static_cast<size_t>(cooked.get_mip_count()));
+            for (int level = 0; level < cooked.get_mip_count(); ++level) {
+                levels[static_cast<size_t>(level)] = cooked.get_mip_data(level);
+            }
+            ITexture* texture = renderer->create_texture_with_mips(levels.data(), cooked.get_mip_count(),
+                                                                   cooked.get_width(), cooked.get_height());
+            if (!texture) {
+                texture = renderer->create_texture(cooked.get_mip_data(0), cooked.get_width(), cooked.get_height(), 4);
+            }
+            return texture;
+        }
+
+        void upload(DecodedImage& image) {
+            ITexture* texture = nullptr;
+            size_t bytes = 0;
+            if (image.texture) {
+                texture = create_from_cooked(*image.texture);
+                bytes = image.texture->get_data_size();
+                image.texture.reset();   // Unmaps the cache file.
+            }
+            if (texture) {
+                image.target->set_loaded(texture);
+                resident_bytes = resident_bytes - image.entry->bytes + bytes;
+                image.entry->bytes = bytes;
+            } else {
+                // The sprite keeps drawing the placeholder, which makes the miss visible.
+                std::cerr << "ERROR: Failed to stream texture: " << image.path << std::endl;
+            }
+            --pending_count;
+        }
+
+        void stop_streaming() {
+            if (!decode_jobs) return;
+            cancelled.store(true, std::memory_order_release);
+            decode_jobs->wait(decode_group);
+            decoded.clear();
+            pending_count = 0;
+            decode_jobs.reset();
+        }
     };
 
     AssetManager::AssetManager() : pimpl(std::make_unique<Pimpl>()) {
         pimpl->renderer = nullptr;
     }
 
-    AssetManager::~AssetManager() = default;
+    AssetManager::~AssetManager() {
+        pimpl->stop_streaming();
+    }
 
     void AssetManager::initialize(IRenderer* renderer_ptr) {
         pimpl->renderer = renderer_ptr;
+        pimpl->cancelled.store(false, std::memory_order_release);
+        if (!pimpl->renderer) return;
+
+        pimpl->placeholder.reset(pimpl->renderer->create_texture(PLACEHOLDER_PIXELS, 2, 2, 4));
+        if (pimpl->placeholder) {
+            pimpl->decode_jobs = std::make_unique<JobSystem>(DECODE_WORKERS);
+        }
     }
 
     void AssetManager::shutdown() {
+        pimpl->stop_streaming();
+        pimpl->entries_by_id.clear();
+        pimpl->regions_by_id.clear();
         pimpl->texture_cache.clear();
+        pimpl->resident_bytes = 0;
+        pimpl->atlas.clear();
+        pimpl->placeholder.reset();
     }
 
     ITexture* AssetManager::get_texture(const std::string& file_path) {
-        std::string relative_path = file_path;
-        // 1. Combine the project root with the relative path to get the true absolute path.
-        std::filesystem::path absolute_path = Salix::g_project_root_path / relative_path;
-        std::string absolute_path_str = absolute_path.lexically_normal().string();
+        return get_texture(AssetId::from_path(file_path));
+    }
 
-        // 2. Use the FULL, ABSOLUTE path as the key for your cache. This is more robust.
-        auto cache_iterator = pimpl->texture_cache.find(absolute_path_str);
-        if (cache_iterator != pimpl->texture_cache.end()) {
-            return cache_iterator->second.get();
+    ITexture* AssetManager::get_texture(AssetId id) {
+        // 1. Probe the id indexes; the absolute path is only built on a miss.
+        Pimpl::Lookup found = pimpl->lookup(id);
+        if (found.region) {
+            return found.region;
         }
 
-        // 3. Ask the renderer to load from the ABSOLUTE path.
-        ITexture* new_texture = pimpl->renderer->load_texture(absolute_path_str.c_str());
+        // 2. Ask the renderer to load from the ABSOLUTE path.
+        TextureEntry* entry = found.entry;
+        if (!entry && !found.absolute_path.empty()) {
+            entry = pimpl->load_entry(id, found.absolute_path);
+        }
 
-        if (new_texture) {
-            // 4. Cache the new texture using its absolute path.
-            pimpl->texture_cache[absolute_path_str] = std::unique_ptr<ITexture>(new_texture);
-            return new_texture;
+        if (entry) {
+            // 3. Nobody holds a handle for a raw pointer, so it must never be evicted.
+            entry->pinned = true;
+            return entry->texture.get();
         }
         return nullptr;
     }
-} // namespace Salix
\ No newline at end of file
+
+
+    TextureHandle AssetManager::acquire_texture(const std::string& file_path) {
+        return acquire_texture(AssetId::from_path(file_path));
+    }
+
+    TextureHandle AssetManager::acquire_texture(AssetId id) {
+        Pimpl::Lookup found = pimpl->lookup(id);
+        if (found.region) {
+            return TextureHandle(found.region, nullptr);
+        }
+
+        TextureEntry* entry = found.entry;
+        if (!entry && !found.absolute_path.empty()) {
+            entry = pimpl->load_entry(id, found.absolute_path);
+        }
+        return entry ? TextureHandle(entry->texture.get(), entry->refs) : TextureHandle();
+    }
+
+
+    TextureHandle AssetManager::request_texture(const std::string& file_path) {
+        return request_texture(AssetId::from_path(file_path));
+    }
+
+    TextureHandle AssetManager::request_texture(AssetId id) {
+        if (!pimpl->decode_jobs) {
+            return acquire_texture(id);
+        }
+
+        Pimpl::Lookup found = pimpl->lookup(id);
+        if (found.region) {
+            return TextureHandle(found.region, nullptr);
+        }
+        if (found.entry) {
+            return TextureHandle(found.entry->texture.get(), found.entry->refs);
+        }
+        if (found.absolute_path.empty()) {
+            return TextureHandle();
+        }
+        std::string absolute_path_str = std::move(found.absolute_path);
+
+        auto streamed = std::make_unique<StreamedTexture>(pimpl->placeholder.get());
+        StreamedTexture* target = streamed.get();
+        TextureEntry* entry = pimpl->insert_entry(id, absolute_path_str, streamed.release(), 0);
+        ++pimpl->pending_count;
+
+        Pimpl* state = pimpl.get();
+        pimpl->decode_jobs->submit(pimpl->decode_group,
+            [state, entry, target, path = std::move(absolute_path_str), cache_directory = pimpl->get_cooked_directory()]() {
+            DecodedImage image;
+            image.entry = entry;
+            image.target = target;
+            image.path = path;
+            if (!state->cancelled.load(std::memory_order_acquire)) {
+                image.texture = TextureCache(cache_directory).load(path);
+            }
+            std::lock_guard<std::mutex> lock(state->decoded_mutex);
+            state->decoded.push_back(std::move(image));
+        });
+        return TextureHandle(target, entry->refs);
+    }
+
+
+    size_t AssetManager::process_texture_uploads() {
+        // Once a frame is also when textures released last frame get evicted.
+        pimpl->evict_to_budget();
+        if (!pimpl->decode_jobs || pimpl->pending_count == 0) return 0;
+
+        std::vector<DecodedImage> ready;
+        {
+            std::lock_guard<std::mutex> lock(pimpl->decoded_mutex);
+            if (pimpl->decoded.empty()) return 0;
+            ready.swap(pimpl->decoded);
+        }
+
+        size_t uploaded = 0;
+        size_t spent = 0;
+        size_t i = 0;
+        for (; i < ready.size(); ++i) {
+            if (uploaded > 0 && spent + ready[i].byte_size() > pimpl->upload_budget) break;
+            spent += ready[i].byte_size();
+            pimpl->upload(ready[i]);
+            ++uploaded;
+        }
+
+        // Over budget: the rest waits for the next frame, ahead of anything newer.
+        if (i < ready.size()) {
+            std::lock_guard<std::mutex> lock(pimpl->decoded_mutex);
+            pimpl->decoded.insert(pimpl->decoded.begin(),
+                std::make_move_iterator(ready.begin() + static_cast<std::ptrdiff_t>(i)),
+                std::make_move_iterator(ready.end()));
+        }
+        return uploaded;
+    }
+
+    void AssetManager::set_texture_upload_budget(size_t bytes_per_frame) {
+        pimpl->upload_budget = bytes_per_frame;
+    }
+
+    size_t AssetManager::get_texture_upload_budget() const {
+        return pimpl->upload_budget;
+    }
+
+    size_t AssetManager::get_pending_texture_count() const {
+        return pimpl->pending_count;
+    }
+
+    void AssetManager::set_texture_memory_budget(size_t bytes) {
+        pimpl->memory_budget = bytes;
+    }
+
+    size_t AssetManager::get_texture_memory_budget() const {
+        return pimpl->memory_budget;
+    }
+
+    size_t AssetManager::trim_textures() {
+        return pimpl->evict_to_budget();
+    }
+
+    AssetCacheStats AssetManager::get_texture_cache_stats() const {
+        AssetCacheStats stats = pimpl->stats;
+        stats.resident_bytes = pimpl->resident_bytes;
+        stats.resident_count = pimpl->texture_cache.size();
+        stats.budget_bytes = pimpl->memory_budget;
+        return stats;
+    }
+
+    void AssetManager::reset_texture_cache_stats() {
+        pimpl->stats = AssetCacheStats{};
+    }
+
+    void AssetManager::set_texture_cache_directory(const std::string& directory) {
+        pimpl->cooked_directory = directory;
+    }
+
+    std::string AssetManager::get_texture_cache_directory() const {
+        return pimpl->get_cooked_directory();
+    }
+
+    void AssetManager::set_texture_cache_enabled(bool enabled) {
+        pimpl->cooked_cache_enabled = enabled;
+    }
+
+    size_t AssetManager::build_texture_atlas(const std::vector<std::string>& image_paths) {
+        pimpl->regions_by_id.clear();
+        pimpl->atlas.clear();
+        if (!pimpl->renderer || !pimpl->placeholder) {
+            return 0;   // The renderer cannot build textures from memory.
+        }
+
+        // Keyed exactly like the texture cache, so lookups by relative path find them.
+        std::vector<std::string> absolute_paths;
+        absolute_paths.reserve(image_paths.size());
+        for (const std::string& path : image_paths) {
+            if (!path.empty()) absolute_paths.push_back(pimpl->to_absolute_path(path));
+        }
+        // Stable page layout between runs, and each image packed once.
+        std::sort(absolute_paths.begin(), absolute_paths.end());
+        absolute_paths.erase(std::unique(absolute_paths.begin(), absolute_paths.end()), absolute_paths.end());
+        return pimpl->atlas.build(*pimpl->renderer, absolute_paths, pimpl->get_cooked_directory());
+    }
+
+    const TextureAtlas& AssetManager::get_texture_atlas() const {
+        return pimpl->atlas;
+    }
+
+    bool AssetManager::is_in_texture_atlas(const std::string& image_path) const {
+        if (image_path.empty()) return false;
+        return pimpl->atlas.find(pimpl->to_absolute_path(image_path)) != nullptr;
+    }
+
+    void AssetManager::finish_texture_requests() {
+        if (!pimpl->decode_jobs) return;
+        pimpl->decode_jobs->wait(pimpl->decode_group);
+        const size_t budget = pimpl->upload_budget;
+        pimpl->upload_budget = static_cast<size_t>(-1);
+        process_texture_uploads();
+        pimpl->upload_budget = budget;
+    }
+} // namespace Salix
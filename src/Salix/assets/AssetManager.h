@@ -2,15 +2,20 @@
 #pragma once
 
 #include <Salix/core/Core.h>
+#include <Salix/assets/AssetHandle.h>
+#include <Salix/assets/AssetId.h>
+#include <cstddef>
 #include <string>
 #include <memory>
 #include <map>
+#include <vector>
 
 namespace Salix {
 
     // Forward declarations
     class IRenderer;
     class ITexture;
+    class TextureAtlas;
 
     class SALIX_API AssetManager {
         public:
@@ -22,11 +27,81 @@ namespace Salix {
             void shutdown();
 
             // The main function to load a texture, this will call the IRenderer load_texture method.
+            // The texture is pinned: a raw pointer carries no reference, so it
+            // stays resident until shutdown(). Prefer acquire_texture().
             ITexture* get_texture(const std::string& file_path);
+            // The id overloads skip path handling on a cache hit: build the id
+            // once (AssetId::from_path) and keep it.
+            ITexture* get_texture(AssetId id);
+
+            // Same synchronous load, but the texture only stays resident while
+            // handles to it exist (see the memory budget below).
+            TextureHandle acquire_texture(const std::string& file_path);
+            TextureHandle acquire_texture(AssetId id);
+
+            // --- Asynchronous texture loading ---
+            // Returns at once. The image is decoded on a worker thread and uploaded
+            // later by process_texture_uploads(); until then the returned texture
+            // draws as a placeholder (see ITexture::resolve()) and reports the
+            // placeholder's size. The handle stays valid once the real texture
+            // lands. Renderers that cannot create textures from memory get the
+            // synchronous acquire_texture() behaviour instead.
+            TextureHandle request_texture(const std::string& file_path);
+            TextureHandle request_texture(AssetId id);
+
+            // Render thread, once per frame: evicts textures over the memory
+            // budget, then uploads decoded images until the upload budget is
+            // spent (always at least one, so large images cannot stall the
+            // queue). Returns the number of textures uploaded.
+            size_t process_texture_uploads();
+            void set_texture_upload_budget(size_t bytes_per_frame);
+            size_t get_texture_upload_budget() const;
+            static constexpr size_t DEFAULT_TEXTURE_UPLOAD_BUDGET = 8 * 1024 * 1024;
+
+            // Requested textures that have not been uploaded yet.
+            size_t get_pending_texture_count() const;
+            // Waits for every outstanding request and uploads it, ignoring the
+            // budget (loading screens, tests).
+            void finish_texture_requests();
+
+            // --- Memory budget ---
+            // Textures nobody holds a handle to are evicted, least recently
+            // used first, once the cache's estimated GPU memory exceeds the
+            // budget. Pinned textures and atlas pages are never evicted.
+            static constexpr size_t DEFAULT_TEXTURE_MEMORY_BUDGET = 512ull * 1024 * 1024;
+            void set_texture_memory_budget(size_t bytes);
+            size_t get_texture_memory_budget() const;
+            // Evicts right away instead of at the next process_texture_uploads().
+            // Returns the number of textures evicted.
+            size_t trim_textures();
+            AssetCacheStats get_texture_cache_stats() const;
+            void reset_texture_cache_stats();
+
+            // --- Cooked texture cache ---
+            // Streamed and memory-uploaded textures are cooked once (RGBA8 plus
+            // a full mip chain) and mapped from the cache on later runs, skipping
+            // the image decode. Defaults to "<project root>/.cache/textures";
+            // entries are rebuilt when their source file changes.
+            void set_texture_cache_directory(const std::string& directory);
+            std::string get_texture_cache_directory() const;
+            void set_texture_cache_enabled(bool enabled);
+
+            // --- Texture atlas ---
+            // Packs the given images (project-relative paths, as sprites store
+            // them) into shared atlas pages, reading them through the cooked
+            // texture cache. Afterwards get_texture()/request_texture() return
+            // an atlas region for those paths, so sprites drawn from them share
+            // one texture bind. Needs a renderer that can upload from memory;
+            // returns the number of images packed. Building again replaces the
+            // previous atlas, so regions handed out before must not be in use.
+            size_t build_texture_atlas(const std::vector<std::string>& image_paths);
+            const TextureAtlas& get_texture_atlas() const;
+            // Whether the current atlas has a region for this image path.
+            bool is_in_texture_atlas(const std::string& image_path) const;
 
         private:
             struct Pimpl;
             std::unique_ptr<Pimpl> pimpl;
             
     };
-} // namespace Salix
\ No newline at end of file
+} // namespace Salix
@@ -0,0 +1,211 @@
+// =================================================================================
+// Filename:    Salix/assets/TextureAtlas.cpp
+// Author:      SalixGameStudio
+// Description: Implements atlas packing, page composition and region lookup.
+// =================================================================================
+#include <Salix/assets/TextureAtlas.h>
+#include <Salix/assets/TextureCache.h>
+#include <Salix/core/JobSystem.h>
+#include <Salix/rendering/IRenderer.h>
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <numeric>
+#include <unordered_map>
+
+namespace Salix {
+
+    namespace {
+        struct DecodedAtlasImage {
+            std::unique_ptr<CookedTexture> cooked;
+            const unsigned char* pixels = nullptr;  // RGBA8, the cooked texture's top mip.
+            int width = 0;
+            int height = 0;
+        };
+
+        int next_power_of_two(int value) {
+            int result = 1;
+            while (result < value) result *= 2;
+            return result;
+        }
+
+        // Copies the image into the page and repeats its edge pixels out into
+        // the padding around it.
+        void blit_with_border(const DecodedAtlasImage& image, const AtlasPlacement& placement, int padding,
+                              unsigned char* page, int page_width, int page_height) {
+            for (int y = -padding; y < image.height + padding; ++y) {
+                const int dst_y = placement.y + y;
+                if (dst_y < 0 || dst_y >= page_height) continue;
+                const int src_y = std::clamp(y, 0, image.height - 1);
+                for (int x = -padding; x < image.width + padding; ++x) {
+                    const int dst_x = placement.x + x;
+                    if (dst_x < 0 || dst_x >= page_width) continue;
+                    const int src_x = std::clamp(x, 0, image.width - 1);
+                    std::memcpy(page + (static_cast<size_t>(dst_y) * page_width + dst_x) * 4,
+                                image.pixels + (static_cast<size_t>(src_y) * image.width + src_x) * 4, 4);
+                }
+            }
+        }
+    }
+
+
+    AtlasRegion::AtlasRegion(ITexture* page_texture, const glm::vec4& region_uv_rect, int region_width, int region_height)
+        : page(page_texture), uv_rect(region_uv_rect), width(region_width), height(region_height) {}
+
+
+    struct TextureAtlas::Pimpl {
+        std::vector<std::unique_ptr<ITexture>> pages;
+        std::vector<std::unique_ptr<AtlasRegion>> regions;
+        std::unordered_map<std::string, AtlasRegion*> regions_by_path;
+    };
+
+    TextureAtlas::TextureAtlas() : pimpl(std::make_unique<Pimpl>()) {}
+    TextureAtlas::~TextureAtlas() = default;
+
+
+    std::vector<AtlasPlacement> TextureAtlas::pack(const std::vector<glm::ivec2>& sizes, int page_size,
+                                                   int padding, int* out_page_count) {
+        std::vector<AtlasPlacement> placements(sizes.size());
+        std::vector<size_t> order(sizes.size());
+        std::iota(order.begin(), order.end(), size_t{0});
+        std::stable_sort(order.begin(), order.end(), [&sizes](size_t a, size_t b) {
+            return sizes[a].y > sizes[b].y;
+        });
+
+        int page = 0;
+        int shelf_x = 0;        // Next free x on the current shelf.
+        int shelf_y = 0;        // Top of the current shelf.
+        int shelf_height = 0;   // Tallest padded image on it.
+        bool page_used = false;
+
+        for (size_t index : order) {
+            const int padded_width = sizes[index].x + padding * 2;
+            const int padded_height = sizes[index].y + padding * 2;
+            if (sizes[index].x <= 0 || sizes[index].y <= 0 || padded_width > page_size || padded_height > page_size) {
+                continue;   // Left as page -1.
+            }
+
+            if (shelf_x + padded_width > page_size) {   // Start a new shelf.
+                shelf_y += shelf_height;
+                shelf_x = 0;
+                shelf_height = 0;
+            }
+            if (shelf_y + padded_height > page_size) {  // Start a new page.
+                ++page;
+                shelf_x = 0;
+                shelf_y = 0;
+                shelf_height = 0;
+            }
+
+            AtlasPlacement& placement = placements[index];
+            placement.page = page;
+            placement.x = shelf_x + padding;
+            placement.y = shelf_y + padding;
+            placement.width = sizes[index].x;
+            placement.height = sizes[index].y;
+            shelf_x += padded_width;
+            shelf_height = std::max(shelf_height, padded_height);
+            page_used = true;
+        }
+
+        if (out_page_count) *out_page_count = page_used ? page + 1 : 0;
+        return placements;
+    }
+
+
+    size_t TextureAtlas::build(IRenderer& renderer, const std::vector<std::string>& image_paths,
+                               const std::string& cache_directory, int page_size, int padding) {
+        clear();
+        if (image_paths.empty() || page_size <= 0) return 0;
+
+        // 1. Load everything up front. Cooked images are mapped; only those
+        //    missing from the cache are decoded (and cooked for next time).
+        std::vector<DecodedAtlasImage> images(image_paths.size());
+        JobSystem::get().parallel_for(image_paths.size(), [&](size_t i) {
+            images[i].cooked = TextureCache(cache_directory).load(image_paths[i]);
+            if (images[i].cooked) {
+                images[i].pixels = images[i].cooked->get_mip_data(0);
+                images[i].width = images[i].cooked->get_width();
+                images[i].height = images[i].cooked->get_height();
+            }
+        });
+
+        // 2. Pack. Big images (backgrounds and the like) would crowd out
+        //    everything else, so they stay standalone textures.
+        const int max_side = page_size / 2;
+        std::vector<glm::ivec2> sizes(images.size(), glm::ivec2(0));
+        for (size_t i = 0; i < images.size(); ++i) {
+            if (images[i].pixels && images[i].width <= max_side && images[i].height <= max_side) {
+                sizes[i] = glm::ivec2(images[i].width, images[i].height);
+            }
+        }
+        int page_count = 0;
+        const std::vector<AtlasPlacement> placements = pack(sizes, page_size, padding, &page_count);
+
+        // 3. Compose and upload each page, trimmed to the height it needs.
+        std::vector<int> page_heights(static_cast<size_t>(page_count), 1);
+        for (const AtlasPlacement& placement : placements) {
+            if (placement.page < 0) continue;
+            int& height = page_heights[static_cast<size_t>(placement.page)];
+            height = std::max(height, placement.y + placement.height + padding);
+        }
+
+        std::vector<unsigned char> page_pixels;
+        std::vector<ITexture*> uploaded(static_cast<size_t>(page_count), nullptr);
+        for (int page = 0; page < page_count; ++page) {
+            const int page_height = std::min(page_size, next_power_of_two(page_heights[static_cast<size_t>(page)]));
+            page_heights[static_cast<size_t>(page)] = page_height;
+            page_pixels.assign(static_cast<size_t>(page_size) * page_height * 4, 0);
+            for (size_t i = 0; i < placements.size(); ++i) {
+                if (placements[i].page == page) {
+                    blit_with_border(images[i], placements[i], padding, page_pixels.data(), page_size, page_height);
+                }
+            }
+            ITexture* texture = renderer.create_texture(page_pixels.data(), page_size, page_height, 4);
+            if (!texture) {
+                std::cerr << "TextureAtlas: Renderer could not create atlas page " << page << std::endl;
+                continue;
+            }
+            uploaded[static_cast<size_t>(page)] = texture;
+            pimpl->pages.emplace_back(texture);
+        }
+
+        // 4. Register a region per packed image.
+        for (size_t i = 0; i < placements.size(); ++i) {
+            const AtlasPlacement& placement = placements[i];
+            if (placement.page >= 0 && uploaded[static_cast<size_t>(placement.page)]) {
+                const float page_width = static_cast<float>(page_size);
+                const float page_height = static_cast<float>(page_heights[static_cast<size_t>(placement.page)]);
+                const glm::vec4 uv_rect(placement.x / page_width, placement.y / page_height,
+                                        placement.width / page_width, placement.height / page_height);
+                pimpl->regions.push_back(std::make_unique<AtlasRegion>(uploaded[static_cast<size_t>(placement.page)],
+                                                                       uv_rect, placement.width, placement.height));
+                pimpl->regions_by_path[image_paths[i]] = pimpl->regions.back().get();
+            }
+        }
+
+        std::cout << "TextureAtlas: Packed " << pimpl->regions.size() << " of " << image_paths.size()
+                  << " images into " << pimpl->pages.size() << " page(s)." << std::endl;
+        return pimpl->regions.size();
+    }
+
+
+    ITexture* TextureAtlas::find(const std::string& image_path) const {
+        auto it = pimpl->regions_by_path.find(image_path);
+        return it != pimpl->regions_by_path.end() ? it->second : nullptr;
+    }
+
+    size_t TextureAtlas::get_page_count() const { return pimpl->pages.size(); }
+    size_t TextureAtlas::get_region_count() const { return pimpl->regions.size(); }
+
+    ITexture* TextureAtlas::get_page(size_t index) const {
+        return index < pimpl->pages.size() ? pimpl->pages[index].get() : nullptr;
+    }
+
+    void TextureAtlas::clear() {
+        pimpl->regions_by_path.clear();
+        pimpl->regions.clear();
+        pimpl->pages.clear();
+    }
+
+} // namespace Salix
@@ -0,0 +1,96 @@
+// =================================================================================
+// Filename:    Salix/assets/TextureAtlas.h
+// Author:      SalixGameStudio
+// Description: Declares TextureAtlas, which packs many small images into a few
+//              shared page textures, and AtlasRegion, the ITexture a sprite
+//              holds for one packed image.
+// =================================================================================
+#pragma once
+
+#include <Salix/core/Core.h>
+#include <Salix/rendering/ITexture.h>
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Salix {
+
+    // Forward declarations
+    class IRenderer;
+
+    // Where the packer put one image. page is -1 if the image did not fit.
+    struct AtlasPlacement {
+        int page = -1;
+        int x = 0;
+        int y = 0;
+        int width = 0;
+        int height = 0;
+    };
+
+    // One packed image. It reports the image's own size, binds as its page
+    // and maps the quad onto its rectangle of the page. Its ImGui id is the
+    // page's, so ImGui callers must pass get_uv_rect() as uv0/uv1 too.
+    class SALIX_API AtlasRegion : public ITexture {
+        public:
+            AtlasRegion(ITexture* page_texture, const glm::vec4& uv_rect, int width, int height);
+
+            int get_width() const override { return width; }
+            int get_height() const override { return height; }
+            ImTextureID get_imgui_texture_id() const override { return page->get_imgui_texture_id(); }
+            ITexture* get_base_texture() override { return page; }
+            glm::vec4 get_uv_rect() const override { return uv_rect; }
+
+        private:
+            ITexture* page;
+            glm::vec4 uv_rect;
+            int width;
+            int height;
+    };
+
+    class SALIX_API TextureAtlas {
+        public:
+            static constexpr int DEFAULT_PAGE_SIZE = 2048;
+            // Border around every image, filled with copies of its edge pixels
+            // so linear filtering never picks up a neighbour.
+            static constexpr int DEFAULT_PADDING = 2;
+
+            TextureAtlas();
+            ~TextureAtlas();
+
+            // Loads the images through the cooked texture cache in
+            // cache_directory (in parallel), packs them and uploads the pages
+            // through IRenderer::create_texture(). An empty directory decodes
+            // every image. Images that fail to load or are larger than half a
+            // page are left out, so they keep loading as standalone textures.
+            // Returns the number of images packed.
+            size_t build(IRenderer& renderer, const std::vector<std::string>& image_paths,
+                         const std::string& cache_directory = {},
+                         int page_size = DEFAULT_PAGE_SIZE, int padding = DEFAULT_PADDING);
+
+            // The region for an image path exactly as passed to build(), or nullptr.
+            ITexture* find(const std::string& image_path) const;
+
+            size_t get_page_count() const;
+            size_t get_region_count() const;
+            ITexture* get_page(size_t index) const;
+
+            // Releases every page and region.
+            void clear();
+
+            // Shelf packing, tallest first, onto page_size square pages. Returns
+            // one placement per size; x/y are where the image itself starts.
+            // build() trims each page to the power-of-two height it uses.
+            static std::vector<AtlasPlacement> pack(const std::vector<glm::ivec2>& sizes, int page_size,
+                                                    int padding, int* out_page_count = nullptr);
+
+        private:
+            TextureAtlas(const TextureAtlas&) = delete;
+            TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+            struct Pimpl;
+            std::unique_ptr<Pimpl> pimpl;
+    };
+
+} // namespace Salix
@@ -0,0 +1,259 @@
+// =================================================================================
+// Filename:    Salix/assets/TextureCache.cpp
+// Author:      SalixGameStudio
+// Description: Implements cooking, writing and mapping of cached textures.
+// =================================================================================
+#include <Salix/assets/TextureCache.h>
+#include <Salix/core/MappedFile.h>
+#include <stb/stb_image.h>  // Declarations only; the implementation lives in OpenGLRenderer.cpp.
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <system_error>
+#include <vector>
+
+namespace Salix {
+
+    namespace {
+        constexpr const char* COOKED_EXTENSION = ".stex";
+
+        size_t mip_bytes(int width, int height) {
+            return static_cast<size_t>(width) * static_cast<size_t>(height) * 4;
+        }
+
+        // Cooked files are named after a hash of the normalised source path,
+        // so sources with the same file name in different folders never clash.
+        uint64_t hash_path(const std::string& path) {
+            uint64_t hash = 14695981039346656037ull;   // FNV-1a
+            for (unsigned char c : path) {
+                hash ^= c;
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        bool read_source_stamp(const std::string& source_path, int64_t& out_write_time, uint64_t& out_size) {
+            std::error_code error;
+            auto write_time = std::filesystem::last_write_time(source_path, error);
+            if (error) return false;
+            auto size = std::filesystem::file_size(source_path, error);
+            if (error) return false;
+            out_write_time = static_cast<int64_t>(write_time.time_since_epoch().count());
+            out_size = static_cast<uint64_t>(size);
+            return true;
+        }
+
+        void expand_to_rgba(const unsigned char* pixels, int width, int height, int channels, unsigned char* out) {
+            const size_t count = static_cast<size_t>(width) * static_cast<size_t>(height);
+            for (size_t i = 0; i < count; ++i) {
+                const unsigned char* src = pixels + i * static_cast<size_t>(channels);
+                unsigned char* dst = out + i * 4;
+                switch (channels) {
+                    case 1: dst[0] = dst[1] = dst[2] = src[0]; dst[3] = 255; break;
+                    case 2: dst[0] = dst[1] = dst[2] = src[0]; dst[3] = src[1]; break;
+                    case 3: dst[0] = src[0]; dst[1] = src[1]; dst[2] = src[2]; dst[3] = 255; break;
+                    default: std::memcpy(dst, src, 4); break;
+                }
+            }
+        }
+
+        // 2x2 box filter. Odd edges repeat their last row/column.
+        void downsample(const unsigned char* src, int src_width, int src_height,
+                        unsigned char* dst, int dst_width, int dst_height) {
+            for (int y = 0; y < dst_height; ++y) {
+                const int y0 = std::min(y * 2, src_height - 1);
+                const int y1 = std::min(y * 2 + 1, src_height - 1);
+                for (int x = 0; x < dst_width; ++x) {
+                    const int x0 = std::min(x * 2, src_width - 1);
+                    const int x1 = std::min(x * 2 + 1, src_width - 1);
+                    const unsigned char* a = src + (static_cast<size_t>(y0) * src_width + x0) * 4;
+                    const unsigned char* b = src + (static_cast<size_t>(y0) * src_width + x1) * 4;
+                    const unsigned char* c = src + (static_cast<size_t>(y1) * src_width + x0) * 4;
+                    const unsigned char* d = src + (static_cast<size_t>(y1) * src_width + x1) * 4;
+                    unsigned char* out = dst + (static_cast<size_t>(y) * dst_width + x) * 4;
+                    for (int k = 0; k < 4; ++k) {
+                        out[k] = static_cast<unsigned char>((a[k] + b[k] + c[k] + d[k] + 2) / 4);
+                    }
+                }
+            }
+        }
+    }
+
+
+    // --- CookedTexture ---
+
+    struct CookedTexture::Pimpl {
+        MappedFile mapping;                 // Set when read from the cache...
+        std::vector<unsigned char> bytes;   // ...otherwise the file image lives here.
+        const CookedTextureHeader* header = nullptr;
+        std::vector<size_t> mip_offsets;    // From the start of the file image.
+
+        const unsigned char* base() const {
+            return mapping.is_open() ? mapping.get_data() : bytes.data();
+        }
+
+        void index_mips() {
+            mip_offsets.clear();
+            size_t offset = sizeof(CookedTextureHeader);
+            int width = static_cast<int>(header->width);
+            int height = static_cast<int>(header->height);
+            for (uint32_t level = 0; level < header->mip_count; ++level) {
+                mip_offsets.push_back(offset);
+                offset += mip_bytes(width, height);
+                width = std::max(1, width / 2);
+                height = std::max(1, height / 2);
+            }
+        }
+    };
+
+    CookedTexture::CookedTexture() : pimpl(std::make_unique<Pimpl>()) {}
+    CookedTexture::~CookedTexture() = default;
+
+    int CookedTexture::get_width() const { return static_cast<int>(pimpl->header->width); }
+    int CookedTexture::get_height() const { return static_cast<int>(pimpl->header->height); }
+    int CookedTexture::get_mip_count() const { return static_cast<int>(pimpl->header->mip_count); }
+
+    int CookedTexture::get_mip_width(int level) const {
+        return std::max(1, get_width() >> level);
+    }
+
+    int CookedTexture::get_mip_height(int level) const {
+        return std::max(1, get_height() >> level);
+    }
+
+    const unsigned char* CookedTexture::get_mip_data(int level) const {
+        if (level < 0 || level >= get_mip_count()) return nullptr;
+        return pimpl->base() + pimpl->mip_offsets[static_cast<size_t>(level)];
+    }
+
+    size_t CookedTexture::get_data_size() const {
+        size_t total = 0;
+        for (int level = 0; level < get_mip_count(); ++level) {
+            total += mip_bytes(get_mip_width(level), get_mip_height(level));
+        }
+        return total;
+    }
+
+    bool CookedTexture::is_mapped() const { return pimpl->mapping.is_open(); }
+
+
+    // --- TextureCache ---
+
+    TextureCache::TextureCache(const std::string& cache_directory) : directory(cache_directory) {}
+
+    const std::string& TextureCache::get_directory() const { return directory; }
+
+    bool TextureCache::is_enabled() const { return !directory.empty(); }
+
+    std::string TextureCache::get_cooked_path(const std::string& source_path) const {
+        const std::string normalized = std::filesystem::path(source_path).lexically_normal().generic_string();
+        char name[17];
+        std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(hash_path(normalized)));
+        return (std::filesystem::path(directory) / (std::string(name) + COOKED_EXTENSION)).string();
+    }
+
+    int TextureCache::get_mip_count_for(int width, int height) {
+        int levels = 1;
+        int size = std::max(width, height);
+        while (size > 1) {
+            size /= 2;
+            ++levels;
+        }
+        return levels;
+    }
+
+    std::unique_ptr<CookedTexture> TextureCache::open(const std::string& source_path) const {
+        if (!is_enabled()) return nullptr;
+
+        int64_t write_time = 0;
+        uint64_t source_size = 0;
+        if (!read_source_stamp(source_path, write_time, source_size)) return nullptr;
+
+        std::unique_ptr<CookedTexture> cooked(new CookedTexture());
+        MappedFile& mapping = cooked->pimpl->mapping;
+        if (!mapping.open(get_cooked_path(source_path))) return nullptr;
+        if (mapping.get_size() < sizeof(CookedTextureHeader)) return nullptr;
+
+        const auto* header = reinterpret_cast<const CookedTextureHeader*>(mapping.get_data());
+        if (header->magic != MAGIC || header->version != FORMAT_VERSION) return nullptr;
+        if (header->source_write_time != write_time || header->source_size != source_size) return nullptr;   // Stale.
+        if (header->width == 0 || header->height == 0 ||
+            header->mip_count != static_cast<uint32_t>(get_mip_count_for(static_cast<int>(header->width), static_cast<int>(header->height)))) {
+            return nullptr;
+        }
+
+        cooked->pimpl->header = header;
+        cooked->pimpl->index_mips();
+        if (mapping.get_size() != sizeof(CookedTextureHeader) + cooked->get_data_size()) return nullptr;   // Truncated.
+        return cooked;
+    }
+
+    std::unique_ptr<CookedTexture> TextureCache::cook(const std::string& source_path, const unsigned char* pixels,
+                                                      int width, int height, int channels) const {
+        if (!pixels || width <= 0 || height <= 0 || channels < 1 || channels > 4) return nullptr;
+
+        CookedTextureHeader header{};
+        header.magic = MAGIC;
+        header.version = FORMAT_VERSION;
+        header.width = static_cast<uint32_t>(width);
+        header.height = static_cast<uint32_t>(height);
+        header.mip_count = static_cast<uint32_t>(get_mip_count_for(width, height));
+        const bool stamped = read_source_stamp(source_path, header.source_write_time, header.source_size);
+
+        std::unique_ptr<CookedTexture> cooked(new CookedTexture());
+        CookedTexture::Pimpl& data = *cooked->pimpl;
+        size_t total = sizeof(CookedTextureHeader);
+        for (uint32_t level = 0; level < header.mip_count; ++level) {
+            total += mip_bytes(std::max(1, width >> level), std::max(1, height >> level));
+        }
+        data.bytes.resize(total);
+        std::memcpy(data.bytes.data(), &header, sizeof(header));
+        data.header = reinterpret_cast<const CookedTextureHeader*>(data.bytes.data());
+        data.index_mips();
+
+        unsigned char* base = data.bytes.data();
+        expand_to_rgba(pixels, width, height, channels, base + data.mip_offsets[0]);
+        for (uint32_t level = 1; level < header.mip_count; ++level) {
+            downsample(base + data.mip_offsets[level - 1], std::max(1, width >> (level - 1)), std::max(1, height >> (level - 1)),
+                       base + data.mip_offsets[level], std::max(1, width >> level), std::max(1, height >> level));
+        }
+
+        if (!is_enabled() || !stamped) return cooked;
+
+        // Written under a temporary name and renamed, so a reader never maps half a file.
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+        const std::string cooked_path = get_cooked_path(source_path);
+        const std::string temp_path = cooked_path + ".tmp";
+        {
+            std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+            out.write(reinterpret_cast<const char*>(data.bytes.data()), static_cast<std::streamsize>(data.bytes.size()));
+            if (!out) {
+                std::cerr << "TextureCache: Could not write '" << temp_path << "'" << std::endl;
+                return cooked;
+            }
+        }
+        std::filesystem::rename(temp_path, cooked_path, error);
+        if (error) {
+            std::cerr << "TextureCache: Could not store '" << cooked_path << "': " << error.message() << std::endl;
+            std::filesystem::remove(temp_path, error);
+        }
+        return cooked;
+    }
+
+    std::unique_ptr<CookedTexture> TextureCache::load(const std::string& source_path) const {
+        if (std::unique_ptr<CookedTexture> cooked = open(source_path)) {
+            return cooked;
+        }
+        int width = 0, height = 0, channels = 0;
+        unsigned char* pixels = stbi_load(source_path.c_str(), &width, &height, &channels, 0);
+        if (!pixels) return nullptr;
+        std::unique_ptr<CookedTexture> cooked = cook(source_path, pixels, width, height, channels);
+        stbi_image_free(pixels);
+        return cooked;
+    }
+
+} // namespace Salix
@@ -0,0 +1,95 @@
+// =================================================================================
+// Filename:    Salix/assets/TextureCache.h
+// Author:      SalixGameStudio
+// Description: Declares the cooked texture format (RGBA8 plus a full mip chain)
+//              and the on-disk cache that stores one cooked file per source image.
+// =================================================================================
+#pragma once
+
+#include <Salix/core/Core.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace Salix {
+
+    // File layout: this header, then every mip level as tightly packed RGBA8,
+    // largest first. The source's size and write time are stored so a cooked
+    // file is ignored once the image it came from changes.
+    struct CookedTextureHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t width;
+        uint32_t height;
+        uint32_t mip_count;
+        uint32_t reserved;
+        int64_t source_write_time;
+        uint64_t source_size;
+    };
+
+    // A cooked image, either mapped straight from the cache or freshly built
+    // in memory. Mip data is read-only and lives as long as this object.
+    class SALIX_API CookedTexture {
+        public:
+            ~CookedTexture();
+
+            int get_width() const;
+            int get_height() const;
+            int get_mip_count() const;
+            int get_mip_width(int level) const;
+            int get_mip_height(int level) const;
+            const unsigned char* get_mip_data(int level) const;
+            // Bytes of pixel data across all levels.
+            size_t get_data_size() const;
+            // True when the pixels come from a mapped cache file.
+            bool is_mapped() const;
+
+        private:
+            friend class TextureCache;
+            CookedTexture();
+            CookedTexture(const CookedTexture&) = delete;
+            CookedTexture& operator=(const CookedTexture&) = delete;
+
+            struct Pimpl;
+            std::unique_ptr<Pimpl> pimpl;
+    };
+
+    // Cheap to construct: it only remembers the directory, so worker threads
+    // can each make their own. An empty directory disables reading and
+    // writing files; cook() then only builds the texture in memory.
+    class SALIX_API TextureCache {
+        public:
+            explicit TextureCache(const std::string& cache_directory);
+
+            static constexpr uint32_t MAGIC = 0x58455453;   // "STEX"
+            static constexpr uint32_t FORMAT_VERSION = 1;
+
+            const std::string& get_directory() const;
+            bool is_enabled() const;
+
+            // Where the cooked copy of source_path lives (or would live).
+            std::string get_cooked_path(const std::string& source_path) const;
+
+            // Maps the cooked copy if there is one that still matches the source.
+            std::unique_ptr<CookedTexture> open(const std::string& source_path) const;
+
+            // Converts decoded pixels (1-4 channels) to RGBA8, builds the mip
+            // chain and, if the cache is enabled, writes the cooked file. Write
+            // failures are logged and otherwise ignored.
+            std::unique_ptr<CookedTexture> cook(const std::string& source_path, const unsigned char* pixels,
+                                                int width, int height, int channels) const;
+
+            // open() when the cooked copy is current; otherwise decodes the
+            // source and cook()s it, writing the cache for next time. nullptr
+            // if the source cannot be decoded. Safe on any thread.
+            std::unique_ptr<CookedTexture> load(const std::string& source_path) const;
+
+            // Number of levels down to 1x1.
+            static int get_mip_count_for(int width, int height);
+
+        private:
+            std::string directory;
+    };
+
+} // namespace Salix
@@ -15,6 +15,16 @@ namespace Salix {
         float global_dpi_scaling = 1.0f;
     };
 
+    // Settings for how the simulation is stepped.
+    struct SimulationSettings {
+        // When true, updates run at a fixed tick_rate independent of the render
+        // rate and renderers interpolate between the last two ticks.
+        bool fixed_timestep = false;
+        int tick_rate = 60;
+        // Most ticks one frame may run before the backlog is dropped.
+        int max_catch_up_steps = 5;
+    };
+
     struct ApplicationConfig { 
         WindowConfig window_config;
         RendererType renderer_type = RendererType::SDL;
@@ -23,6 +33,7 @@ namespace Salix {
         TimerType timer_type = TimerType::SDL;
         int target_fps = 60;
         GuiSettings gui_settings;
+        SimulationSettings simulation;
 
 
     };
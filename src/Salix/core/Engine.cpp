@@ -13,6 +13,8 @@
 #include <Salix/core/Engine.h>
 #include <Salix/core/SDLTimer.h>
 #include <Salix/core/ChronoTimer.h>
+#include <Salix/core/FixedTimestep.h>
+#include <Salix/core/JobSystem.h>
 
 // Reflection
 #include <Salix/reflection/ByteMirror.h>
@@ -66,6 +68,7 @@
 #include <Salix/ecs/Transform.h>
 #include <Salix/ecs/Entity.h>
 #include <Salix/ecs/Sprite2D.h>
+#include <Salix/ecs/TransformHierarchyPass.h>
 
 // 3rd-party includes
 #include <Windows.h>
@@ -88,6 +91,8 @@ namespace Salix {
         std::unique_ptr<IInputManager> game_input_manager;
         std::unique_ptr<IInputManager> gui_input_manager;
         std::unique_ptr<ITimer> timer;
+        // Only set when ApplicationConfig::simulation.fixed_timestep is on.
+        std::unique_ptr<FixedTimestep> fixed_timestep;
         std::unique_ptr<IEventPoller> event_poller;
         std::unique_ptr<EventManager> event_manager;
         std::unique_ptr<ProjectManager> project_manager;
@@ -240,6 +245,10 @@ namespace Salix {
         }
         pimpl->timer_type = config.timer_type;
         pimpl->timer->set_target_fps(config.target_fps);
+        if (config.simulation.fixed_timestep) {
+            pimpl->fixed_timestep = std::make_unique<FixedTimestep>(
+                config.simulation.tick_rate, config.simulation.max_catch_up_steps);
+        }
 
 
 
@@ -514,7 +523,11 @@ namespace Salix {
             // Apply time_scale to delta_time.
             float scaled_delta_time = delta_time * pimpl->time_scale;
             process_input();
-            update(scaled_delta_time);
+            if (pimpl->fixed_timestep) {
+                fixed_update(scaled_delta_time);
+            } else {
+                update(scaled_delta_time);
+            }
             render();
 
             pimpl->timer->tick_end();
@@ -551,6 +564,9 @@ namespace Salix {
         pimpl->event_manager.reset();
 
         pimpl->current_state.reset();
+
+        // Join the workers now, while the DLLs they run code from are loaded.
+        JobSystem::get().shutdown();
         
         pimpl->game_input_manager.reset();
 
@@ -653,6 +669,7 @@ namespace Salix {
         if (pimpl->is_running) {
         if (pimpl->current_state) {
             pimpl->current_state->update(delta_time);
+            pimpl->current_state->simulate(delta_time);
         }
         // Engine Mode Dependant update:
         if (get_input_manager()) {
@@ -662,11 +679,40 @@ namespace Salix {
 
     }
 
+    void Engine::fixed_update(float frame_delta_time) {
+        if (!pimpl->is_running) return;
+        // UI and other per-frame work runs once; only the simulation is ticked.
+        if (pimpl->current_state) {
+            pimpl->current_state->update(frame_delta_time);
+        }
+        FixedTimestep& timestep = *pimpl->fixed_timestep;
+        const int steps = timestep.advance(frame_delta_time);
+        const float step = timestep.get_step();
+        for (int i = 0; i < steps && pimpl->is_running && pimpl->current_state; ++i) {
+            // Remember where everything was, so render() can blend towards this tick.
+            TransformHierarchyPass::get().capture_previous_states();
+            pimpl->current_state->simulate(step);
+        }
+        // Input is advanced once per frame that ran a tick; on frames that ran none
+        // this frame's presses stay 'Down' until a tick has seen them.
+        if (steps > 0 && get_input_manager()) {
+            get_input_manager()->update(step * steps);
+        }
+        if (pimpl->renderer) {
+            pimpl->renderer->set_interpolation_alpha(timestep.get_alpha());
+        }
+    }
+
     void Engine::render() {
         if (!pimpl->renderer) return;
 
 
             pimpl->renderer->begin_frame();
+
+            // Hand finished texture decodes to the GPU, within this frame's budget.
+            if (pimpl->asset_manager) {
+                pimpl->asset_manager->process_texture_uploads();
+            }
             
 
             if (pimpl->current_state) {
@@ -55,6 +55,9 @@ namespace Salix {
         private:
             void process_input();
             void update(float delta_time);
+            // Fixed-step mode: updates the state once, then runs as many fixed
+            // simulation ticks as frame_delta_time pays for.
+            void fixed_update(float frame_delta_time);
             void render();
 
             struct Pimpl; // Forward-declare the private implementation struct.
@@ -0,0 +1,71 @@
+// =================================================================================
+// Filename:    Salix/core/FixedTimestep.cpp
+// Author:      SalixGameStudio
+// Description: Implements the FixedTimestep accumulator.
+// =================================================================================
+#include <Salix/core/FixedTimestep.h>
+#include <algorithm>
+
+namespace Salix {
+
+    FixedTimestep::FixedTimestep(int new_tick_rate, int max_steps) {
+        set_tick_rate(new_tick_rate);
+        set_max_catch_up_steps(max_steps);
+    }
+
+    void FixedTimestep::set_tick_rate(int new_tick_rate) {
+        tick_rate = std::max(1, new_tick_rate);
+        step = 1.0 / tick_rate;
+    }
+
+    int FixedTimestep::get_tick_rate() const {
+        return tick_rate;
+    }
+
+    float FixedTimestep::get_step() const {
+        return static_cast<float>(step);
+    }
+
+    void FixedTimestep::set_max_catch_up_steps(int max_steps) {
+        max_catch_up_steps = std::max(1, max_steps);
+    }
+
+    int FixedTimestep::get_max_catch_up_steps() const {
+        return max_catch_up_steps;
+    }
+
+    int FixedTimestep::advance(float frame_delta_time) {
+        if (frame_delta_time > 0.0f) {
+            accumulator += frame_delta_time;
+        }
+
+        int steps = static_cast<int>(accumulator / step);
+        if (steps > max_catch_up_steps) {
+            // Keep the fractional part so alpha stays continuous, drop the rest.
+            const double kept = accumulator - steps * step;
+            dropped_time += (steps - max_catch_up_steps) * step;
+            steps = max_catch_up_steps;
+            accumulator = kept + steps * step;
+        }
+        accumulator -= steps * step;
+        // Guard against the remainder creeping up to a full step through rounding.
+        if (accumulator >= step) {
+            accumulator = 0.0;
+        }
+        return steps;
+    }
+
+    float FixedTimestep::get_alpha() const {
+        return static_cast<float>(accumulator / step);
+    }
+
+    double FixedTimestep::get_dropped_time() const {
+        return dropped_time;
+    }
+
+    void FixedTimestep::reset() {
+        accumulator = 0.0;
+        dropped_time = 0.0;
+    }
+
+} // namespace Salix
@@ -0,0 +1,51 @@
+// =================================================================================
+// Filename:    Salix/core/FixedTimestep.h
+// Author:      SalixGameStudio
+// Description: Declares FixedTimestep, the accumulator that turns variable frame
+//              times into a whole number of fixed simulation ticks.
+// =================================================================================
+#pragma once
+
+#include <Salix/core/Core.h>
+
+namespace Salix {
+
+    // Frame time goes in through advance(); the number of fixed ticks to simulate
+    // comes out. Whatever is left over (less than one tick) is carried into the
+    // next frame and reported as get_alpha(), the fraction of the way from the
+    // previous tick's state to the current one that rendering should show.
+    class SALIX_API FixedTimestep {
+        public:
+            explicit FixedTimestep(int tick_rate = 60, int max_catch_up_steps = 5);
+
+            // Ticks per second. Values below 1 are clamped to 1.
+            void set_tick_rate(int tick_rate);
+            int get_tick_rate() const;
+            // Length of one tick in seconds.
+            float get_step() const;
+
+            // Most ticks a single frame may run. After a long stall the backlog
+            // beyond this is dropped instead of being simulated, so a slow frame
+            // cannot make the next one slower still.
+            void set_max_catch_up_steps(int max_steps);
+            int get_max_catch_up_steps() const;
+
+            // Adds one frame's worth of time (seconds) and returns how many ticks to run.
+            int advance(float frame_delta_time);
+
+            // Leftover time as a fraction of a tick, in [0, 1).
+            float get_alpha() const;
+            // Seconds thrown away by the catch-up clamp since construction or reset().
+            double get_dropped_time() const;
+
+            void reset();
+
+        private:
+            double step;
+            double accumulator = 0.0;
+            double dropped_time = 0.0;
+            int tick_rate;
+            int max_catch_up_steps;
+    };
+
+} // namespace Salix
@@ -0,0 +1,194 @@
+// =================================================================================
+// Filename:    Salix/core/JobSystem.cpp
+// Author:      SalixGameStudio
+// Description: Implements the work-stealing JobSystem.
+// =================================================================================
+#include <Salix/core/JobSystem.h>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Salix {
+
+    namespace {
+        struct Task {
+            JobSystem::Job job;
+            JobGroup* group = nullptr;
+        };
+
+        struct WorkQueue {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        // Which JobSystem (if any) the current thread is a worker of, and its queue.
+        thread_local const void* current_system = nullptr;
+        thread_local size_t current_worker = 0;
+    }
+
+
+    struct JobSystem::Pimpl {
+        std::vector<std::unique_ptr<WorkQueue>> queues;
+        std::vector<std::thread> workers;
+        std::atomic<size_t> queued_tasks{0};
+        std::atomic<size_t> next_queue{0};
+        std::atomic<bool> stopping{false};
+        std::mutex sleep_mutex;
+        std::condition_variable wake;
+
+        void push(Task task, size_t queue_index) {
+            {
+                std::lock_guard<std::mutex> lock(queues[queue_index]->mutex);
+                queues[queue_index]->tasks.push_back(std::move(task));
+            }
+            queued_tasks.fetch_add(1, std::memory_order_release);
+            // Taking the lock orders this with a worker that is about to sleep.
+            { std::lock_guard<std::mutex> lock(sleep_mutex); }
+            wake.notify_one();
+        }
+
+        // Own queue from the back (most recent, cache-warm), everyone else's from the front.
+        bool try_take(size_t home, Task& out) {
+            const size_t count = queues.size();
+            for (size_t offset = 0; offset < count; ++offset) {
+                WorkQueue& queue = *queues[(home + offset) % count];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (queue.tasks.empty()) continue;
+                if (offset == 0) {
+                    out = std::move(queue.tasks.back());
+                    queue.tasks.pop_back();
+                } else {
+                    out = std::move(queue.tasks.front());
+                    queue.tasks.pop_front();
+                }
+                queued_tasks.fetch_sub(1, std::memory_order_acq_rel);
+                return true;
+            }
+            return false;
+        }
+
+        static void execute(Task& task) {
+            try {
+                task.job();
+            } catch (const std::exception& e) {
+                std::cerr << "JobSystem: job threw an exception: " << e.what() << std::endl;
+            } catch (...) {
+                std::cerr << "JobSystem: job threw an unknown exception." << std::endl;
+            }
+            task.group->pending.fetch_sub(1, std::memory_order_acq_rel);
+        }
+
+        void worker_loop(size_t worker_index) {
+            current_worker = worker_index;
+            Task task;
+            while (true) {
+                if (try_take(worker_index, task)) {
+                    execute(task);
+                    task = Task{};
+                    continue;
+                }
+                std::unique_lock<std::mutex> lock(sleep_mutex);
+                wake.wait(lock, [this]() {
+                    return stopping.load(std::memory_order_acquire) ||
+                           queued_tasks.load(std::memory_order_acquire) > 0;
+                });
+                if (stopping.load(std::memory_order_acquire) &&
+                    queued_tasks.load(std::memory_order_acquire) == 0) {
+                    return;
+                }
+            }
+        }
+    };
+
+
+    JobSystem::JobSystem(unsigned int worker_count) : pimpl(std::make_unique<Pimpl>()) {
+        // With no workers a single queue still holds submitted jobs until a waiter runs them.
+        const size_t queue_count = std::max(1u, worker_count);
+        for (size_t i = 0; i < queue_count; ++i) {
+            pimpl->queues.push_back(std::make_unique<WorkQueue>());
+        }
+        for (unsigned int i = 0; i < worker_count; ++i) {
+            pimpl->workers.emplace_back([this, i]() {
+                current_system = this;
+                pimpl->worker_loop(i);
+            });
+        }
+    }
+
+    JobSystem::~JobSystem() {
+        shutdown();
+    }
+
+
+    void JobSystem::shutdown() {
+        {
+            std::lock_guard<std::mutex> lock(pimpl->sleep_mutex);
+            pimpl->stopping.store(true, std::memory_order_release);
+        }
+        pimpl->wake.notify_all();
+        for (auto& worker : pimpl->workers) {
+            worker.join();
+        }
+        pimpl->workers.clear();
+    }
+
+
+    JobSystem& JobSystem::get() {
+        // The calling thread always takes part, so leave one hardware thread for it.
+        static JobSystem instance(std::max(1u, std::thread::hardware_concurrency()) - 1);
+        return instance;
+    }
+
+
+    unsigned int JobSystem::get_worker_count() const {
+        return static_cast<unsigned int>(pimpl->workers.size());
+    }
+
+
+    void JobSystem::submit(JobGroup& group, Job job) {
+        group.pending.fetch_add(1, std::memory_order_acq_rel);
+        // Workers keep their own jobs local; other threads spread them round-robin.
+        const size_t queue_index = (current_system == this) ?
+            current_worker :
+            pimpl->next_queue.fetch_add(1, std::memory_order_relaxed) % pimpl->queues.size();
+        pimpl->push(Task{ std::move(job), &group }, queue_index);
+    }
+
+
+    void JobSystem::wait(JobGroup& group) {
+        const size_t home = (current_system == this) ? current_worker : 0;
+        Task task;
+        while (!group.is_done()) {
+            if (pimpl->try_take(home, task)) {
+                Pimpl::execute(task);
+                task = Task{};
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+
+    void JobSystem::parallel_for(size_t count, const std::function<void(size_t)>& func) {
+        if (count == 0) return;
+        if (count == 1 || pimpl->workers.empty()) {
+            for (size_t i = 0; i < count; ++i) {
+                func(i);
+            }
+            return;
+        }
+        JobGroup group;
+        // Keep the first item for ourselves; everything else is up for grabs.
+        for (size_t i = 1; i < count; ++i) {
+            submit(group, [&func, i]() { func(i); });
+        }
+        func(0);
+        wait(group);
+    }
+
+} // namespace Salix
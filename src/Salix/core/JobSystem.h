@@ -0,0 +1,70 @@
+// =================================================================================
+// Filename:    Salix/core/JobSystem.h
+// Author:      SalixGameStudio
+// Description: Declares a small work-stealing job system used to spread
+//              per-frame work (entity updates, transform passes) across cores.
+// =================================================================================
+#pragma once
+
+#include <Salix/core/Core.h>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace Salix {
+
+    // Tracks a set of submitted jobs so the submitter can wait for all of them.
+    class SALIX_API JobGroup {
+        public:
+            JobGroup() = default;
+            bool is_done() const { return pending.load(std::memory_order_acquire) == 0; }
+
+        private:
+            friend class JobSystem;
+            std::atomic<size_t> pending{0};
+            JobGroup(const JobGroup&) = delete;
+            JobGroup& operator=(const JobGroup&) = delete;
+    };
+
+
+    // Each worker owns a deque: it pushes and pops its own jobs at the back and
+    // steals from the front of the others' when it runs dry. Threads that wait
+    // on a group help by running queued jobs instead of blocking, so nested
+    // parallel work cannot deadlock and a system with no workers still works.
+    class SALIX_API JobSystem {
+        public:
+            using Job = std::function<void()>;
+
+            explicit JobSystem(unsigned int worker_count);
+            ~JobSystem();
+
+            // Process-wide instance with one worker per extra hardware thread.
+            // The owner of the process (Engine::shutdown) must call shutdown()
+            // on it; joining threads from a static destructor during DLL unload
+            // deadlocks on Windows.
+            static JobSystem& get();
+
+            // Lets the queued jobs finish, then stops and joins the workers.
+            // Afterwards the system keeps working with no workers: waiters run
+            // every job themselves. Safe to call more than once.
+            void shutdown();
+
+            unsigned int get_worker_count() const;
+
+            void submit(JobGroup& group, Job job);
+            void wait(JobGroup& group);
+
+            // Calls func(i) for every i in [0, count) and returns once all calls
+            // have finished. The calling thread takes part in the work.
+            void parallel_for(size_t count, const std::function<void(size_t)>& func);
+
+        private:
+            JobSystem(const JobSystem&) = delete;
+            JobSystem& operator=(const JobSystem&) = delete;
+
+            struct Pimpl;
+            std::unique_ptr<Pimpl> pimpl;
+    };
+
+} // namespace Salix
@@ -0,0 +1,115 @@
+// =================================================================================
+// Filename:    Salix/core/MappedFile.cpp
+// Author:      SalixGameStudio
+// Description: Implements MappedFile on top of the platform's file mapping API.
+// =================================================================================
+#include <Salix/core/MappedFile.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Salix {
+
+    struct MappedFile::Pimpl {
+        const unsigned char* data = nullptr;
+        size_t size = 0;
+#ifdef _WIN32
+        HANDLE file = INVALID_HANDLE_VALUE;
+        HANDLE mapping = nullptr;
+#endif
+    };
+
+    MappedFile::MappedFile() : pimpl(std::make_unique<Pimpl>()) {}
+
+    MappedFile::~MappedFile() {
+        if (pimpl) close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept = default;
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            if (pimpl) close();
+            pimpl = std::move(other.pimpl);
+        }
+        return *this;
+    }
+
+    bool MappedFile::open(const std::string& file_path) {
+        if (!pimpl) pimpl = std::make_unique<Pimpl>();
+        close();
+
+#ifdef _WIN32
+        HANDLE file = CreateFileA(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return false;
+
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart <= 0) {
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) {
+            CloseHandle(file);
+            return false;
+        }
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view) {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+
+        pimpl->file = file;
+        pimpl->mapping = mapping;
+        pimpl->data = static_cast<const unsigned char*>(view);
+        pimpl->size = static_cast<size_t>(file_size.QuadPart);
+#else
+        int fd = ::open(file_path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+            ::close(fd);
+            return false;
+        }
+
+        void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);   // The mapping keeps the file alive.
+        if (view == MAP_FAILED) return false;
+
+        pimpl->data = static_cast<const unsigned char*>(view);
+        pimpl->size = static_cast<size_t>(info.st_size);
+#endif
+        return true;
+    }
+
+    void MappedFile::close() {
+        if (!pimpl || !pimpl->data) return;
+#ifdef _WIN32
+        UnmapViewOfFile(pimpl->data);
+        CloseHandle(pimpl->mapping);
+        CloseHandle(pimpl->file);
+        pimpl->mapping = nullptr;
+        pimpl->file = INVALID_HANDLE_VALUE;
+#else
+        munmap(const_cast<unsigned char*>(pimpl->data), pimpl->size);
+#endif
+        pimpl->data = nullptr;
+        pimpl->size = 0;
+    }
+
+    bool MappedFile::is_open() const { return pimpl && pimpl->data != nullptr; }
+    const unsigned char* MappedFile::get_data() const { return pimpl ? pimpl->data : nullptr; }
+    size_t MappedFile::get_size() const { return pimpl ? pimpl->size : 0; }
+
+} // namespace Salix
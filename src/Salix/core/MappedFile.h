@@ -0,0 +1,41 @@
+// =================================================================================
+// Filename:    Salix/core/MappedFile.h
+// Author:      SalixGameStudio
+// Description: Declares MappedFile, a read-only memory mapping of a whole file.
+// =================================================================================
+#pragma once
+
+#include <Salix/core/Core.h>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace Salix {
+
+    // Maps a file into the address space so its bytes can be read (or handed
+    // to the GPU) without copying them through a stream first. The view stays
+    // valid until close() or destruction.
+    class SALIX_API MappedFile {
+        public:
+            MappedFile();
+            ~MappedFile();
+            MappedFile(MappedFile&& other) noexcept;
+            MappedFile& operator=(MappedFile&& other) noexcept;
+
+            // Returns false (and stays closed) if the file is missing or empty.
+            bool open(const std::string& file_path);
+            void close();
+
+            bool is_open() const;
+            const unsigned char* get_data() const;
+            size_t get_size() const;
+
+        private:
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            struct Pimpl;
+            std::unique_ptr<Pimpl> pimpl;
+    };
+
+} // namespace Salix
@@ -0,0 +1,203 @@
+// =================================================================================
+// Filename:    Salix/core/PoolAllocator.cpp
+// Author:      SalixGameStudio
+// Description: Implements the size-class PoolAllocator.
+// =================================================================================
+#include <Salix/core/PoolAllocator.h>
+#include <array>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+#ifdef SALIX_TESTS_ENABLED
+namespace {
+    thread_local uint64_t thread_heap_allocations = 0;
+}
+
+// Test builds count every heap allocation so churn tests can assert that a
+// warm loop never reaches malloc. The array and nothrow forms forward here.
+void* operator new(std::size_t size) {
+    ++thread_heap_allocations;
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+#endif
+
+namespace Salix {
+
+    namespace {
+        constexpr std::size_t SIZE_CLASS_COUNT = PoolAllocator::MAX_POOLED_SIZE / PoolAllocator::POOL_GRANULARITY;
+        constexpr std::size_t BYTES_PER_PAGE = 16 * 1024;
+        constexpr std::size_t MIN_BLOCKS_PER_PAGE = 8;
+
+        struct FreeBlock {
+            FreeBlock* next;
+        };
+
+        struct SizeClassPool {
+            std::mutex mutex;
+            FreeBlock* free_list = nullptr;
+            std::vector<void*> pages;
+            PoolStats stats;
+
+            // Caller must hold the mutex.
+            void grow(std::size_t block_size) {
+                const std::size_t block_count = std::max(MIN_BLOCKS_PER_PAGE, BYTES_PER_PAGE / block_size);
+                char* page = static_cast<char*>(::operator new(block_size * block_count));
+                pages.push_back(page);
+                ++stats.system_allocations;
+                // Thread the new blocks so the lowest address is handed out first.
+                for (std::size_t i = block_count; i-- > 0;) {
+                    FreeBlock* block = reinterpret_cast<FreeBlock*>(page + i * block_size);
+                    block->next = free_list;
+                    free_list = block;
+                }
+            }
+
+            ~SizeClassPool() {
+                for (void* page : pages) {
+                    ::operator delete(page);
+                }
+            }
+        };
+
+        struct PoolState {
+            std::array<SizeClassPool, SIZE_CLASS_COUNT> pools;
+            std::mutex oversize_mutex;
+            PoolStats oversize_stats;
+        };
+
+        // Intentionally leaked: pooled objects may still be released by other
+        // static destructors during shutdown.
+        PoolState& state() {
+            static PoolState* instance = new PoolState();
+            return *instance;
+        }
+
+        std::size_t size_class_of(std::size_t size) {
+            if (size == 0) {
+                size = 1;
+            }
+            return (size - 1) / PoolAllocator::POOL_GRANULARITY;
+        }
+
+        void accumulate(PoolStats& total, const PoolStats& stats) {
+            total.allocations += stats.allocations;
+            total.deallocations += stats.deallocations;
+            total.system_allocations += stats.system_allocations;
+            total.live_blocks += stats.live_blocks;
+        }
+    }
+
+
+    void* PoolAllocator::allocate(std::size_t size) {
+        PoolState& pool_state = state();
+        if (size > MAX_POOLED_SIZE) {
+            {
+                std::lock_guard<std::mutex> lock(pool_state.oversize_mutex);
+                ++pool_state.oversize_stats.allocations;
+                ++pool_state.oversize_stats.system_allocations;
+                ++pool_state.oversize_stats.live_blocks;
+            }
+            return ::operator new(size);
+        }
+
+        const std::size_t size_class = size_class_of(size);
+        SizeClassPool& pool = pool_state.pools[size_class];
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        if (!pool.free_list) {
+            pool.grow((size_class + 1) * POOL_GRANULARITY);
+        }
+        FreeBlock* block = pool.free_list;
+        pool.free_list = block->next;
+        ++pool.stats.allocations;
+        ++pool.stats.live_blocks;
+        return block;
+    }
+
+
+    void PoolAllocator::deallocate(void* ptr, std::size_t size) noexcept {
+        if (!ptr) {
+            return;
+        }
+        PoolState& pool_state = state();
+        if (size > MAX_POOLED_SIZE) {
+            {
+                std::lock_guard<std::mutex> lock(pool_state.oversize_mutex);
+                ++pool_state.oversize_stats.deallocations;
+                --pool_state.oversize_stats.live_blocks;
+            }
+            ::operator delete(ptr);
+            return;
+        }
+
+        SizeClassPool& pool = pool_state.pools[size_class_of(size)];
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        FreeBlock* block = static_cast<FreeBlock*>(ptr);
+        block->next = pool.free_list;
+        pool.free_list = block;
+        ++pool.stats.deallocations;
+        --pool.stats.live_blocks;
+    }
+
+
+    PoolStats PoolAllocator::get_stats() {
+        PoolState& pool_state = state();
+        PoolStats total;
+        for (SizeClassPool& pool : pool_state.pools) {
+            std::lock_guard<std::mutex> lock(pool.mutex);
+            accumulate(total, pool.stats);
+        }
+        std::lock_guard<std::mutex> lock(pool_state.oversize_mutex);
+        accumulate(total, pool_state.oversize_stats);
+        return total;
+    }
+
+
+    PoolStats PoolAllocator::get_stats_for_size(std::size_t size) {
+        PoolState& pool_state = state();
+        if (size > MAX_POOLED_SIZE) {
+            std::lock_guard<std::mutex> lock(pool_state.oversize_mutex);
+            return pool_state.oversize_stats;
+        }
+        SizeClassPool& pool = pool_state.pools[size_class_of(size)];
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        return pool.stats;
+    }
+
+
+    uint64_t PoolAllocator::get_thread_heap_allocations() {
+#ifdef SALIX_TESTS_ENABLED
+        return thread_heap_allocations;
+#else
+        return 0;
+#endif
+    }
+
+
+    void PoolAllocator::reset_stats() {
+        PoolState& pool_state = state();
+        for (SizeClassPool& pool : pool_state.pools) {
+            std::lock_guard<std::mutex> lock(pool.mutex);
+            // live_blocks describes current occupancy, not a window, so it is kept.
+            pool.stats.allocations = 0;
+            pool.stats.deallocations = 0;
+            pool.stats.system_allocations = 0;
+        }
+        std::lock_guard<std::mutex> lock(pool_state.oversize_mutex);
+        pool_state.oversize_stats.allocations = 0;
+        pool_state.oversize_stats.deallocations = 0;
+        pool_state.oversize_stats.system_allocations = 0;
+    }
+
+} // namespace Salix
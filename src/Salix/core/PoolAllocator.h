@@ -0,0 +1,82 @@
+// =================================================================================
+// Filename:    Salix/core/PoolAllocator.h
+// Author:      SalixGameStudio
+// Description: Declares a size-class pool allocator used for entities, elements
+//              and their small runtime containers, plus an STL adapter for it.
+// =================================================================================
+#pragma once
+
+#include <Salix/core/Core.h>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace Salix {
+
+    // Only requests made through PoolAllocator are counted. Anything an object
+    // allocates with the default allocator (strings, plain std containers) never
+    // shows up here; get_thread_heap_allocations() covers those.
+    struct PoolStats {
+        uint64_t allocations = 0;         // Blocks handed out by the pools.
+        uint64_t deallocations = 0;       // Blocks returned to the pools.
+        uint64_t system_allocations = 0;  // Pool requests that reached the system heap (new pages and oversize requests).
+        uint64_t live_blocks = 0;         // Blocks currently in use.
+    };
+
+    // Requests are rounded up to POOL_GRANULARITY and served from one free list
+    // per size, so every concrete Entity/Element type ends up with its own pool.
+    // Freed blocks go straight back onto their free list and are reused by the
+    // next allocation of that size; pages are only returned to the system at exit.
+    class SALIX_API PoolAllocator {
+        public:
+            static constexpr std::size_t POOL_GRANULARITY = 16;
+            static constexpr std::size_t MAX_POOLED_SIZE = 2048;
+
+            static void* allocate(std::size_t size);
+            static void deallocate(void* ptr, std::size_t size) noexcept;
+
+            // Totals across all size classes.
+            static PoolStats get_stats();
+            // Stats for the pool that serves allocations of 'size' bytes.
+            static PoolStats get_stats_for_size(std::size_t size);
+            // Zeroes the counters (not the pools) so a test can measure a window.
+            static void reset_stats();
+
+            // Global operator new calls made so far on the calling thread, pool
+            // pages included. Only counted in builds with SALIX_TESTS_ENABLED,
+            // which install a counting operator new; elsewhere this stays 0.
+            static uint64_t get_thread_heap_allocations();
+    };
+
+
+    // Minimal std::allocator replacement so containers owned by pooled objects
+    // can draw their buffers and nodes from the same pools.
+    template<typename T>
+    struct PoolStdAllocator {
+        using value_type = T;
+
+        PoolStdAllocator() noexcept = default;
+        template<typename U>
+        PoolStdAllocator(const PoolStdAllocator<U>&) noexcept {}
+
+        T* allocate(std::size_t count) {
+            return static_cast<T*>(PoolAllocator::allocate(count * sizeof(T)));
+        }
+        void deallocate(T* ptr, std::size_t count) noexcept {
+            PoolAllocator::deallocate(ptr, count * sizeof(T));
+        }
+
+        template<typename U>
+        bool operator==(const PoolStdAllocator<U>&) const noexcept { return true; }
+        template<typename U>
+        bool operator!=(const PoolStdAllocator<U>&) const noexcept { return false; }
+    };
+
+    // Containers whose buffers come from the pools.
+    template<typename T>
+    using PoolVector = std::vector<T, PoolStdAllocator<T>>;
+    using PoolString = std::basic_string<char, std::char_traits<char>, PoolStdAllocator<char>>;
+
+} // namespace Salix
@@ -11,14 +11,18 @@
 
 namespace Salix {
 
-    struct BoxCollider::Pimpl { 
-        Vector3 size = Vector3(1.0f, 1.0f, 1.0f);
-    };
-
-    BoxCollider::BoxCollider() :pimpl(std::make_unique<Pimpl>()) {
+    BoxCollider::BoxCollider() {
+        auto& storage = ElementStorage::get().box_colliders();
+        slot = storage.allocate(this);
+        chunk = &storage.get_chunk_of(slot);
+        index = storage.get_index_in_chunk(slot);
+        chunk->sizes[index] = Vector3(1.0f, 1.0f, 1.0f);
         set_name(get_class_name());
     }
-    BoxCollider::~BoxCollider() = default;
+
+    BoxCollider::~BoxCollider() {
+        ElementStorage::get().box_colliders().release(slot);
+    }
 
     void BoxCollider::initialize() {}
 
@@ -34,11 +38,11 @@ namespace Salix {
 
 
     const Vector3& BoxCollider::get_size() const {
-        return pimpl->size;
+        return chunk->sizes[index];
     }
     
     void BoxCollider::set_size(const Vector3& new_size) {
-        pimpl->size = new_size;
+        chunk->sizes[index] = new_size;
     }
 
     template <class Archive>
@@ -46,7 +50,7 @@ namespace Salix {
         // 1. First, tell Cereal to serialize the data from the base class (Element).
         archive(cereal::base_class<Element>(this));
 
-        archive(cereal::make_nvp("size", pimpl->size));
+        archive(cereal::make_nvp("size", chunk->sizes[index]));
     }
 
     template void SALIX_API BoxCollider::serialize<cereal::JSONOutputArchive>(cereal::JSONOutputArchive&);
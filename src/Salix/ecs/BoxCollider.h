@@ -2,6 +2,7 @@
 #pragma once
 #include <Salix/core/Core.h>
 #include <Salix/ecs/Element.h>
+#include <Salix/ecs/ElementStorage.h>
 #include <Salix/math/Vector3.h>
 #include <memory>
 #include <cereal/access.hpp>
@@ -15,6 +16,7 @@ namespace Salix {
         BoxCollider();
         ~BoxCollider() override;
         const char* get_class_name() const override { return "BoxCollider"; }
+        bool is_update_thread_safe() const override { return true; }
         void initialize() override;
         void on_load(const InitContext& context) override;
         void update(float delta_time) override;
@@ -22,13 +24,21 @@ namespace Salix {
         const Vector3& get_size() const;
         void set_size(const Vector3& new_size);
        
+        // Position of this collider's data inside ElementStorage::box_colliders().
+        uint32_t get_storage_slot() const { return slot; }
+
     private:
         friend class cereal::access;
         template <class Archive>
         void serialize(Archive& archive);
 
-        struct Pimpl;
-        std::unique_ptr<Pimpl> pimpl;
+        // Thin handle over a slot in the shared BoxCollider chunk storage.
+        uint32_t slot = INVALID_ELEMENT_SLOT;
+        BoxColliderChunk* chunk = nullptr;
+        uint32_t index = 0;
+
+        BoxCollider(const BoxCollider&) = delete;
+        BoxCollider& operator=(const BoxCollider&) = delete;
     };
 
 }
\ No newline at end of file
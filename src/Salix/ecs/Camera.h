@@ -18,6 +18,7 @@ public:
     Camera();
     ~Camera() override;
     const char* get_class_name() const override { return "Camera"; }
+    bool is_update_thread_safe() const override { return true; }
     // --- Core Camera Methods ---
 
     // Sets the camera's projection mode.
@@ -3,6 +3,7 @@
 #include <Salix/core/Core.h>
 #include <Salix/core/InitContext.h>
 #include <Salix/core/SimpleGuid.h>
+#include <Salix/core/PoolAllocator.h>
 #include <cereal/cereal.hpp>
 #include <iostream>
 
@@ -16,6 +17,12 @@ namespace Salix {
             Element() : id(SimpleGuid::generate()) {}
             // A virtual destructor is essential for any class with virtual methods
             virtual ~Element() = default;
+            // Elements come from the PoolAllocator. Because the destructor is virtual,
+            // the sized delete receives the size of the most-derived type, so each
+            // concrete element returns its block to the pool it came from.
+            static void* operator new(std::size_t size) { return PoolAllocator::allocate(size); }
+            static void* operator new(std::size_t, void* where) noexcept { return where; }
+            static void operator delete(void* ptr, std::size_t size) noexcept { PoolAllocator::deallocate(ptr, size); }
             // NEW: Add a pure virtual function to get the element's type name.
             // Every concrete element (Transform, Camera, etc.) MUST implement this.
             virtual const char* get_class_name() const = 0;
@@ -30,6 +37,16 @@ namespace Salix {
             virtual void on_load(const InitContext& context) {(void) context.asset_manager;}  // Useful for RenderableElement - types.
             virtual void initialize() {}
             virtual void update(float /*delta_time*/) {}
+            // Return true only if update() touches nothing but this element's own
+            // state, so Realm::update may run it on a worker thread. Scripts and
+            // anything with shared side effects keep the default and stay on the
+            // main thread.
+            virtual bool is_update_thread_safe() const { return false; }
+            // Opt-in for Realm's parallel update. Return true only when update()
+            // does enough work to be worth a worker thread; types with empty or
+            // trivial updates leave it off, so entities made only of them are
+            // never dispatched.
+            virtual bool wants_parallel_update() const { return false; }
             virtual void shutdown() {}
             Entity* get_owner() { return owner; }
             void set_owner(Entity* owner_entity) {
@@ -0,0 +1,17 @@
+// =================================================================================
+// Filename:    Salix/ecs/ElementStorage.cpp
+// Author:      SalixGameStudio
+// Description: Implements the process-wide ElementStorage singleton.
+// =================================================================================
+#include <Salix/ecs/ElementStorage.h>
+
+namespace Salix {
+
+    ElementStorage& ElementStorage::get() {
+        // Intentionally never destroyed: elements owned by static objects may still
+        // release their slots during static destruction, after this would be gone.
+        static ElementStorage* instance = new ElementStorage();
+        return *instance;
+    }
+
+} // namespace Salix
@@ -0,0 +1,210 @@
+// =================================================================================
+// Filename:    Salix/ecs/ElementStorage.h
+// Author:      SalixGameStudio
+// Description: Declares the chunked, structure-of-arrays storage that backs the
+//              built-in Transform, Sprite2D and BoxCollider elements.
+// =================================================================================
+#pragma once
+
+#include <Salix/core/Core.h>
+#include <Salix/core/PoolAllocator.h>
+#include <Salix/math/Vector3.h>
+#include <Salix/math/Color.h>
+#include <glm/glm.hpp>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace Salix {
+
+    // Forward declarations
+    class Transform;
+    class Sprite2D;
+    class BoxCollider;
+    class ITexture;
+
+    // Number of element slots held by a single chunk. Chunks are never moved or
+    // freed while the storage is alive, so references into them stay valid for
+    // the whole lifetime of the element that owns the slot.
+    constexpr uint32_t ELEMENT_CHUNK_CAPACITY = 256;
+    constexpr uint32_t INVALID_ELEMENT_SLOT = 0xFFFFFFFFu;
+
+    // --- Per-type chunk layouts ---
+    // Hot data (what update/render passes read every frame) comes first, cold
+    // runtime bookkeeping last. A null owner marks a free slot.
+
+    // Bits in TransformChunk::dirty_flags. A world-dirty transform always has
+    // world-dirty descendants, so invalidation can stop at the first dirty node.
+    constexpr uint8_t TRANSFORM_LOCAL_DIRTY = 1 << 0;       // local_matrices is stale.
+    constexpr uint8_t TRANSFORM_WORLD_DIRTY = 1 << 1;       // world_matrices is stale.
+    constexpr uint8_t TRANSFORM_DECOMPOSED_DIRTY = 1 << 2;  // world_rotations/world_scales are stale.
+    constexpr uint8_t TRANSFORM_NO_PREVIOUS = 1 << 3;       // previous_* not captured yet; don't interpolate.
+    constexpr uint8_t TRANSFORM_ALL_DIRTY = TRANSFORM_LOCAL_DIRTY | TRANSFORM_WORLD_DIRTY | TRANSFORM_DECOMPOSED_DIRTY;
+
+    struct TransformChunk {
+        Vector3 positions[ELEMENT_CHUNK_CAPACITY];
+        Vector3 rotations[ELEMENT_CHUNK_CAPACITY];
+        Vector3 scales[ELEMENT_CHUNK_CAPACITY];
+        uint8_t dirty_flags[ELEMENT_CHUNK_CAPACITY] = {};
+        glm::mat4 local_matrices[ELEMENT_CHUNK_CAPACITY];
+        glm::mat4 world_matrices[ELEMENT_CHUNK_CAPACITY];
+        Vector3 world_rotations[ELEMENT_CHUNK_CAPACITY];
+        Vector3 world_scales[ELEMENT_CHUNK_CAPACITY];
+        Transform* parents[ELEMENT_CHUNK_CAPACITY] = {};
+        Transform* owners[ELEMENT_CHUNK_CAPACITY] = {};
+        PoolVector<Transform*> children[ELEMENT_CHUNK_CAPACITY];
+        // Local state as of the start of the last fixed-step tick, for render interpolation.
+        Vector3 previous_positions[ELEMENT_CHUNK_CAPACITY];
+        Vector3 previous_rotations[ELEMENT_CHUNK_CAPACITY];
+        Vector3 previous_scales[ELEMENT_CHUNK_CAPACITY];
+    };
+
+    struct Sprite2DChunk {
+        Color colors[ELEMENT_CHUNK_CAPACITY];
+        int sorting_layers[ELEMENT_CHUNK_CAPACITY] = {};
+        ITexture* textures[ELEMENT_CHUNK_CAPACITY] = {};
+        Sprite2D* owners[ELEMENT_CHUNK_CAPACITY] = {};
+    };
+
+    struct BoxColliderChunk {
+        Vector3 sizes[ELEMENT_CHUNK_CAPACITY];
+        BoxCollider* owners[ELEMENT_CHUNK_CAPACITY] = {};
+    };
+
+
+    // A growable pool of fixed-size chunks. Slots are plain indices; the chunk
+    // is slot / ELEMENT_CHUNK_CAPACITY and the position inside it is the remainder.
+    //
+    // Elements may be created on any thread, and a new chunk grows the chunk
+    // table, so every read of the table or of the slot counts takes the same
+    // lock as allocate(). The chunks themselves
+    // never move; a Chunk& stays valid without the lock.
+    template<typename Chunk>
+    class ChunkedElementStorage {
+        public:
+            template<typename Owner>
+            uint32_t allocate(Owner* owner) {
+                std::lock_guard<std::mutex> lock(mutex);
+                uint32_t slot;
+                if (!free_slots.empty()) {
+                    slot = free_slots.back();
+                    free_slots.pop_back();
+                } else {
+                    slot = high_water_mark++;
+                    if (slot / ELEMENT_CHUNK_CAPACITY >= chunks.size()) {
+                        chunks.push_back(std::make_unique<Chunk>());
+                    }
+                }
+                chunks[slot / ELEMENT_CHUNK_CAPACITY]->owners[get_index_in_chunk(slot)] = owner;
+                ++live_count;
+                return slot;
+            }
+
+            void release(uint32_t slot) {
+                if (slot == INVALID_ELEMENT_SLOT) return;
+                std::lock_guard<std::mutex> lock(mutex);
+                chunks[slot / ELEMENT_CHUNK_CAPACITY]->owners[get_index_in_chunk(slot)] = nullptr;
+                free_slots.push_back(slot);
+                --live_count;
+            }
+
+            Chunk& get_chunk_of(uint32_t slot) { return get_chunk(slot / ELEMENT_CHUNK_CAPACITY); }
+            const Chunk& get_chunk_of(uint32_t slot) const {
+                std::lock_guard<std::mutex> lock(mutex);
+                return *chunks[slot / ELEMENT_CHUNK_CAPACITY];
+            }
+            static uint32_t get_index_in_chunk(uint32_t slot) { return slot % ELEMENT_CHUNK_CAPACITY; }
+
+            size_t get_chunk_count() const {
+                std::lock_guard<std::mutex> lock(mutex);
+                return chunks.size();
+            }
+            Chunk& get_chunk(size_t chunk_index) {
+                std::lock_guard<std::mutex> lock(mutex);
+                return *chunks[chunk_index];
+            }
+            uint32_t get_live_count() const {
+                std::lock_guard<std::mutex> lock(mutex);
+                return live_count;
+            }
+
+            // Number of slots in chunk_index that have ever been handed out. Slots
+            // past this point have never been used and can be skipped entirely.
+            uint32_t get_used_in_chunk(size_t chunk_index) const {
+                std::lock_guard<std::mutex> lock(mutex);
+                return used_in_chunk(chunk_index);
+            }
+
+            // Calls func(chunk, index_in_chunk) for every live slot, chunk by chunk,
+            // so the arrays are walked front to back. The chunks are taken under
+            // the lock and walked without it, so func may create elements (they
+            // are not visited); elements must not be destroyed on other threads
+            // during the walk.
+            template<typename Func>
+            void for_each_live(Func&& func) {
+                std::vector<std::pair<Chunk*, uint32_t>> used_chunks;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    used_chunks.reserve(chunks.size());
+                    for (size_t c = 0; c < chunks.size(); ++c) {
+                        used_chunks.emplace_back(chunks[c].get(), used_in_chunk(c));
+                    }
+                }
+                for (const auto& [chunk_ptr, used] : used_chunks) {
+                    Chunk& chunk = *chunk_ptr;
+                    for (uint32_t i = 0; i < used; ++i) {
+                        if (chunk.owners[i]) {
+                            func(chunk, i);
+                        }
+                    }
+                }
+            }
+
+        private:
+            // Caller holds the lock.
+            uint32_t used_in_chunk(size_t chunk_index) const {
+                const uint32_t first = static_cast<uint32_t>(chunk_index) * ELEMENT_CHUNK_CAPACITY;
+                if (high_water_mark <= first) return 0;
+                const uint32_t used = high_water_mark - first;
+                return used < ELEMENT_CHUNK_CAPACITY ? used : ELEMENT_CHUNK_CAPACITY;
+            }
+
+            std::vector<std::unique_ptr<Chunk>> chunks;
+            std::vector<uint32_t> free_slots;
+            uint32_t high_water_mark = 0;
+            uint32_t live_count = 0;
+            mutable std::mutex mutex;
+    };
+
+
+    // Process-wide owner of the built-in element stores. Elements may be created
+    // outside of any Realm (e.g. on the stack in tests), so the storage is global
+    // rather than per-realm.
+    class SALIX_API ElementStorage {
+        public:
+            static ElementStorage& get();
+
+            ChunkedElementStorage<TransformChunk>& transforms() { return transform_storage; }
+            ChunkedElementStorage<Sprite2DChunk>& sprites() { return sprite_storage; }
+            ChunkedElementStorage<BoxColliderChunk>& box_colliders() { return box_collider_storage; }
+
+            // Bumped whenever a transform is created, destroyed or reparented, so a
+            // cached traversal order (see TransformHierarchyPass) knows to rebuild.
+            uint64_t get_transform_hierarchy_version() const { return transform_hierarchy_version.load(std::memory_order_acquire); }
+            void bump_transform_hierarchy_version() { transform_hierarchy_version.fetch_add(1, std::memory_order_acq_rel); }
+
+        private:
+            ElementStorage() = default;
+            ElementStorage(const ElementStorage&) = delete;
+            ElementStorage& operator=(const ElementStorage&) = delete;
+
+            ChunkedElementStorage<TransformChunk> transform_storage;
+            ChunkedElementStorage<Sprite2DChunk> sprite_storage;
+            ChunkedElementStorage<BoxColliderChunk> box_collider_storage;
+            std::atomic<uint64_t> transform_hierarchy_version{0};
+    };
+
+} // namespace Salix
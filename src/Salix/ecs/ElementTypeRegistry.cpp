@@ -0,0 +1,203 @@
+// =================================================================================
+// Filename:    Salix/ecs/ElementTypeRegistry.cpp
+// Author:      SalixGameStudio
+// Description: Implements the ElementTypeRegistry.
+// =================================================================================
+#include <Salix/ecs/ElementTypeRegistry.h>
+#include <Salix/ecs/Transform.h>
+#include <Salix/ecs/BoxCollider.h>
+#include <Salix/ecs/Sprite2D.h>
+#include <Salix/ecs/Camera.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace Salix {
+
+    namespace {
+        template<typename T>
+        bool matches_builtin(const Element* element) {
+            return dynamic_cast<const T*>(element) != nullptr;
+        }
+
+        // One interned class name. Never freed, so readers may hold on to it.
+        struct ClassNameEntry {
+            std::string name;
+            size_t hash = 0;
+            ElementClassNameIds ids;
+        };
+
+        // Open-addressed and filled to at most three quarters, so a probe
+        // always reaches an empty slot.
+        constexpr size_t CLASS_NAME_SLOTS = 512;
+        constexpr size_t MAX_CLASS_NAMES = CLASS_NAME_SLOTS / 4 * 3;
+    }
+
+
+    struct ElementTypeRegistry::State {
+        std::mutex mutex;
+        std::unordered_map<std::type_index, ElementTypeId> ids;
+        ElementTypeId next_id = 0;
+
+        // Written under the mutex, read without it. An entry is fully built
+        // before it is published to its slot.
+        std::atomic<ClassNameEntry*> class_names[CLASS_NAME_SLOTS] = {};
+        size_t class_name_count = 0;
+        std::atomic<bool> class_names_full{false};
+        // Handed out for names that were never registered, or that could
+        // not be interned once the table filled up.
+        ElementClassNameIds unknown_name;
+        ElementClassNameIds unlisted_name;
+
+        // Read without the mutex by Entity; written under it. A type's
+        // epoch is stored after its matcher, so a matching epoch means
+        // the matcher is visible.
+        std::atomic<ElementMatcher> matchers[MAX_ELEMENT_TYPES] = {};
+        std::atomic<uint32_t> matcher_epochs[MAX_ELEMENT_TYPES] = {};
+        std::atomic<uint32_t> matcher_epoch{0};
+
+        State() {
+            unlisted_name.unmapped.store(true, std::memory_order_relaxed);
+            // Seed the built-ins in the same order as their fixed constants,
+            // with their matchers, so no entity ever scans for them.
+            seed(typeid(Transform), "Transform", TRANSFORM_TYPE_ID, &matches_builtin<Transform>);
+            seed(typeid(BoxCollider), "BoxCollider", BOX_COLLIDER_TYPE_ID, &matches_builtin<BoxCollider>);
+            seed(typeid(Sprite2D), "Sprite2D", SPRITE2D_TYPE_ID, &matches_builtin<Sprite2D>);
+            seed(typeid(Camera), "Camera", CAMERA_TYPE_ID, &matches_builtin<Camera>);
+        }
+
+        void seed(const std::type_info& type_info, const char* class_name, ElementTypeId type_id, ElementMatcher matcher) {
+            ids[std::type_index(type_info)] = type_id;
+            add_class_name(class_name, type_id);
+            next_id = std::max(next_id, type_id + 1);
+            set_matcher(type_id, matcher);
+        }
+
+        // Caller must hold the mutex.
+        ElementTypeId find_or_assign(const std::type_info& type_info) {
+            auto [it, inserted] = ids.try_emplace(std::type_index(type_info), next_id);
+            if (inserted) {
+                ++next_id;
+            }
+            return it->second;
+        }
+
+        // Safe without the mutex.
+        ClassNameEntry* find_class_name(std::string_view class_name, size_t hash) const {
+            for (size_t slot = hash % CLASS_NAME_SLOTS; ; slot = (slot + 1) % CLASS_NAME_SLOTS) {
+                ClassNameEntry* entry = class_names[slot].load(std::memory_order_acquire);
+                if (!entry) return nullptr;
+                if (entry->hash == hash && entry->name == class_name) return entry;
+            }
+        }
+
+        // Caller must hold the mutex.
+        void add_class_name(std::string_view class_name, ElementTypeId type_id) {
+            const size_t hash = std::hash<std::string_view>{}(class_name);
+            ClassNameEntry* entry = find_class_name(class_name, hash);
+            if (!entry) {
+                if (class_name_count == MAX_CLASS_NAMES) {
+                    class_names_full.store(true, std::memory_order_release);
+                    return;
+                }
+                entry = new ClassNameEntry();
+                entry->name = class_name;
+                entry->hash = hash;
+                size_t slot = hash % CLASS_NAME_SLOTS;
+                while (class_names[slot].load(std::memory_order_relaxed)) {
+                    slot = (slot + 1) % CLASS_NAME_SLOTS;
+                }
+                class_names[slot].store(entry, std::memory_order_release);
+                ++class_name_count;
+            }
+
+            ElementClassNameIds& named_ids = entry->ids;
+            if (type_id >= MAX_ELEMENT_TYPES) {
+                named_ids.unmapped.store(true, std::memory_order_release);
+                return;
+            }
+            const uint32_t count = named_ids.count.load(std::memory_order_relaxed);
+            if (std::find(named_ids.ids, named_ids.ids + count, type_id) != named_ids.ids + count) return;
+            named_ids.ids[count] = type_id;
+            named_ids.count.store(count + 1, std::memory_order_release);
+        }
+
+        // Caller must hold the mutex (or be the constructor).
+        void set_matcher(ElementTypeId type_id, ElementMatcher matcher) {
+            // Epoch 0 means "never set"; real epochs start at 1.
+            if (matcher_epochs[type_id].load(std::memory_order_relaxed) != 0) return;
+            matchers[type_id].store(matcher, std::memory_order_relaxed);
+            const uint32_t epoch = matcher_epoch.load(std::memory_order_relaxed) + 1;
+            matcher_epochs[type_id].store(epoch, std::memory_order_release);
+            matcher_epoch.store(epoch, std::memory_order_release);
+        }
+    };
+
+
+    ElementTypeRegistry::State& ElementTypeRegistry::state() {
+        static State instance;
+        return instance;
+    }
+
+
+    ElementTypeId ElementTypeRegistry::get_id(const std::type_info& type_info) {
+        State& registry = state();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        return registry.find_or_assign(type_info);
+    }
+
+
+    ElementTypeId ElementTypeRegistry::register_class(const std::type_info& type_info, const char* class_name) {
+        State& registry = state();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        ElementTypeId type_id = registry.find_or_assign(type_info);
+        if (class_name) {
+            registry.add_class_name(class_name, type_id);
+        }
+        return type_id;
+    }
+
+
+    const ElementClassNameIds& ElementTypeRegistry::get_ids_for_class_name(const std::string& class_name) {
+        const State& registry = state();
+        if (const ClassNameEntry* entry = registry.find_class_name(class_name, std::hash<std::string>{}(class_name))) {
+            return entry->ids;
+        }
+        return registry.class_names_full.load(std::memory_order_acquire) ? registry.unlisted_name : registry.unknown_name;
+    }
+
+
+    ElementTypeId ElementTypeRegistry::get_registered_count() {
+        State& registry = state();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        return registry.next_id;
+    }
+
+
+    void ElementTypeRegistry::set_matcher(ElementTypeId type_id, ElementMatcher matcher) {
+        if (type_id >= MAX_ELEMENT_TYPES || !matcher) return;
+        State& registry = state();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.set_matcher(type_id, matcher);
+    }
+
+
+    uint32_t ElementTypeRegistry::get_matcher_epoch() {
+        return state().matcher_epoch.load(std::memory_order_acquire);
+    }
+
+
+    ElementMatcher ElementTypeRegistry::get_matcher(ElementTypeId type_id, uint32_t epoch) {
+        return has_matcher_at(type_id, epoch) ? state().matchers[type_id].load(std::memory_order_relaxed) : nullptr;
+    }
+
+
+    bool ElementTypeRegistry::has_matcher_at(ElementTypeId type_id, uint32_t epoch) {
+        if (type_id >= MAX_ELEMENT_TYPES) return false;
+        const uint32_t set_at = state().matcher_epochs[type_id].load(std::memory_order_acquire);
+        return set_at != 0 && set_at <= epoch;
+    }
+
+} // namespace Salix
@@ -0,0 +1,117 @@
+// =================================================================================
+// Filename:    Salix/ecs/ElementTypeRegistry.h
+// Author:      SalixGameStudio
+// Description: Declares small integer type IDs for Element types, used by Entity
+//              to keep a per-entity component bitmask and slot table.
+// =================================================================================
+#pragma once
+
+#include <Salix/core/Core.h>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
+
+namespace Salix {
+
+    // Forward declarations
+    class Element;
+    class Transform;
+    class BoxCollider;
+    class Sprite2D;
+    class Camera;
+
+    using ElementTypeId = uint32_t;
+    using ElementTypeMask = uint64_t;
+
+    // One bit per type in an ElementTypeMask. Types registered past this limit
+    // still work, they just take the slower scanning path in Entity.
+    constexpr ElementTypeId MAX_ELEMENT_TYPES = 64;
+    constexpr ElementTypeId INVALID_ELEMENT_TYPE_ID = 0xFFFFFFFFu;
+
+    // Built-in elements have fixed IDs so their lookups compile to constants.
+    constexpr ElementTypeId TRANSFORM_TYPE_ID   = 0;
+    constexpr ElementTypeId BOX_COLLIDER_TYPE_ID = 1;
+    constexpr ElementTypeId SPRITE2D_TYPE_ID    = 2;
+    constexpr ElementTypeId CAMERA_TYPE_ID      = 3;
+
+    inline ElementTypeMask element_type_bit(ElementTypeId type_id) {
+        return type_id < MAX_ELEMENT_TYPES ? (ElementTypeMask(1) << type_id) : 0;
+    }
+
+    // True if the element is, or derives from, the type the matcher was made for.
+    using ElementMatcher = bool (*)(const Element*);
+
+    // The type IDs registered under one class name. Each list is interned once
+    // and only ever appended to, so it is read without the registry's lock.
+    class ElementClassNameIds {
+        public:
+            uint32_t size() const { return count.load(std::memory_order_acquire); }
+            ElementTypeId operator[](uint32_t index) const { return ids[index]; }
+            // A type with this name has no mask bit (or the name could not be
+            // interned), so callers must fall back to scanning.
+            bool has_unmapped() const { return unmapped.load(std::memory_order_acquire); }
+
+        private:
+            friend class ElementTypeRegistry;
+            ElementTypeId ids[MAX_ELEMENT_TYPES] = {};
+            std::atomic<uint32_t> count{0};
+            std::atomic<bool> unmapped{false};
+    };
+
+    // Hands out IDs for every C++ type that is stored on, or queried from, an
+    // Entity. IDs are keyed on std::type_index so the engine, editor and game
+    // DLLs all agree on them.
+    class SALIX_API ElementTypeRegistry {
+        public:
+            // Returns the ID for the type, assigning the next free one if needed.
+            static ElementTypeId get_id(const std::type_info& type_info);
+
+            // Associates a concrete type with the name its get_class_name() returns.
+            // Called by Entity whenever an element is added.
+            static ElementTypeId register_class(const std::type_info& type_info, const char* class_name);
+
+            // All type IDs whose elements report this class name. Several C++ types
+            // can share a name (e.g. scripts that keep CppScript's class name).
+            // The returned list stays valid and may grow if another thread
+            // registers a type under the same name.
+            static const ElementClassNameIds& get_ids_for_class_name(const std::string& class_name);
+
+            static ElementTypeId get_registered_count();
+
+            // Entity fills its slot table from these when elements are added, so
+            // a typed lookup also finds subclasses without searching. The
+            // built-in types have theirs from the start; other types get one on
+            // their first lookup. The first matcher set for a type wins. Each one is stamped with the matcher
+            // epoch it was set in; a slot table filled at an earlier epoch has
+            // no answer for that type yet.
+            static void set_matcher(ElementTypeId type_id, ElementMatcher matcher);
+            static uint32_t get_matcher_epoch();
+            // The type's matcher if it was set at or before epoch, else nullptr.
+            static ElementMatcher get_matcher(ElementTypeId type_id, uint32_t epoch);
+            static bool has_matcher_at(ElementTypeId type_id, uint32_t epoch);
+
+        private:
+            struct State;
+            static State& state();
+    };
+
+
+    // Resolves a type to its ID. The result is cached per instantiation, so
+    // after the first call this is a single static load.
+    template<typename T>
+    struct ElementTypeIdOf {
+        static ElementTypeId get() {
+            static const ElementTypeId type_id = ElementTypeRegistry::get_id(typeid(T));
+            return type_id;
+        }
+    };
+
+    template<> struct ElementTypeIdOf<Transform>   { static constexpr ElementTypeId get() { return TRANSFORM_TYPE_ID; } };
+    template<> struct ElementTypeIdOf<BoxCollider> { static constexpr ElementTypeId get() { return BOX_COLLIDER_TYPE_ID; } };
+    template<> struct ElementTypeIdOf<Sprite2D>    { static constexpr ElementTypeId get() { return SPRITE2D_TYPE_ID; } };
+    template<> struct ElementTypeIdOf<Camera>      { static constexpr ElementTypeId get() { return CAMERA_TYPE_ID; } };
+
+} // namespace Salix
@@ -5,15 +5,18 @@
 // =================================================================================
 #include <Salix/core/InitContext.h>
 #include <Salix/ecs/Entity.h>
+#include <Salix/ecs/Realm.h>
 #include <Salix/ecs/Element.h>
 #include <Salix/ecs/RenderableElement.h>
 #include <Salix/ecs/Transform.h>
 #include <Salix/ecs/BoxCollider.h>
 #include <Salix/assets/AssetManager.h>
+#include <Salix/core/PoolAllocator.h>
 #include <cereal/cereal.hpp>
 #include <cereal/archives/json.hpp>
 #include <cereal/archives/binary.hpp>
 #include <Salix/core/SerializationRegistrations.h>
+#include <algorithm>
 namespace Salix {
 
 
@@ -23,14 +26,22 @@ namespace Salix {
         Entity* parent = nullptr;
         bool is_purged_flag = false;
         bool is_visible = true;
-        std::vector<Entity*>children;
-        std::vector<std::unique_ptr<Element>> all_elements;
-        std::vector<RenderableElement*> renderable_elements;
+        // The child and element lists draw from the pools too, so their buffers
+        // are recycled along with the entity. The name stays a std::string;
+        // names short enough for its inline buffer never allocate.
+        PoolVector<Entity*> children;
+        PoolVector<std::unique_ptr<Element>> all_elements;
+        PoolVector<RenderableElement*> renderable_elements;
         Transform* transform = nullptr;
         SimpleGuid id = SimpleGuid::generate();
         InitContext context;
         BoxCollider* box_collider = nullptr;
+        bool update_thread_safe = true;
+        bool parallel_requested = false;
         Pimpl() = default;
+
+        static void* operator new(std::size_t size) { return PoolAllocator::allocate(size); }
+        static void operator delete(void* ptr, std::size_t size) noexcept { PoolAllocator::deallocate(ptr, size); }
         /*template<class Archive>
         void serialize (Archive & archive) {
             archive(cereal::make_nvp("name", name), cereal::make_nvp("id", id),
@@ -40,6 +51,8 @@ namespace Salix {
 
     // --- Constructor and Destructor ---
     Entity::Entity() : pimpl(std::make_unique<Pimpl>()) {
+        // Room for the mandatory elements plus a couple more without regrowing.
+        pimpl->all_elements.reserve(4);
         // Automatically add and store a pointer to the mandatory Transform component.
         pimpl->transform = add_element<Transform>();
         pimpl->box_collider = add_element<BoxCollider>();
@@ -76,6 +89,7 @@ namespace Salix {
         // Reset runtime caches before populating them
         pimpl->transform = nullptr;
         pimpl->renderable_elements.clear();
+        rebuild_element_lookup();
 
         // For each element that was just deserialized...
         for (auto& element : pimpl->all_elements) {
@@ -114,6 +128,14 @@ namespace Salix {
         }
     }
 
+    bool Entity::is_update_thread_safe() const {
+        return pimpl->update_thread_safe;
+    }
+
+    bool Entity::wants_parallel_update() const {
+        return pimpl->update_thread_safe && pimpl->parallel_requested;
+    }
+
     void Entity::render(IRenderer* renderer) {
         if (pimpl->is_purged_flag) return;
         for (auto& element : pimpl->renderable_elements) {
@@ -154,8 +176,12 @@ namespace Salix {
     }
 
     void Entity::set_id(SimpleGuid id) {
+        const SimpleGuid old_id = pimpl->id;
         pimpl->id = SimpleGuid::invalid();
         pimpl->id = id;
+        if (owning_realm) {
+            owning_realm->on_entity_id_changed(this, old_id);
+        }
     }
 
     void Entity::report_ids() const {
@@ -190,6 +216,21 @@ namespace Salix {
         Element* found_element = nullptr;
         if (element_type_name.empty()) return found_element;
         if (pimpl->is_purged_flag) return found_element;
+        const ElementClassNameIds& type_ids = ElementTypeRegistry::get_ids_for_class_name(element_type_name);
+        // Types registered past MAX_ELEMENT_TYPES have no slot to check.
+        bool needs_scan = type_ids.has_unmapped();
+        const uint32_t type_count = type_ids.size();
+        for (uint32_t i = 0; i < type_count; ++i) {
+            const ElementTypeId type_id = type_ids[i];
+            if (element_mask & element_type_bit(type_id)) {
+                // The slot holds the first match, which may be a subclass with another name.
+                Element* slot_element = element_slots[type_id];
+                if (slot_element && element_type_name == slot_element->get_class_name()) return slot_element;
+                needs_scan = true;
+            }
+        }
+        if (!needs_scan) return nullptr;  // No Element found by that class name.
+
         for (auto& element : pimpl->all_elements) {
             if (element_type_name == element->get_class_name()) {
                  return element.get();
@@ -309,7 +350,7 @@ namespace Salix {
     }
 
 
-    const std::vector<Entity*>& Entity::get_children() const {
+    const PoolVector<Entity*>& Entity::get_children() const {
         return pimpl->children;
     }
 
@@ -362,11 +403,85 @@ namespace Salix {
         if (renderable) {
             pimpl->renderable_elements.push_back(renderable);
         }
+
+        Element* raw_ptr = element.get();
+        pimpl->update_thread_safe = pimpl->update_thread_safe && raw_ptr->is_update_thread_safe();
+        pimpl->parallel_requested = pimpl->parallel_requested || raw_ptr->wants_parallel_update();
+        const ElementTypeId type_id = ElementTypeRegistry::register_class(typeid(*raw_ptr), raw_ptr->get_class_name());
+        const ElementTypeMask old_mask = element_mask;
+        element_mask |= element_type_bit(type_id);
+
         // Add the new element to the master list that owns its memory.
         pimpl->all_elements.push_back(std::move(element));
+
+        // Slots already filled keep their (earlier) element. If types gained
+        // matchers since the table was filled, the older elements need
+        // matching against them too, so the whole table is refilled.
+        if (slots_epoch == ElementTypeRegistry::get_matcher_epoch()) {
+            fill_element_slots(raw_ptr, type_id);
+        } else {
+            rebuild_element_lookup();
+        }
+
+        if (owning_realm && element_mask != old_mask) {
+            owning_realm->on_entity_elements_changed(this, old_mask);
+        }
+    }
+
+    Element* Entity::find_first_element_matching(bool (*matches)(const Element*)) const {
+        for (const auto& element : pimpl->all_elements) {
+            if (element && matches(element.get())) {
+                return element.get();
+            }
+        }
+        return nullptr;
+    }
+
+    // Rebuilds the lookup table from scratch, e.g. after deserialization has
+    // replaced the element list wholesale.
+    void Entity::rebuild_element_lookup() {
+        const ElementTypeMask old_mask = element_mask;
+        element_mask = 0;
+        match_mask = 0;
+        slots_epoch = ElementTypeRegistry::get_matcher_epoch();
+        pimpl->update_thread_safe = true;
+        pimpl->parallel_requested = false;
+        for (const auto& element : pimpl->all_elements) {
+            if (!element) continue;
+            pimpl->update_thread_safe = pimpl->update_thread_safe && element->is_update_thread_safe();
+            pimpl->parallel_requested = pimpl->parallel_requested || element->wants_parallel_update();
+            const ElementTypeId type_id = ElementTypeRegistry::register_class(typeid(*element), element->get_class_name());
+            element_mask |= element_type_bit(type_id);
+            fill_element_slots(element.get(), type_id);
+        }
+        if (owning_realm && element_mask != old_mask) {
+            owning_realm->on_entity_elements_changed(this, old_mask);
+        }
+    }
+
+    // Gives element every empty slot whose type it matches.
+    void Entity::fill_element_slots(Element* element, ElementTypeId concrete_type_id) {
+        const ElementTypeId type_count = std::min(ElementTypeRegistry::get_registered_count(), MAX_ELEMENT_TYPES);
+        for (ElementTypeId type_id = 0; type_id < type_count; ++type_id) {
+            const ElementTypeMask type_bit = element_type_bit(type_id);
+            if (match_mask & type_bit) continue;
+            const ElementMatcher matcher = ElementTypeRegistry::get_matcher(type_id, slots_epoch);
+            if (matcher ? matcher(element) : type_id == concrete_type_id) {
+                element_slots[type_id] = element;
+                match_mask |= type_bit;
+            }
+        }
     }
 
     Element* Entity::get_element_internal(const std::type_info& type_info) {
+        const ElementTypeId type_id = ElementTypeRegistry::get_id(type_info);
+        const ElementTypeMask type_bit = element_type_bit(type_id);
+        if (type_bit) {
+            if (!(element_mask & type_bit)) return nullptr;
+            // The slot holds the first match, which may be a subclass.
+            Element* slot_element = element_slots[type_id];
+            if (slot_element && typeid(*slot_element) == type_info) return slot_element;
+        }
         for (auto& element : pimpl->all_elements) {
             // Use typeid to check if an element matches the requested type.
             if (typeid(*element) == type_info) {
@@ -378,15 +493,36 @@ namespace Salix {
 
 
     const Element* Entity::get_element_internal(const std::type_info& type_info) const {
-        for (const auto& element : pimpl->all_elements) {
-            if (typeid(*element) == type_info) {
-                return element.get();
-            }
+        return const_cast<Entity*>(this)->get_element_internal(type_info);
+    }
+
+    size_t Entity::get_element_count() const {
+        return pimpl->all_elements.size();
+    }
+
+    const std::unique_ptr<Element>& Entity::get_element_owner(size_t index) const {
+        return pimpl->all_elements[index];
+    }
+
+    // Mirrors what serialize() does on load: the list is swapped wholesale and
+    // on_load() later re-links owners and renderables.
+    void Entity::replace_elements(std::vector<std::unique_ptr<Element>>& elements) {
+        pimpl->all_elements.clear();
+        pimpl->all_elements.reserve(elements.size());
+        for (auto& element : elements) {
+            pimpl->all_elements.push_back(std::move(element));
         }
-        return nullptr;
+        elements.clear();
+        rebuild_element_lookup();
     }
 
     void Entity::set_name(const std::string& new_name) {
+        if (owning_realm && pimpl->name != new_name) {
+            const std::string old_name = pimpl->name;
+            pimpl->name = new_name;
+            owning_realm->on_entity_renamed(this, old_name);
+            return;
+        }
         pimpl->name = new_name;
     }
 
@@ -404,6 +540,10 @@ namespace Salix {
         cereal::make_nvp("id", pimpl->id),
         cereal::make_nvp("elements", pimpl->all_elements)
         );
+        // Loading replaces the element list, so the type slots must follow it.
+        if constexpr (Archive::is_loading::value) {
+            rebuild_element_lookup();
+        }
     }
 
     template void SALIX_API Entity::serialize<cereal::JSONOutputArchive>(cereal::JSONOutputArchive &);
@@ -7,6 +7,8 @@
 
 #include <Salix/core/Core.h>
 #include <Salix/core/SimpleGuid.h>
+#include <Salix/core/PoolAllocator.h>
+#include <Salix/ecs/ElementTypeRegistry.h>
 #include <cereal/access.hpp>
 #include <cereal/types/string.hpp>
 #include <cereal/types/vector.hpp>
@@ -14,6 +16,7 @@
 #include <vector>
 #include <memory>
 #include <typeinfo> // For the get_element helper
+#include <type_traits>
 #include <string>
 
 namespace Salix {
@@ -23,6 +26,7 @@ namespace Salix {
     class Transform;
     class IRenderer;
     class AssetManager;
+    class Realm;
     struct InitContext;
 
     class SALIX_API Entity{
@@ -30,8 +34,19 @@ namespace Salix {
             Entity();
             ~Entity(); // Destructor MUST be in the header
 
+            // Entity blocks are recycled through the PoolAllocator.
+            static void* operator new(std::size_t size) { return PoolAllocator::allocate(size); }
+            static void* operator new(std::size_t, void* where) noexcept { return where; }
+            static void operator delete(void* ptr, std::size_t size) noexcept { PoolAllocator::deallocate(ptr, size); }
+
             void on_load(const InitContext& new_context);
             void update(float delta_time);
+            // True when every element declares a thread-safe update, so the whole
+            // entity may be updated on a worker thread.
+            bool is_update_thread_safe() const;
+            // True when the entity is thread-safe and at least one element opts
+            // in to parallel update.
+            bool wants_parallel_update() const;
             void render(IRenderer* renderer);
             Transform* get_transform() const;
 
@@ -41,7 +56,10 @@ namespace Salix {
 
             void add_child(Entity* child);
             void remove_child(Entity* child);
-            const std::vector<Entity*>& get_children() const;
+            const PoolVector<Entity*>& get_children() const;
+
+            // The Realm this entity was created in, or nullptr once it has left it.
+            Realm* get_realm() const { return owning_realm; }
 
             bool is_child_of(const Entity* potential_parent) const;
             bool is_root() const { return get_parent() == nullptr; }
@@ -102,43 +120,55 @@ namespace Salix {
             }
         
             
+            // Typed lookups go through a per-entity slot table indexed by the
+            // element's type ID, filled as elements are added, so they are O(1).
             // Non-const version
             template<typename T>
             T* get_element() {
-                // The loop now correctly iterates through the vector of raw pointers.
-                for (Element* element_ptr : get_all_elements()) {
-                    // REASONING: We dynamic_cast the raw pointer directly, without .get().
-                    if (T* casted_element = dynamic_cast<T*>(element_ptr)) {
-                        return casted_element;
-                    }
-                }
-                return nullptr;
+                return find_element<T>();
             }
 
             // CONST version for getting a read-only pointer.
             template<typename T>
             const T* get_element() const {
-                // REASONING: The const version is corrected the same way.
-                for (const Element* element_ptr : get_all_elements()) {
-                    if (const T* casted_element = dynamic_cast<const T*>(element_ptr)) {
-                        return casted_element;
-                    }
-                }
-                return nullptr;
+                return find_element<T>();
             }
             
             template<typename T>
             bool has_element() const {
                 // This is now incredibly simple: just call get_element and check the result.
-                return get_element<T>() != nullptr;
+                return find_element<T>() != nullptr;
             }
 
+            // Calls func(T&) for every element that is, or derives from, a T, in
+            // the order they were added. Unlike get_elements_by_type_name this
+            // never allocates, and entities without a T return at once.
+            template<typename T, typename Func>
+            void for_each_element(Func&& func) {
+                if (!find_element<T>()) return;
+                const size_t count = get_element_count();
+                for (size_t i = 0; i < count; ++i) {
+                    if (T* element = dynamic_cast<T*>(get_element_owner(i).get())) {
+                        func(*element);
+                    }
+                }
+            }
+
+            // One bit per concrete element type attached to this entity.
+            ElementTypeMask get_element_mask() const { return element_mask; }
+
         private:
 
             // --- PIMPL POINTER ---
             struct Pimpl;
             std::unique_ptr<Pimpl> pimpl;
             
+            // The Realm that created this entity keeps its id/name indices and
+            // handle slot in sync through these.
+            friend class Realm;
+            Realm* owning_realm = nullptr;
+            uint32_t realm_slot = 0xFFFFFFFFu;
+
             // --- The Cereal Friendship ---
             // This gives the Cereal library permission to access our private serialize method.
             friend class cereal::access;
@@ -148,6 +178,50 @@ namespace Salix {
 
             // --- PRIVATE HELPER FUNCTIONS (implemented in .cpp) ---
             void add_element_internal(std::unique_ptr<Element> element);
+            Element* find_first_element_matching(bool (*matches)(const Element*)) const;
+            void rebuild_element_lookup();
+            void fill_element_slots(Element* element, ElementTypeId concrete_type_id);
+
+            // Binary realm files group elements by type instead of by entity;
+            // Realm reads and replaces the element list through these.
+            // for_each_element walks the list through the first two.
+            size_t get_element_count() const;
+            const std::unique_ptr<Element>& get_element_owner(size_t index) const;
+            void replace_elements(std::vector<std::unique_ptr<Element>>& elements);
+
+            template<typename T>
+            static bool matches_element_type(const Element* element) {
+                return dynamic_cast<const T*>(element) != nullptr;
+            }
+
+            template<typename T>
+            static T* cast_element(Element* element) {
+                // Cached entries are known to be a T, so element types can use a
+                // plain static_cast. Interfaces like ICamera still need a cross-cast.
+                if constexpr (std::is_base_of<Element, T>::value) {
+                    return static_cast<T*>(element);
+                } else {
+                    return dynamic_cast<T*>(element);
+                }
+            }
+
+            // Read-only, so lookups from several threads at once are safe. The slot
+            // table is written only when elements are added or replaced.
+            template<typename T>
+            T* find_element() const {
+                const ElementTypeId type_id = ElementTypeIdOf<T>::get();
+                // The first lookup for T anywhere lets every later slot fill match it.
+                static const bool matcher_set = (ElementTypeRegistry::set_matcher(type_id, &Entity::matches_element_type<T>), true);
+                (void)matcher_set;
+                if (ElementTypeRegistry::has_matcher_at(type_id, slots_epoch)) {
+                    const ElementTypeMask type_bit = element_type_bit(type_id);
+                    return (match_mask & type_bit) ? cast_element<T>(element_slots[type_id]) : nullptr;
+                }
+                // T was first looked up after this table was filled; the next
+                // Realm::maintain() refills it.
+                Element* found = find_first_element_matching(&Entity::matches_element_type<T>);
+                return found ? cast_element<T>(found) : nullptr;
+            }
             #ifdef SALIX_TESTS_ENABLED
             public:
                 Element* get_element_internal(const std::type_info& type_info);
@@ -160,5 +234,16 @@ namespace Salix {
                   
             Entity* parent = nullptr;
             std::vector<Entity*> children;
+
+            // --- Typed element lookup table ---
+            // element_mask: concrete types attached to this entity.
+            // element_slots[id]: the first element matching type id (through the
+            // registry's matcher, or by exact type if it has none); match_mask
+            // marks the non-null ones. Filled as elements are added, against the
+            // matchers known at slots_epoch.
+            ElementTypeMask element_mask = 0;
+            ElementTypeMask match_mask = 0;
+            uint32_t slots_epoch = 0;
+            Element* element_slots[MAX_ELEMENT_TYPES] = {};
         };
 } // namespace Salix
\ No newline at end of file
@@ -0,0 +1,176 @@
+// =================================================================================
+// Filename:    Salix/ecs/EntityCommandBuffer.cpp
+// Author:      SalixGameStudio
+// Description: Implements the EntityCommandBuffer.
+// =================================================================================
+#include <Salix/ecs/EntityCommandBuffer.h>
+#include <Salix/ecs/Realm.h>
+#include <Salix/ecs/Entity.h>
+#include <Salix/ecs/Element.h>
+#include <Salix/core/InitContext.h>
+
+namespace Salix {
+
+    namespace {
+        enum class CommandType : uint8_t { Create, Destroy, SetParent, AddElement };
+
+        struct Command {
+            CommandType type = CommandType::Create;
+            EntityCommandBuffer::EntityRef target;
+            EntityCommandBuffer::EntityRef other;   // SetParent: the new parent.
+            SimpleGuid id = SimpleGuid::invalid();   // Create: invalid means "generate".
+            std::string name;                       // Create
+            std::unique_ptr<Element> element;       // AddElement
+        };
+    }
+
+
+    struct EntityCommandBuffer::Pimpl {
+        std::vector<Command> commands;
+        uint32_t pending_count = 0;
+        // Scratch for apply(): the entity made by each Create, by pending index.
+        std::vector<Entity*> created;
+
+        Entity* resolve(const EntityRef& ref) const {
+            Entity* entity = ref.is_pending() ? created[ref.pending_index] : ref.entity;
+            return (entity && !entity->is_purged()) ? entity : nullptr;
+        }
+
+        EntityRef push_create(SimpleGuid id, const std::string& name) {
+            Command command;
+            command.type = CommandType::Create;
+            command.id = id;
+            command.name = name;
+            command.target.pending_index = pending_count;
+            commands.push_back(std::move(command));
+            EntityRef ref;
+            ref.pending_index = pending_count++;
+            return ref;
+        }
+    };
+
+
+    EntityCommandBuffer::EntityCommandBuffer() : pimpl(std::make_unique<Pimpl>()) {}
+    EntityCommandBuffer::~EntityCommandBuffer() = default;
+    EntityCommandBuffer::EntityCommandBuffer(EntityCommandBuffer&&) noexcept = default;
+    EntityCommandBuffer& EntityCommandBuffer::operator=(EntityCommandBuffer&&) noexcept = default;
+
+
+    EntityCommandBuffer::EntityRef EntityCommandBuffer::create_entity(const std::string& name) {
+        return pimpl->push_create(SimpleGuid::invalid(), name);
+    }
+
+    EntityCommandBuffer::EntityRef EntityCommandBuffer::create_entity(SimpleGuid id, const std::string& name) {
+        return pimpl->push_create(id, name);
+    }
+
+    void EntityCommandBuffer::destroy_entity(EntityRef entity) {
+        Command command;
+        command.type = CommandType::Destroy;
+        command.target = entity;
+        pimpl->commands.push_back(std::move(command));
+    }
+
+    void EntityCommandBuffer::set_parent(EntityRef child, EntityRef parent) {
+        Command command;
+        command.type = CommandType::SetParent;
+        command.target = child;
+        command.other = parent;
+        pimpl->commands.push_back(std::move(command));
+    }
+
+    void EntityCommandBuffer::add_element(EntityRef entity, std::unique_ptr<Element> element) {
+        if (!element) return;
+        Command command;
+        command.type = CommandType::AddElement;
+        command.target = entity;
+        command.element = std::move(element);
+        pimpl->commands.push_back(std::move(command));
+    }
+
+
+    void EntityCommandBuffer::apply(Realm& realm) {
+        // Take the commands out first: anything recorded while they run (say, by
+        // an element's initialize()) lands in the emptied buffer for next time.
+        std::vector<Command> commands;
+        commands.swap(pimpl->commands);
+        pimpl->created.assign(pimpl->pending_count, nullptr);
+        pimpl->pending_count = 0;
+        const InitContext& context = realm.get_context();
+
+        for (Command& command : commands) {
+            switch (command.type) {
+                case CommandType::Create: {
+                    pimpl->created[command.target.pending_index] = command.id.is_valid() ?
+                        realm.create_entity(command.id, command.name) :
+                        realm.create_entity(command.name);
+                    break;
+                }
+                case CommandType::Destroy: {
+                    if (Entity* entity = pimpl->resolve(command.target)) {
+                        entity->purge();
+                    }
+                    break;
+                }
+                case CommandType::SetParent: {
+                    Entity* child = pimpl->resolve(command.target);
+                    if (!child) break;
+                    // A parent that was named but has gone away leaves the child where it is.
+                    const bool wants_parent = command.other.entity || command.other.is_pending();
+                    Entity* parent = pimpl->resolve(command.other);
+                    if (wants_parent && !parent) break;
+                    child->set_parent(parent);
+                    break;
+                }
+                case CommandType::AddElement: {
+                    Entity* entity = pimpl->resolve(command.target);
+                    if (!entity) break;
+                    Element* element = command.element.get();
+                    entity->add_element(std::move(command.element));
+                    // Same as a freshly loaded element: give it a chance to load its assets.
+                    if (context.asset_manager) {
+                        element->on_load(context);
+                    }
+                    break;
+                }
+            }
+        }
+        // Hand the storage back for reuse if nothing new was recorded meanwhile.
+        if (pimpl->commands.empty()) {
+            commands.clear();
+            pimpl->commands.swap(commands);
+        }
+    }
+
+
+    void EntityCommandBuffer::append(EntityCommandBuffer&& other) {
+        if (&other == this) return;
+        const uint32_t offset = pimpl->pending_count;
+        auto shift = [offset](EntityRef& ref) {
+            if (ref.is_pending()) ref.pending_index += offset;
+        };
+        pimpl->commands.reserve(pimpl->commands.size() + other.pimpl->commands.size());
+        for (Command& command : other.pimpl->commands) {
+            shift(command.target);
+            shift(command.other);
+            pimpl->commands.push_back(std::move(command));
+        }
+        pimpl->pending_count += other.pimpl->pending_count;
+        other.clear();
+    }
+
+
+    bool EntityCommandBuffer::is_empty() const {
+        return pimpl->commands.empty();
+    }
+
+    size_t EntityCommandBuffer::get_command_count() const {
+        return pimpl->commands.size();
+    }
+
+    void EntityCommandBuffer::clear() {
+        pimpl->commands.clear();
+        pimpl->pending_count = 0;
+    }
+
+} // namespace Salix
@@ -0,0 +1,83 @@
+// =================================================================================
+// Filename:    Salix/ecs/EntityCommandBuffer.h
+// Author:      SalixGameStudio
+// Description: Declares EntityCommandBuffer, which records structural changes
+//              to a Realm (create, destroy, reparent, add element) so they can
+//              be applied together at a sync point instead of mid-update.
+// =================================================================================
+#pragma once
+
+#include <Salix/core/Core.h>
+#include <Salix/core/SimpleGuid.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Salix {
+
+    // Forward declarations
+    class Entity;
+    class Element;
+    class Realm;
+
+    class SALIX_API EntityCommandBuffer {
+        public:
+            // Names the entity a command acts on: either one that already exists,
+            // or one created by an earlier command in this buffer.
+            struct EntityRef {
+                EntityRef() = default;
+                EntityRef(Entity* existing) : entity(existing) {}
+
+                bool is_pending() const { return pending_index != NOT_PENDING; }
+
+                Entity* entity = nullptr;
+                uint32_t pending_index = NOT_PENDING;
+                static constexpr uint32_t NOT_PENDING = 0xFFFFFFFFu;
+            };
+
+            EntityCommandBuffer();
+            ~EntityCommandBuffer();
+            EntityCommandBuffer(EntityCommandBuffer&&) noexcept;
+            EntityCommandBuffer& operator=(EntityCommandBuffer&&) noexcept;
+
+            // --- Recording ---
+            EntityRef create_entity(const std::string& name = "Entity");
+            EntityRef create_entity(SimpleGuid id, const std::string& name);
+            // Purges the entity (orphaning its children) when applied; the memory
+            // is released by the Realm's next maintain().
+            void destroy_entity(EntityRef entity);
+            // A null parent detaches the child and makes it a root.
+            void set_parent(EntityRef child, EntityRef parent);
+            void add_element(EntityRef entity, std::unique_ptr<Element> element);
+
+            template<typename T>
+            void add_element(EntityRef entity) {
+                static_assert(std::is_base_of<Element, T>::value, "Type T must be derived from Salix::Element");
+                add_element(entity, std::unique_ptr<Element>(std::make_unique<T>()));
+            }
+
+            // --- Applying ---
+            // Runs every recorded command against the realm in recording order,
+            // then leaves the buffer empty (its storage is kept for reuse).
+            // Commands whose entity is missing or already purged are skipped.
+            void apply(Realm& realm);
+
+            // Moves all of other's commands to the end of this buffer. References
+            // to entities pending in 'other' keep pointing at the same creations.
+            void append(EntityCommandBuffer&& other);
+
+            bool is_empty() const;
+            size_t get_command_count() const;
+            void clear();
+
+        private:
+            EntityCommandBuffer(const EntityCommandBuffer&) = delete;
+            EntityCommandBuffer& operator=(const EntityCommandBuffer&) = delete;
+
+            struct Pimpl;
+            std::unique_ptr<Pimpl> pimpl;
+    };
+
+} // namespace Salix
@@ -0,0 +1,41 @@
+// =================================================================================
+// Filename:    Salix/ecs/EntityHandle.h
+// Author:      SalixGameStudio
+// Description: Declares EntityHandle, a generational reference to an Entity
+//              owned by a Realm.
+// =================================================================================
+#pragma once
+
+#include <Salix/core/Core.h>
+#include <cstdint>
+#include <functional>
+
+namespace Salix {
+
+    // A weak reference to an entity in a Realm. It is resolved through
+    // Realm::resolve_entity_handle(), which returns nullptr in O(1) once the
+    // entity has been purged, instead of handing back a dangling pointer.
+    struct EntityHandle {
+        uint32_t index = 0xFFFFFFFFu;
+        uint32_t generation = 0;
+
+        bool is_valid() const { return index != 0xFFFFFFFFu; }
+
+        bool operator==(const EntityHandle& other) const {
+            return index == other.index && generation == other.generation;
+        }
+        bool operator!=(const EntityHandle& other) const { return !(*this == other); }
+
+        static EntityHandle invalid() { return EntityHandle{}; }
+    };
+
+} // namespace Salix
+
+namespace std {
+    template<>
+    struct hash<Salix::EntityHandle> {
+        std::size_t operator()(const Salix::EntityHandle& handle) const noexcept {
+            return std::hash<uint64_t>{}((static_cast<uint64_t>(handle.generation) << 32) | handle.index);
+        }
+    };
+}
@@ -2,16 +2,78 @@
 #include <Salix/ecs/Realm.h>
 #include <Salix/ecs/Entity.h>
 #include <Salix/ecs/Camera.h>
+#include <Salix/ecs/TransformHierarchyPass.h>
+#include <Salix/ecs/EntityCommandBuffer.h>
+#include <Salix/rendering/IRenderer.h>
 #include <Salix/events/EventManager.h>
 #include <Salix/events/BeforeEntityPurgedEvent.h>
 #include <Salix/core/SerializationRegistrations.h>
 #include <Salix/management/FileManager.h>
 #include <Salix/core/InitContext.h>
+#include <Salix/core/PoolAllocator.h>
+#include <Salix/core/JobSystem.h>
+#include <Salix/core/MappedFile.h>
 #include <fstream>
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <streambuf>
+#include <string_view>
+#include <unordered_map>
 #include <cereal/archives/json.hpp>
 
 namespace Salix {
 
+    namespace {
+        // Bounds-checked cursor over a mapped binary realm file. A failed read
+        // returns false or nullptr instead of touching memory past the end.
+        struct MappedReader {
+            const char* data;
+            size_t size;
+            size_t offset = 0;
+
+            void seek(uint64_t new_offset) {
+                offset = new_offset <= size ? static_cast<size_t>(new_offset) : size + 1;
+            }
+
+            // Sections are padded to 8 bytes.
+            void align() {
+                seek((static_cast<uint64_t>(offset) + 7) & ~static_cast<uint64_t>(7));
+            }
+
+            // Records are copied out, so the mapping needs no particular alignment.
+            template<typename T>
+            bool read(T& out) {
+                const T* source = take_array<T>(1);
+                if (!source) return false;
+                std::memcpy(&out, source, sizeof(T));
+                return true;
+            }
+
+            template<typename T>
+            const T* take_array(size_t count) {
+                if (offset > size || count > (size - offset) / sizeof(T)) return nullptr;
+                const T* result = reinterpret_cast<const T*>(data + offset);
+                offset += count * sizeof(T);
+                return result;
+            }
+        };
+
+        // Lets a cereal archive read a block of the mapping in place.
+        class MemoryStreamBuffer : public std::streambuf {
+            public:
+                MemoryStreamBuffer(const char* data, size_t size) {
+                    char* begin = const_cast<char*>(data);
+                    setg(begin, begin, begin + size);
+                }
+        };
+
+        // Set while a parallel update batch runs, so get_command_buffer() on that
+        // thread records into the batch's own buffer.
+        thread_local const Realm* batch_realm = nullptr;
+        thread_local EntityCommandBuffer* batch_commands = nullptr;
+    }
+
     struct Realm::Pimpl {
         std::string name;
         std::string path;
@@ -19,6 +81,118 @@ namespace Salix {
         ICamera* active_camera = nullptr;
         SimpleGuid main_camera_entity_id = SimpleGuid::invalid();
         InitContext context;
+
+        // --- Parallel update scratch (reused every frame) ---
+        bool parallel_update = true;
+        JobSystem* job_system = nullptr;
+        std::vector<Entity*> parallel_entities;
+        std::vector<Entity*> main_thread_entities;
+        std::vector<std::vector<CapturedEvent>> batch_events;
+        std::vector<EntityCommandBuffer> batch_command_buffers;
+
+        // --- Deferred structural changes ---
+        EntityCommandBuffer commands;
+        std::vector<Entity*> purged_scratch;
+
+        // --- View membership lists ---
+        // One list per element mask ever passed to view(), kept in entity
+        // creation order. Boxed so a view's reference survives new caches.
+        struct ViewCache {
+            ElementTypeMask mask = 0;
+            std::vector<Entity*> members;
+        };
+        std::vector<std::unique_ptr<ViewCache>> view_caches;
+
+        // The element matcher epoch every entity's slot table was last
+        // brought up to in maintain().
+        uint32_t lookup_epoch = 0;
+
+        // --- Lookup indices ---
+        // Every live entity owns one slot. A slot's generation is bumped when its
+        // entity is removed, which is what makes older EntityHandles go stale.
+        struct EntitySlot {
+            Entity* entity = nullptr;
+            uint32_t generation = 0;
+            uint32_t name_position = 0;     // Where this slot sits in its slots_by_name list.
+            uint64_t name_order = 0;        // When it joined that list; lowest is the oldest.
+        };
+        std::vector<EntitySlot> entity_slots;
+        std::vector<uint32_t> free_entity_slots;
+        // Index nodes come from the PoolAllocator so spawn/despawn churn reuses them.
+        using SlotList = std::vector<uint32_t, PoolStdAllocator<uint32_t>>;
+        std::unordered_map<SimpleGuid, uint32_t, std::hash<SimpleGuid>, std::equal_to<SimpleGuid>,
+            PoolStdAllocator<std::pair<const SimpleGuid, uint32_t>>> slot_by_id;
+        // How many registered entities share an id beyond the one slot_by_id
+        // points at. Only ids listed here ever need a search when they leave.
+        std::unordered_map<SimpleGuid, uint32_t> duplicate_id_counts;
+        // Slots per name, unordered; name_order picks the oldest entity. The
+        // keys are pooled as well, so long names are not a malloc per spawn.
+        struct NameKeyHash {
+            size_t operator()(const PoolString& key) const {
+                return std::hash<std::string_view>{}(std::string_view(key.data(), key.size()));
+            }
+        };
+        std::unordered_map<PoolString, SlotList, NameKeyHash, std::equal_to<PoolString>,
+            PoolStdAllocator<std::pair<const PoolString, SlotList>>> slots_by_name;
+        uint64_t next_name_order = 0;
+
+        static PoolString name_key(const std::string& entity_name) {
+            return PoolString(entity_name.data(), entity_name.size());
+        }
+
+        void add_to_name_index(const std::string& entity_name, uint32_t slot) {
+            SlotList& slots = slots_by_name[name_key(entity_name)];
+            entity_slots[slot].name_position = static_cast<uint32_t>(slots.size());
+            entity_slots[slot].name_order = next_name_order++;
+            slots.push_back(slot);
+        }
+
+        // Swap-remove: the last slot in the list takes the leaving slot's place.
+        void remove_from_name_index(const std::string& entity_name, uint32_t slot) {
+            auto it = slots_by_name.find(name_key(entity_name));
+            if (it == slots_by_name.end()) return;
+            auto& slots = it->second;
+            const uint32_t position = entity_slots[slot].name_position;
+            if (position >= slots.size() || slots[position] != slot) return;
+            slots[position] = slots.back();
+            entity_slots[slots[position]].name_position = position;
+            slots.pop_back();
+            if (slots.empty()) {
+                slots_by_name.erase(it);
+            }
+        }
+
+        // First one wins on a duplicate id, matching the old linear search.
+        void add_to_id_index(const SimpleGuid& id, uint32_t slot) {
+            if (!slot_by_id.emplace(id, slot).second) {
+                ++duplicate_id_counts[id];
+            }
+        }
+
+        // Drops slot's claim on id. Ids are meant to be unique, but if a duplicate
+        // exists it takes over the index entry; only then are the entities searched.
+        void remove_from_id_index(const SimpleGuid& id, uint32_t slot, const Entity* leaving) {
+            auto it = slot_by_id.find(id);
+            if (it == slot_by_id.end()) return;
+            const bool owned_id = it->second == slot;
+            auto duplicate = duplicate_id_counts.find(id);
+            if (duplicate == duplicate_id_counts.end()) {
+                if (owned_id) slot_by_id.erase(it);
+                return;
+            }
+            if (--duplicate->second == 0) {
+                duplicate_id_counts.erase(duplicate);
+            }
+            if (!owned_id) return;
+
+            slot_by_id.erase(it);
+            for (const auto& entity : entities) {
+                if (entity && entity.get() != leaving && entity->realm_slot != 0xFFFFFFFFu && entity->get_id() == id) {
+                    slot_by_id.emplace(id, entity->realm_slot);
+                    return;
+                }
+            }
+        }
     };
 
     // Constructors
@@ -41,11 +215,26 @@ namespace Salix {
 
     // Static Factory for Loading
     std::unique_ptr<Realm> Realm::load_from_file(const std::string& path, const InitContext& context) {
+        auto realm = read_file(path);
+        if (realm) {
+            // After loading, run the on_load lifecycle method for all entities
+            realm->on_load(context);
+        }
+        return realm;
+    }
+
+    std::unique_ptr<Realm> Realm::read_file(const std::string& path) {
         if (!FileManager::path_exists(path)) {
             std::cerr << "Realm Error: File not found at '" << path << "'." << std::endl;
             return nullptr;
         }
+        if (detect_file_format(path) == RealmFileFormat::Binary) {
+            return read_binary_file(path);
+        }
+        return read_json_file(path);
+    }
 
+    std::unique_ptr<Realm> Realm::read_json_file(const std::string& path) {
         std::ifstream file_stream(path);
         if (!file_stream.is_open()) {
             std::cerr << "Realm Error: Could not open file '" << path << "'." << std::endl;
@@ -57,9 +246,6 @@ namespace Salix {
             // Create a temporary unique_ptr and deserialize into it
             auto realm = std::make_unique<Realm>("", ""); // Temp name/path
             archive(*realm);
-            
-            // After loading, run the on_load lifecycle method for all entities
-            realm->on_load(context);
             return realm;
         } catch (const cereal::Exception& e) {
             std::cerr << "Realm Error: Failed to deserialize realm from '" << path << "': " << e.what() << std::endl;
@@ -67,8 +253,170 @@ namespace Salix {
         }
     }
 
+    std::unique_ptr<Realm> Realm::read_binary_file(const std::string& path) {
+        MappedFile file;
+        if (!file.open(path)) {
+            std::cerr << "Realm Error: Could not map file '" << path << "'." << std::endl;
+            return nullptr;
+        }
+        MappedReader reader{ reinterpret_cast<const char*>(file.get_data()), file.get_size() };
+
+        RealmBinaryHeader header;
+        if (!reader.read(header) || std::memcmp(header.magic, RealmBinary::MAGIC, sizeof(header.magic)) != 0) {
+            std::cerr << "Realm Error: '" << path << "' is not a binary realm file." << std::endl;
+            return nullptr;
+        }
+        if (header.version != RealmBinary::VERSION) {
+            std::cerr << "Realm Error: '" << path << "' is binary realm version " << header.version
+                      << ", expected " << RealmBinary::VERSION << ". Convert it again from JSON." << std::endl;
+            return nullptr;
+        }
+        if (header.file_size != reader.size) {
+            std::cerr << "Realm Error: '" << path << "' is truncated." << std::endl;
+            return nullptr;
+        }
+
+        // --- String table ---
+        uint32_t string_count = 0;
+        const uint32_t* string_offsets = nullptr;
+        const char* string_bytes = nullptr;
+        reader.seek(header.string_table_offset);
+        if (reader.read(string_count)) {
+            string_offsets = reader.take_array<uint32_t>(static_cast<size_t>(string_count) + 1);
+        }
+        if (string_offsets) {
+            string_bytes = reader.take_array<char>(string_offsets[string_count]);
+        }
+        if (!string_bytes) {
+            std::cerr << "Realm Error: '" << path << "' has a damaged string table." << std::endl;
+            return nullptr;
+        }
+        bool strings_ok = true;
+        auto get_string = [&](uint32_t index) -> std::string {
+            if (index == RealmBinary::NO_STRING) return std::string();
+            if (index >= string_count || string_offsets[index] > string_offsets[index + 1] ||
+                string_offsets[index + 1] > string_offsets[string_count]) {
+                strings_ok = false;
+                return std::string();
+            }
+            return std::string(string_bytes + string_offsets[index], string_offsets[index + 1] - string_offsets[index]);
+        };
+
+        auto realm = std::make_unique<Realm>("", "");
+        realm->pimpl->name = get_string(header.name_string);
+        realm->pimpl->path = get_string(header.path_string);
+        realm->pimpl->main_camera_entity_id = SimpleGuid::from_value(header.main_camera_entity_id);
+
+        // --- Entities ---
+        reader.seek(header.entity_table_offset);
+        const RealmBinaryEntity* entity_table = reader.take_array<RealmBinaryEntity>(header.entity_count);
+        if (!entity_table) {
+            std::cerr << "Realm Error: '" << path << "' has a damaged entity table." << std::endl;
+            return nullptr;
+        }
+
+        // --- Element blocks ---
+        // Located (and bounds-checked against the mapping) before anything is
+        // sized from the entity records, so the records can be checked against them.
+        struct BlockView {
+            RealmBinaryBlock block;
+            const RealmBinaryElementRef* refs;
+            const char* payload;
+        };
+        std::vector<BlockView> blocks;
+        uint64_t block_element_total = 0;
+        reader.seek(header.blocks_offset);
+        for (uint32_t b = 0; b < header.block_count; ++b) {
+            BlockView view{ {}, nullptr, nullptr };
+            if (reader.read(view.block)) {
+                view.refs = reader.take_array<RealmBinaryElementRef>(view.block.element_count);
+            }
+            if (view.refs) {
+                view.payload = reader.take_array<char>(static_cast<size_t>(view.block.payload_size));
+                reader.align();
+            }
+            if (!view.payload) {
+                std::cerr << "Realm Error: '" << path << "' has a damaged element block." << std::endl;
+                return nullptr;
+            }
+            block_element_total += view.block.element_count;
+            blocks.push_back(view);
+        }
+
+        // Every element sits in exactly one block, so the per-entity counts must
+        // add up to the blocks' total. That also bounds every count by the file size.
+        uint64_t entity_element_total = 0;
+        for (uint32_t i = 0; i < header.entity_count; ++i) {
+            RealmBinaryEntity record;
+            std::memcpy(&record, &entity_table[i], sizeof(record));
+            entity_element_total += record.element_count;
+        }
+        if (entity_element_total != block_element_total) {
+            std::cerr << "Realm Error: '" << path << "' lists " << entity_element_total << " elements in its entity table but "
+                      << block_element_total << " in its element blocks." << std::endl;
+            return nullptr;
+        }
+
+        std::vector<std::unique_ptr<Entity>>& entities = realm->pimpl->entities;
+        std::vector<std::vector<std::unique_ptr<Element>>> element_lists(header.entity_count);
+        entities.reserve(header.entity_count);
+        for (uint32_t i = 0; i < header.entity_count; ++i) {
+            RealmBinaryEntity record;
+            std::memcpy(&record, &entity_table[i], sizeof(record));
+            auto entity = std::make_unique<Entity>();
+            entity->set_name(get_string(record.name_string));
+            entity->set_id(SimpleGuid::from_value(record.id));
+            element_lists[i].resize(record.element_count);
+            entities.push_back(std::move(entity));
+        }
+
+        try {
+            for (const BlockView& view : blocks) {
+                const RealmBinaryBlock& block = view.block;
+                const RealmBinaryElementRef* refs = view.refs;
+                MemoryStreamBuffer buffer(view.payload, static_cast<size_t>(block.payload_size));
+                std::istream stream(&buffer);
+                cereal::BinaryInputArchive archive(stream);
+                for (uint32_t e = 0; e < block.element_count; ++e) {
+                    RealmBinaryElementRef ref;
+                    std::memcpy(&ref, &refs[e], sizeof(ref));
+                    std::unique_ptr<Element> element;
+                    archive(element);
+                    if (ref.entity_index >= element_lists.size() || ref.slot >= element_lists[ref.entity_index].size()) {
+                        std::cerr << "Realm Error: '" << path << "' places an element outside its entity table." << std::endl;
+                        return nullptr;
+                    }
+                    element_lists[ref.entity_index][ref.slot] = std::move(element);
+                }
+            }
+        } catch (const cereal::Exception& e) {
+            std::cerr << "Realm Error: Failed to deserialize realm from '" << path << "': " << e.what() << std::endl;
+            return nullptr;
+        }
+        if (!strings_ok) {
+            std::cerr << "Realm Error: '" << path << "' refers to a string that is not in its table." << std::endl;
+            return nullptr;
+        }
+
+        for (size_t i = 0; i < entities.size(); ++i) {
+            auto& elements = element_lists[i];
+            // Elements whose type failed to construct (e.g. an unregistered script) are dropped.
+            elements.erase(std::remove(elements.begin(), elements.end(), nullptr), elements.end());
+            entities[i]->replace_elements(elements);
+        }
+        realm->rebuild_entity_index();
+        return realm;
+    }
+
     // Saving
-    bool Realm::save_to_file(const std::string& path) const {
+    bool Realm::save_to_file(const std::string& path, RealmFileFormat format) const {
+        if (format == RealmFileFormat::Binary) {
+            return write_binary_file(path);
+        }
+        return write_json_file(path);
+    }
+
+    bool Realm::write_json_file(const std::string& path) const {
         std::ofstream file_stream(path);
         if (!file_stream.is_open()) {
             std::cerr << "Realm Error: Could not open file for writing: '" << path << "'." << std::endl;
@@ -85,6 +433,153 @@ namespace Salix {
         }
     }
 
+    bool Realm::write_binary_file(const std::string& path) const {
+        std::vector<std::string> strings;
+        std::unordered_map<std::string, uint32_t> string_indices;
+        auto intern = [&](const std::string& value) -> uint32_t {
+            auto found = string_indices.find(value);
+            if (found != string_indices.end()) return found->second;
+            const uint32_t index = static_cast<uint32_t>(strings.size());
+            strings.push_back(value);
+            string_indices.emplace(value, index);
+            return index;
+        };
+
+        RealmBinaryHeader header{};
+        std::memcpy(header.magic, RealmBinary::MAGIC, sizeof(header.magic));
+        header.version = RealmBinary::VERSION;
+        header.name_string = intern(pimpl->name);
+        header.path_string = intern(pimpl->path);
+        header.main_camera_entity_id = pimpl->main_camera_entity_id.get_value();
+
+        // Group every element by its concrete type, remembering where it came from.
+        struct PendingBlock {
+            uint32_t type_name_string = 0;
+            std::vector<RealmBinaryElementRef> refs;
+            std::vector<const std::unique_ptr<Element>*> elements;
+        };
+        std::vector<PendingBlock> blocks;
+        std::unordered_map<std::string, size_t> block_by_type;
+        std::vector<RealmBinaryEntity> entity_table;
+        entity_table.reserve(pimpl->entities.size());
+
+        for (const auto& entity : pimpl->entities) {
+            if (!entity) continue;
+            RealmBinaryEntity record{};
+            record.id = entity->get_id().get_value();
+            record.name_string = intern(entity->get_name());
+            const uint32_t entity_index = static_cast<uint32_t>(entity_table.size());
+
+            for (size_t i = 0; i < entity->get_element_count(); ++i) {
+                const std::unique_ptr<Element>& element = entity->get_element_owner(i);
+                if (!element) continue;
+                const std::string type_name = element->get_class_name();
+                auto found = block_by_type.find(type_name);
+                if (found == block_by_type.end()) {
+                    found = block_by_type.emplace(type_name, blocks.size()).first;
+                    blocks.emplace_back();
+                    blocks.back().type_name_string = intern(type_name);
+                }
+                PendingBlock& block = blocks[found->second];
+                block.refs.push_back({ entity_index, record.element_count++ });
+                block.elements.push_back(&element);
+            }
+            entity_table.push_back(record);
+        }
+        header.entity_count = static_cast<uint32_t>(entity_table.size());
+        header.block_count = static_cast<uint32_t>(blocks.size());
+
+        std::vector<char> bytes(sizeof(header));
+        auto append = [&bytes](const void* data, size_t size) {
+            const char* source = static_cast<const char*>(data);
+            bytes.insert(bytes.end(), source, source + size);
+        };
+        auto align = [&bytes]() { bytes.resize((bytes.size() + 7) & ~static_cast<size_t>(7)); };
+
+        try {
+            // --- String table ---
+            align();
+            header.string_table_offset = bytes.size();
+            const uint32_t string_count = static_cast<uint32_t>(strings.size());
+            std::vector<uint32_t> string_offsets;
+            string_offsets.reserve(strings.size() + 1);
+            uint32_t string_end = 0;
+            for (const std::string& value : strings) {
+                string_offsets.push_back(string_end);
+                string_end += static_cast<uint32_t>(value.size());
+            }
+            string_offsets.push_back(string_end);
+            append(&string_count, sizeof(string_count));
+            append(string_offsets.data(), string_offsets.size() * sizeof(uint32_t));
+            for (const std::string& value : strings) {
+                append(value.data(), value.size());
+            }
+
+            // --- Entity table ---
+            align();
+            header.entity_table_offset = bytes.size();
+            append(entity_table.data(), entity_table.size() * sizeof(RealmBinaryEntity));
+
+            // --- Element blocks ---
+            align();
+            header.blocks_offset = bytes.size();
+            for (const PendingBlock& pending : blocks) {
+                std::ostringstream payload(std::ios::binary);
+                {
+                    cereal::BinaryOutputArchive archive(payload);
+                    for (const std::unique_ptr<Element>* element : pending.elements) {
+                        archive(*element);
+                    }
+                }
+                const std::string payload_bytes = payload.str();
+
+                RealmBinaryBlock block{};
+                block.type_name_string = pending.type_name_string;
+                block.element_count = static_cast<uint32_t>(pending.refs.size());
+                block.payload_size = payload_bytes.size();
+                append(&block, sizeof(block));
+                append(pending.refs.data(), pending.refs.size() * sizeof(RealmBinaryElementRef));
+                append(payload_bytes.data(), payload_bytes.size());
+                align();
+            }
+        } catch (const cereal::Exception& e) {
+            std::cerr << "Realm Error: Failed to serialize realm to '" << path << "': " << e.what() << std::endl;
+            return false;
+        }
+
+        header.file_size = bytes.size();
+        std::memcpy(bytes.data(), &header, sizeof(header));
+
+        std::ofstream file_stream(path, std::ios::binary | std::ios::trunc);
+        if (!file_stream.is_open()) {
+            std::cerr << "Realm Error: Could not open file for writing: '" << path << "'." << std::endl;
+            return false;
+        }
+        file_stream.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        return static_cast<bool>(file_stream);
+    }
+
+    RealmFileFormat Realm::detect_file_format(const std::string& path) {
+        std::ifstream file_stream(path, std::ios::binary);
+        char magic[sizeof(RealmBinary::MAGIC)] = {};
+        if (!file_stream.read(magic, sizeof(magic))) {
+            return RealmFileFormat::Unknown;
+        }
+        if (std::memcmp(magic, RealmBinary::MAGIC, sizeof(magic)) == 0) {
+            return RealmFileFormat::Binary;
+        }
+        return RealmFileFormat::Json;
+    }
+
+    bool Realm::convert_file(const std::string& source_path, const std::string& destination_path,
+                             RealmFileFormat format) {
+        auto realm = read_file(source_path);
+        if (!realm) {
+            return false;
+        }
+        return realm->save_to_file(destination_path, format);
+    }
+
     // Retrieve name and path
     const std::string& Realm::get_path() {
         return pimpl->path;
@@ -115,30 +610,130 @@ namespace Salix {
     }
 
     void Realm::update(float delta_time) {
-        for (auto& entity : pimpl->entities) {
-            if (entity && !entity->is_purged()) {
+        pimpl->parallel_entities.clear();
+        pimpl->main_thread_entities.clear();
+        if (pimpl->parallel_update) {
+            for (auto& entity : pimpl->entities) {
+                if (entity && !entity->is_purged()) {
+                    (entity->wants_parallel_update() ? pimpl->parallel_entities : pimpl->main_thread_entities).push_back(entity.get());
+                }
+            }
+        }
+        // Nothing opted in: skip the job system entirely.
+        JobSystem* jobs = nullptr;
+        if (!pimpl->parallel_entities.empty()) {
+            jobs = pimpl->job_system ? pimpl->job_system : &JobSystem::get();
+        }
+        if (!jobs || jobs->get_worker_count() == 0) {
+            for (auto& entity : pimpl->entities) {
+                if (entity && !entity->is_purged()) {
+                    entity->update(delta_time);
+                }
+            }
+        } else {
+            // Batches are fixed-size slices of the opted-in entities, and their
+            // events are forwarded batch by batch, so the event order does not
+            // depend on how many workers there are or which one ran what.
+            const size_t parallel_count = pimpl->parallel_entities.size();
+            const size_t batch_count = (parallel_count + PARALLEL_UPDATE_BATCH_SIZE - 1) / PARALLEL_UPDATE_BATCH_SIZE;
+            if (pimpl->batch_events.size() < batch_count) {
+                pimpl->batch_events.resize(batch_count);
+                pimpl->batch_command_buffers.resize(batch_count);
+            }
+            jobs->parallel_for(batch_count, [this, delta_time, parallel_count](size_t batch) {
+                ScopedEventCapture capture(pimpl->batch_events[batch]);
+                const Realm* previous_realm = batch_realm;
+                EntityCommandBuffer* previous_commands = batch_commands;
+                batch_realm = this;
+                batch_commands = &pimpl->batch_command_buffers[batch];
+                const size_t end = std::min(parallel_count, (batch + 1) * PARALLEL_UPDATE_BATCH_SIZE);
+                for (size_t i = batch * PARALLEL_UPDATE_BATCH_SIZE; i < end; ++i) {
+                    pimpl->parallel_entities[i]->update(delta_time);
+                }
+                batch_realm = previous_realm;
+                batch_commands = previous_commands;
+            });
+            for (size_t batch = 0; batch < batch_count; ++batch) {
+                ScopedEventCapture::forward(pimpl->batch_events[batch]);
+                pimpl->commands.append(std::move(pimpl->batch_command_buffers[batch]));
+            }
+
+            for (Entity* entity : pimpl->main_thread_entities) {
                 entity->update(delta_time);
             }
         }
+        // Sync point: spawns, despawns and reparents recorded during the update
+        // land here, before the transform pass sees the hierarchy.
+        flush_commands();
+
+        // Settle every world matrix once, after scripts have moved things, so
+        // rendering and picking read cached results instead of walking parents.
+        TransformHierarchyPass::get().run();
     }
 
     void Realm::render(IRenderer* renderer) {
+        if (!renderer) return;
+        // Sprites are queued and drawn together, a handful of draws per frame.
+        renderer->begin_sprite_batch();
         for (auto& entity : pimpl->entities) {
             if (entity && entity->is_visible() && !entity->is_purged()) {
                 entity->render(renderer);
             }
         }
+        renderer->end_sprite_batch();
+    }
+
+    void Realm::set_parallel_update(bool enabled) {
+        pimpl->parallel_update = enabled;
+    }
+
+    bool Realm::is_parallel_update_enabled() const {
+        return pimpl->parallel_update;
+    }
+
+    void Realm::set_job_system(JobSystem* job_system) {
+        pimpl->job_system = job_system;
+    }
+
+    EntityCommandBuffer& Realm::get_command_buffer() {
+        if (batch_realm == this && batch_commands) {
+            return *batch_commands;
+        }
+        return pimpl->commands;
+    }
+
+    void Realm::flush_commands() {
+        if (!pimpl->commands.is_empty()) {
+            pimpl->commands.apply(*this);
+        }
     }
 
     void Realm::maintain() {
-        // Dispatch pre-purge events first
-        if (pimpl->context.event_manager) {
-            for (const auto& entity : pimpl->entities) {
-                if (entity && entity->is_purged()) {
-                    pimpl->context.event_manager->dispatch(std::make_unique<BeforeEntityPurgedEvent>(entity.get()));
-                }
+        // Apply anything still recorded, so destroys made since the last update are swept now.
+        flush_commands();
+
+        // Collect the purged entities in one pass.
+        pimpl->purged_scratch.clear();
+        for (const auto& entity : pimpl->entities) {
+            if (entity && entity->is_purged()) {
+                pimpl->purged_scratch.push_back(entity.get());
             }
         }
+        // One pre-purge event for the whole batch.
+        if (pimpl->context.event_manager && !pimpl->purged_scratch.empty()) {
+            pimpl->context.event_manager->dispatch(std::make_unique<BeforeEntityPurgedEvent>(pimpl->purged_scratch));
+        }
+
+        // Drop them from the indices and invalidate their handles.
+        for (Entity* entity : pimpl->purged_scratch) {
+            unregister_entity(entity);
+        }
+        // One pass per view list rather than one erase per purged entity.
+        for (auto& cache : pimpl->view_caches) {
+            auto& members = cache->members;
+            members.erase(std::remove_if(members.begin(), members.end(),
+                [](const Entity* entity) { return entity->is_purged(); }), members.end());
+        }
 
         // Now, erase the purged entities
         auto it = std::remove_if(pimpl->entities.begin(), pimpl->entities.end(), 
@@ -146,6 +741,19 @@ namespace Salix {
                 return !entity || entity->is_purged();
         });
         pimpl->entities.erase(it, pimpl->entities.end());
+
+        // A type first looked up after its entities were filled has no slot in
+        // their tables yet; refill the stale ones once here rather than have
+        // every lookup fall back to scanning.
+        const uint32_t lookup_epoch = ElementTypeRegistry::get_matcher_epoch();
+        if (lookup_epoch != pimpl->lookup_epoch) {
+            for (const auto& entity : pimpl->entities) {
+                if (entity->slots_epoch != lookup_epoch) {
+                    entity->rebuild_element_lookup();
+                }
+            }
+            pimpl->lookup_epoch = lookup_epoch;
+        }
     }
 
     // Asset loading
@@ -158,6 +766,10 @@ namespace Salix {
         if (context.asset_manager == nullptr) return;
         pimpl->context = context;
     }
+
+    const InitContext& Realm::get_context() const {
+        return pimpl->context;
+    }
     
     // Entity Management
     Entity* Realm::create_entity(const std::string& name) {
@@ -165,6 +777,7 @@ namespace Salix {
         new_entity->set_name(name);
         Entity* ptr = new_entity.get();
         pimpl->entities.push_back(std::move(new_entity));
+        register_entity(ptr);
         return ptr;
     }
 
@@ -174,30 +787,166 @@ namespace Salix {
         new_entity->set_id(id);
         Entity* ptr = new_entity.get();
         pimpl->entities.push_back(std::move(new_entity));
+        register_entity(ptr);
         return ptr;
     }
 
     void Realm::clear_all_entities() {
+        // Every outstanding handle must go stale, so bump all generations.
+        pimpl->free_entity_slots.clear();
+        for (uint32_t slot = 0; slot < pimpl->entity_slots.size(); ++slot) {
+            auto& entity_slot = pimpl->entity_slots[slot];
+            if (entity_slot.entity) {
+                entity_slot.entity->owning_realm = nullptr;
+                entity_slot.entity->realm_slot = 0xFFFFFFFFu;
+                entity_slot.entity = nullptr;
+                ++entity_slot.generation;
+            }
+            pimpl->free_entity_slots.push_back(slot);
+        }
+        pimpl->slot_by_id.clear();
+        pimpl->duplicate_id_counts.clear();
+        pimpl->slots_by_name.clear();
+        for (auto& cache : pimpl->view_caches) {
+            cache->members.clear();
+        }
         pimpl->entities.clear();
     }
 
     // Retrieval
     Entity* Realm::get_entity_by_id(SimpleGuid id) {
+        auto it = pimpl->slot_by_id.find(id);
+        if (it == pimpl->slot_by_id.end()) return nullptr;
+        return pimpl->entity_slots[it->second].entity;
+    }
+
+    Entity* Realm::get_entity_by_name(const std::string& name) {
+        auto it = pimpl->slots_by_name.find(Pimpl::name_key(name));
+        if (it == pimpl->slots_by_name.end()) return nullptr;
+        uint32_t oldest = it->second.front();
+        for (uint32_t slot : it->second) {
+            if (pimpl->entity_slots[slot].name_order < pimpl->entity_slots[oldest].name_order) oldest = slot;
+        }
+        return pimpl->entity_slots[oldest].entity;
+    }
+
+    EntityHandle Realm::get_entity_handle(const Entity* entity) const {
+        if (!entity || entity->owning_realm != this) return EntityHandle::invalid();
+        return EntityHandle{ entity->realm_slot, pimpl->entity_slots[entity->realm_slot].generation };
+    }
+
+    Entity* Realm::resolve_entity_handle(EntityHandle handle) const {
+        if (handle.index >= pimpl->entity_slots.size()) return nullptr;
+        const auto& entity_slot = pimpl->entity_slots[handle.index];
+        return entity_slot.generation == handle.generation ? entity_slot.entity : nullptr;
+    }
+
+    // --- Index maintenance ---
+
+    void Realm::register_entity(Entity* entity) {
+        uint32_t slot;
+        if (!pimpl->free_entity_slots.empty()) {
+            slot = pimpl->free_entity_slots.back();
+            pimpl->free_entity_slots.pop_back();
+        } else {
+            slot = static_cast<uint32_t>(pimpl->entity_slots.size());
+            pimpl->entity_slots.emplace_back();
+        }
+        pimpl->entity_slots[slot].entity = entity;
+        entity->owning_realm = this;
+        entity->realm_slot = slot;
+
+        pimpl->add_to_id_index(entity->get_id(), slot);
+        pimpl->add_to_name_index(entity->get_name(), slot);
+
+        const ElementTypeMask entity_mask = entity->get_element_mask();
+        for (auto& cache : pimpl->view_caches) {
+            if ((entity_mask & cache->mask) == cache->mask) {
+                cache->members.push_back(entity);
+            }
+        }
+    }
+
+    void Realm::unregister_entity(Entity* entity) {
+        if (!entity || entity->owning_realm != this) return;
+        const uint32_t slot = entity->realm_slot;
+
+        pimpl->remove_from_id_index(entity->get_id(), slot, entity);
+        pimpl->remove_from_name_index(entity->get_name(), slot);
+
+        auto& entity_slot = pimpl->entity_slots[slot];
+        entity_slot.entity = nullptr;
+        ++entity_slot.generation;
+        pimpl->free_entity_slots.push_back(slot);
+        entity->owning_realm = nullptr;
+        entity->realm_slot = 0xFFFFFFFFu;
+    }
+
+    void Realm::on_entity_renamed(Entity* entity, const std::string& old_name) {
+        pimpl->remove_from_name_index(old_name, entity->realm_slot);
+        pimpl->add_to_name_index(entity->get_name(), entity->realm_slot);
+    }
+
+    void Realm::on_entity_id_changed(Entity* entity, const SimpleGuid& old_id) {
+        pimpl->remove_from_id_index(old_id, entity->realm_slot, entity);
+        pimpl->add_to_id_index(entity->get_id(), entity->realm_slot);
+    }
+
+    // Used after the entity list has been replaced wholesale (deserialization).
+    void Realm::rebuild_entity_index() {
+        for (auto& entity_slot : pimpl->entity_slots) {
+            if (entity_slot.entity) {
+                ++entity_slot.generation;
+                entity_slot.entity = nullptr;
+            }
+        }
+        pimpl->free_entity_slots.clear();
+        for (uint32_t slot = static_cast<uint32_t>(pimpl->entity_slots.size()); slot > 0; --slot) {
+            pimpl->free_entity_slots.push_back(slot - 1);
+        }
+        pimpl->slot_by_id.clear();
+        pimpl->duplicate_id_counts.clear();
+        pimpl->slots_by_name.clear();
+        for (auto& cache : pimpl->view_caches) {
+            cache->members.clear();
+        }
         for (const auto& entity : pimpl->entities) {
-            if (entity && entity->get_id() == id) {
-                return entity.get();
+            if (entity) {
+                register_entity(entity.get());
             }
         }
-        return nullptr;
     }
 
-    Entity* Realm::get_entity_by_name(const std::string& name) {
+    // Entity reports every change to its element mask so the view lists stay exact.
+    void Realm::on_entity_elements_changed(Entity* entity, ElementTypeMask old_mask) {
+        const ElementTypeMask new_mask = entity->get_element_mask();
+        for (auto& cache : pimpl->view_caches) {
+            const bool was_member = (old_mask & cache->mask) == cache->mask;
+            const bool is_member = (new_mask & cache->mask) == cache->mask;
+            if (is_member == was_member) continue;
+            auto& members = cache->members;
+            if (is_member) {
+                members.push_back(entity);
+            } else {
+                members.erase(std::remove(members.begin(), members.end(), entity), members.end());
+            }
+        }
+    }
+
+    const std::vector<Entity*>& Realm::get_view_members(ElementTypeMask mask) {
+        for (const auto& cache : pimpl->view_caches) {
+            if (cache->mask == mask) return cache->members;
+        }
+        // First query for this combination: build the list once from scratch.
+        auto cache = std::make_unique<Pimpl::ViewCache>();
+        cache->mask = mask;
         for (const auto& entity : pimpl->entities) {
-            if (entity && entity->get_name() == name) {
-                return entity.get();
+            if (entity && entity->owning_realm == this && (entity->get_element_mask() & mask) == mask) {
+                cache->members.push_back(entity.get());
             }
         }
-        return nullptr;
+        pimpl->view_caches.push_back(std::move(cache));
+        return pimpl->view_caches.back()->members;
     }
 
     std::vector<Entity*> Realm::get_entities() {
@@ -265,6 +1014,9 @@ namespace Salix {
             cereal::make_nvp("main_camera_entity_id", pimpl->main_camera_entity_id),
             cereal::make_nvp("entities", pimpl->entities)
         );
+        if constexpr (Archive::is_loading::value) {
+            rebuild_entity_index();
+        }
     }
 
 } // namespace Salix
\ No newline at end of file
@@ -1,6 +1,9 @@
 // Salix/ecs/Realm.h
 #pragma once
 #include <Salix/core/Core.h>
+#include <Salix/ecs/EntityHandle.h>
+#include <Salix/ecs/ElementTypeRegistry.h>
+#include <Salix/ecs/RealmFileFormat.h>
 #include <vector>
 #include <memory>
 #include <string>
@@ -10,10 +13,13 @@ namespace Salix {
 
     // Forward declarations
     class Entity;
+    class JobSystem;
+    class EntityCommandBuffer;
     class IRenderer;
     struct InitContext;
     class SimpleGuid;
     class ICamera;
+    template<typename... Ts> class RealmView;
 
     class SALIX_API Realm {
     public:
@@ -24,10 +30,20 @@ namespace Salix {
         ~Realm();
         // Factory function to load a realm from a file.
         // This is a cleaner pattern than loading into an existing object.
+        // Binary realm files are read straight from a mapped view; anything
+        // else falls back to the JSON reader.
         static std::unique_ptr<Realm> load_from_file(const std::string& path, const InitContext& context);
 
         // Saves the current state of the realm to a file.
-        bool save_to_file(const std::string& path) const;
+        bool save_to_file(const std::string& path, RealmFileFormat format = RealmFileFormat::Json) const;
+
+        // Looks at the first bytes only. Unknown for a missing or empty file.
+        static RealmFileFormat detect_file_format(const std::string& path);
+
+        // Rewrites a realm file in another format without running on_load(),
+        // so no renderer or assets are needed. Backs --convert-realm.
+        static bool convert_file(const std::string& source_path, const std::string& destination_path,
+                                 RealmFileFormat format);
 
         // Retrieve name and path
         const std::string& get_path();
@@ -39,6 +55,7 @@ namespace Salix {
 
         // Set context
         void set_context(const InitContext& context);
+        const InitContext& get_context() const;
 
         // Lifecycle methods that are called by the RealmManager
         void on_load(const InitContext& context);
@@ -46,6 +63,27 @@ namespace Salix {
         void render(IRenderer* renderer);
         void maintain();
 
+        // When enabled (the default) and the JobSystem has workers, entities that
+        // want a parallel update (see Element::wants_parallel_update) are updated
+        // in parallel batches first, then the remaining entities run in order on
+        // the calling thread. Events raised by the batches are forwarded once
+        // they all finish, in the order of the opted-in entities, so they come
+        // before any event raised by the main-thread entities.
+        void set_parallel_update(bool enabled);
+        bool is_parallel_update_enabled() const;
+        // Job system used for the parallel batches; nullptr means JobSystem::get().
+        void set_job_system(JobSystem* job_system);
+        static constexpr size_t PARALLEL_UPDATE_BATCH_SIZE = 64;
+
+        // Structural changes (create, destroy, reparent, add element) made from
+        // inside update() must go through this buffer rather than straight to
+        // the realm. On a parallel update batch it returns that batch's own
+        // buffer; batches are merged in batch order once they finish. Recorded
+        // commands are applied at the end of update() and at the start of
+        // maintain(), or whenever flush_commands() is called.
+        EntityCommandBuffer& get_command_buffer();
+        void flush_commands();
+
         // Asset loading
         void load_assets(InitContext& context);
         // Entity management
@@ -58,6 +96,17 @@ namespace Salix {
         Entity* get_entity_by_name(const std::string& name);
         std::vector<Entity*> get_entities();
 
+        // Entities carrying every element type in Ts, read from a membership list
+        // the Realm keeps up to date as entities and elements come and go. Only
+        // the first query for a given combination allocates.
+        // Defined in <Salix/ecs/RealmView.h>.
+        template<typename... Ts>
+        RealmView<Ts...> view();
+
+        // Generational handles. A handle to a purged entity resolves to nullptr.
+        EntityHandle get_entity_handle(const Entity* entity) const;
+        Entity* resolve_entity_handle(EntityHandle handle) const;
+
         // Camera management
         void set_main_camera_entity(SimpleGuid entity_id);
         SimpleGuid get_main_camera_entity_id() const;
@@ -72,6 +121,23 @@ namespace Salix {
         
         // Grant access to RealmManager to call the private constructor
         friend class RealmManager; 
+        // Entity reports name and id changes so the lookup indices stay in sync.
+        friend class Entity;
+        void on_entity_renamed(Entity* entity, const std::string& old_name);
+        void on_entity_id_changed(Entity* entity, const SimpleGuid& old_id);
+        void register_entity(Entity* entity);
+        void unregister_entity(Entity* entity);
+        void rebuild_entity_index();
+        void on_entity_elements_changed(Entity* entity, ElementTypeMask old_mask);
+        const std::vector<Entity*>& get_view_members(ElementTypeMask mask);
+
+        // File contents only; load_from_file() adds on_load().
+        static std::unique_ptr<Realm> read_file(const std::string& path);
+        static std::unique_ptr<Realm> read_json_file(const std::string& path);
+        static std::unique_ptr<Realm> read_binary_file(const std::string& path);
+        bool write_json_file(const std::string& path) const;
+        bool write_binary_file(const std::string& path) const;
+
         // Grant access to Cereal for serialization
         friend class cereal::access;
         template <class Archive>
@@ -0,0 +1,71 @@
+// =================================================================================
+// Filename:    Salix/ecs/RealmFileFormat.h
+// Author:      SalixGameStudio
+// Description: Declares the on-disk layouts a Realm can be saved in, including
+//              the versioned binary format that is loaded from a mapped file.
+// =================================================================================
+#pragma once
+
+#include <cstdint>
+
+namespace Salix {
+
+    enum class RealmFileFormat {
+        Unknown,
+        Json,       // cereal JSON; human readable, the editor's default.
+        Binary      // RealmBinaryHeader layout below.
+    };
+
+    // Binary layout, every section 8-byte aligned and little-endian:
+    //   RealmBinaryHeader
+    //   string table:  uint32 count, uint32 offsets[count + 1], then the bytes.
+    //                  String i is bytes[offsets[i], offsets[i + 1]).
+    //   entity table:  RealmBinaryEntity[entity_count]
+    //   element blocks, one per element type, each:
+    //                  RealmBinaryBlock, RealmBinaryElementRef[element_count],
+    //                  then payload_size bytes of cereal binary data holding
+    //                  element_count polymorphic elements in ref order.
+    // Names are stored once in the string table, and elements of one type sit
+    // next to each other, so loading is a walk over the mapped file.
+    namespace RealmBinary {
+        constexpr char MAGIC[4] = { 'S', 'R', 'L', 'M' };
+        // Bump when the layout or any element's binary serialize() changes;
+        // files of another version are refused and must be converted again.
+        constexpr uint32_t VERSION = 1;
+        constexpr uint32_t NO_STRING = 0xFFFFFFFFu;
+    }
+
+    struct RealmBinaryHeader {
+        char magic[4];
+        uint32_t version;
+        uint32_t name_string;
+        uint32_t path_string;
+        uint64_t main_camera_entity_id;
+        uint32_t entity_count;
+        uint32_t block_count;
+        uint64_t string_table_offset;
+        uint64_t entity_table_offset;
+        uint64_t blocks_offset;
+        uint64_t file_size;
+    };
+
+    struct RealmBinaryEntity {
+        uint64_t id;
+        uint32_t name_string;
+        uint32_t element_count;
+    };
+
+    struct RealmBinaryBlock {
+        uint32_t type_name_string;  // Element::get_class_name() of every element in the block.
+        uint32_t element_count;
+        uint64_t payload_size;
+    };
+
+    // Where an element goes: the entity table index and its position in that
+    // entity's element list, so the original order survives the grouping.
+    struct RealmBinaryElementRef {
+        uint32_t entity_index;
+        uint32_t slot;
+    };
+
+} // namespace Salix
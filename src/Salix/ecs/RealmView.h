@@ -0,0 +1,110 @@
+// =================================================================================
+// Filename:    Salix/ecs/RealmView.h
+// Author:      SalixGameStudio
+// Description: Declares RealmView, an allocation-free query over the entities
+//              of a Realm that carry a given set of element types.
+// =================================================================================
+#pragma once
+
+#include <Salix/ecs/Realm.h>
+#include <Salix/ecs/Entity.h>
+#include <Salix/ecs/ElementTypeRegistry.h>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace Salix {
+
+    // A lightweight window onto one of the Realm's cached membership lists.
+    // Copying or iterating a view never allocates; purged entities that are
+    // still waiting for Realm::maintain() are skipped. Ts must be concrete
+    // element types (interfaces like ICamera are not tracked in the masks).
+    // A type registered past MAX_ELEMENT_TYPES has no mask bit, so the list
+    // cannot vouch for it; such views check each entity for the elements.
+    //
+    //     for (Entity* entity : realm->view<Transform, Sprite2D>()) { ... }
+    //     realm->view<Transform, BoxCollider>().each(
+    //         [](Entity& entity, Transform& transform, BoxCollider& collider) { ... });
+    template<typename... Ts>
+    class RealmView {
+        public:
+            class iterator {
+                public:
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type = Entity*;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = Entity* const*;
+                    using reference = Entity*;
+
+                    iterator(const std::vector<Entity*>* members, size_t index, bool check_elements)
+                        : members(members), index(index), check_elements(check_elements) { skip_unmatched(); }
+
+                    Entity* operator*() const { return (*members)[index]; }
+                    iterator& operator++() { ++index; skip_unmatched(); return *this; }
+                    iterator operator++(int) { iterator previous = *this; ++(*this); return previous; }
+                    bool operator==(const iterator& other) const { return index == other.index; }
+                    bool operator!=(const iterator& other) const { return index != other.index; }
+
+                private:
+                    // Indexing (rather than holding a vector iterator) keeps the
+                    // loop valid if an entity joins the list while it runs.
+                    void skip_unmatched() {
+                        while (index < members->size() && !matches((*members)[index])) {
+                            ++index;
+                        }
+                    }
+                    bool matches(Entity* entity) const {
+                        if (entity->is_purged()) return false;
+                        return !check_elements || ((entity->template get_element<Ts>() != nullptr) && ...);
+                    }
+                    const std::vector<Entity*>* members;
+                    size_t index;
+                    bool check_elements;
+            };
+
+            RealmView(const std::vector<Entity*>& members, bool check_elements)
+                : members(&members), check_elements(check_elements) {}
+
+            iterator begin() const { return iterator(members, 0, check_elements); }
+            iterator end() const { return iterator(members, members->size(), check_elements); }
+
+            // Size of the membership list: an upper bound that also counts
+            // entities not yet maintained away and, for types without a mask
+            // bit, entities that lack them.
+            size_t size() const { return members->size(); }
+            bool empty() const { return begin() == end(); }
+
+            // Calls func(Entity&, Ts&...) for every matching entity.
+            template<typename Func>
+            void each(Func&& func) const {
+                for (size_t i = 0; i < members->size(); ++i) {
+                    Entity* entity = (*members)[i];
+                    if (entity->is_purged()) continue;
+                    std::tuple<Ts*...> elements{ entity->template get_element<Ts>()... };
+                    // Types registered past MAX_ELEMENT_TYPES have no mask bit, so
+                    // the membership list cannot vouch for them.
+                    const bool complete = std::apply([](auto*... element) { return ((element != nullptr) && ...); }, elements);
+                    if (!complete) continue;
+                    std::apply([&func, entity](auto*... element) { func(*entity, *element...); }, elements);
+                }
+            }
+
+        private:
+            const std::vector<Entity*>* members;
+            bool check_elements;
+    };
+
+
+    template<typename... Ts>
+    RealmView<Ts...> Realm::view() {
+        static_assert(sizeof...(Ts) > 0, "Realm::view needs at least one element type");
+        const ElementTypeMask mask = (element_type_bit(ElementTypeIdOf<Ts>::get()) | ...);
+        // With no bits at all the list holds every entity, so this check is
+        // what keeps an unmapped query from matching everything.
+        const bool mask_is_exact = ((element_type_bit(ElementTypeIdOf<Ts>::get()) != 0) && ...);
+        return RealmView<Ts...>(get_view_members(mask), !mask_is_exact);
+    }
+
+} // namespace Salix
@@ -17,76 +17,71 @@
 
 namespace Salix {
 
-    struct Sprite2D::Pimpl {
-        ITexture* texture = nullptr;
-            int width = 0;
-            int height = 0;
-            InitContext context;
-            Pimpl() = default;
-
-            template <class Archive>
-            void serialize(Archive& archive) {
-                std::cout << "Sprite2D: Pimpl: serilialze entered."
-                archive(
-                    /* Nothing to serialize here as these members will be initailzed at runtime.*/
-                );
-            }
-    };
-    
-    Sprite2D::Sprite2D() : pimpl(std::make_unique<Pimpl>()){
+    Sprite2D::Sprite2D() : Sprite2D(ElementStorage::get().sprites().allocate(this)) {}
+
+    Sprite2D::Sprite2D(uint32_t storage_slot) :
+        color(ElementStorage::get().sprites().get_chunk_of(storage_slot).colors[storage_slot % ELEMENT_CHUNK_CAPACITY]),
+        sorting_layer(ElementStorage::get().sprites().get_chunk_of(storage_slot).sorting_layers[storage_slot % ELEMENT_CHUNK_CAPACITY]),
+        slot(storage_slot),
+        chunk(&ElementStorage::get().sprites().get_chunk_of(storage_slot)),
+        index(storage_slot % ELEMENT_CHUNK_CAPACITY) {
+
         pivot = { 0.5f, 0.5f };
         texture_path = "";
         color = White;
+        sorting_layer = 0;
+        chunk->textures[index] = nullptr;
         set_name(get_class_name());
     }
         
 
-    Sprite2D::~Sprite2D() = default;
+    Sprite2D::~Sprite2D() {
+        ElementStorage::get().sprites().release(slot);
+    }
 
     void Sprite2D::on_load(const InitContext& new_context) {
-        pimpl->context = new_context;
         if (texture_path.empty()) { return; }
-        load_texture(pimpl->context.asset_manager, texture_path);
+        load_texture(new_context.asset_manager, texture_path);
     }
     
-    int Sprite2D::get_texture_width() const { return pimpl->width; }
+    int Sprite2D::get_texture_width() const { return chunk->textures[index] ? chunk->textures[index]->get_width() : 0; }
+
+    int Sprite2D::get_texture_height() const { return chunk->textures[index] ? chunk->textures[index]->get_height() : 0; }
 
-    int Sprite2D::get_texture_height() const { return pimpl->height; }
+    bool Sprite2D::is_texture_ready() const { return chunk->textures[index] && chunk->textures[index]->is_ready(); }
 
     ITexture* Sprite2D::get_texture() const {
-        return pimpl->texture;
+        // Streamed textures stand in for a placeholder until they are uploaded.
+        return chunk->textures[index] ? chunk->textures[index]->resolve() : nullptr;
     }
 
     void Sprite2D::load_texture(AssetManager* asset_manager, const std::string& relative_file_path) {
         if (relative_file_path.empty()) {
             std::cerr << "Warning: Sprite2D::load_texture called with an empty path." << std::endl;
-            pimpl->texture = nullptr; // Explicitly nullify
-            pimpl->width = 0;         // Reset dimensions
-            pimpl->height = 0;        // Reset dimensions
+            texture_handle.reset();
+            chunk->textures[index] = nullptr; // Explicitly nullify
             return;
         }
 
         // 1. Store the portable, project-relative path.
         this->texture_path = relative_file_path;
 
-        // 2. Ask the AssetManager to load it using the relative path.
-        //    The AssetManager is now responsible for converting it to an absolute path.
-        pimpl->texture = asset_manager->get_texture(this->texture_path);
-
-        // 3. Update dimensions if the texture was loaded successfully.
-        if (pimpl->texture) {
-            pimpl->width = pimpl->texture->get_width();
-            pimpl->height = pimpl->texture->get_height();
-        } else {
-            pimpl->width = 0;
-            pimpl->height = 0;
+        // 2. Intern the path once; reloading the same path is an id lookup.
+        if (this->texture_path != texture_id_path) {
+            texture_id = AssetId::from_path(this->texture_path);
+            texture_id_path = this->texture_path;
+        }
+        texture_handle = asset_manager->request_texture(texture_id);
+        chunk->textures[index] = texture_handle.get();
+
+        if (!chunk->textures[index]) {
             std::cerr << "Warning: Failed to load texture for Sprite2D using relative path: " << this->texture_path << std::endl;
         }
     }
 
     void Sprite2D::render(IRenderer* renderer) {
         // Check that we have everything we need to draw
-        if (pimpl->texture && owner && renderer) {
+        if (chunk->textures[index] && owner && renderer) {
             // Get the owner's Transform, which contains all positional data
             Transform* transform = owner->get_transform();
 
@@ -102,8 +97,8 @@ namespace Salix {
                 }
                 
                 // One simple call to the renderer. The renderer will read the
-                // transform and do all the complex work.
-                renderer->draw_sprite(pimpl->texture, transform, color, flip_state);
+                // transform and do all the complex work (or queue it, inside a batch).
+                renderer->submit_sprite(chunk->textures[index]->resolve(), transform, color, flip_state, sorting_layer);
             }
         }
     }
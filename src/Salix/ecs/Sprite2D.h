@@ -2,8 +2,11 @@
 #pragma once
 
 #include <Salix/core/Core.h>
+#include <Salix/assets/AssetHandle.h>
+#include <Salix/assets/AssetId.h>
 #include <Salix/math/Color.h>
 #include <Salix/ecs/RenderableElement2D.h>
+#include <Salix/ecs/ElementStorage.h>
 #include <Salix/math/Vector2.h>  // For the pivot and offset.
 #include <string>
 #include <memory>
@@ -22,6 +25,7 @@ namespace Salix {
             Sprite2D();
             virtual ~Sprite2D();
             const char* get_class_name() const override { return "Sprite2D"; } 
+            bool is_update_thread_safe() const override { return true; }
             void on_load(const InitContext& new_context) override;
             // A method to load a texture for this sprite using the AssetManager
             void load_texture(class AssetManager* asset_manager, const std::string& file_path);
@@ -36,12 +40,12 @@ namespace Salix {
             // --- Properties ---
             bool use_entity_rotation = false;  // For use with hybrid rendering pipeline, set to true when camera is in 'perspective' mode.
             float local_rotation = 0.0f;  // For 2D rotation in degrees.
-            Color color;                // Color property for color tinting.
+            Color& color;               // Color property for color tinting (lives in Sprite2DChunk).
             Vector2 offset;             // A local offset from the Transform's position
             Vector2 pivot;              // Normalized pivot point (0,0 = top-left, 1,1 = bottom-right).
             bool flip_h = false;        // Flip horizontally?
             bool flip_v = false;        // Flip veritcally?
-            int sorting_layer = 0;      // For future use in the Scene.
+            int& sorting_layer;         // For future use in the Scene (lives in Sprite2DChunk).
             std::string texture_path;   // The path to the image used as the texture.
 
             // Getters for MODIFICATION (non-const, return by reference)
@@ -90,14 +94,34 @@ namespace Salix {
             const std::string& get_texture_path() const;
             void set_texture_path(const std::string& new_texture_path) { texture_path = new_texture_path; }
 
+            // Read from the texture itself, so a streamed texture reports its
+            // placeholder's size until the upload lands and its own after.
             int get_texture_width() const;
             int get_texture_height() const;
+            // False while a streamed texture still shows its placeholder.
+            bool is_texture_ready() const;
 
             ITexture* get_texture() const;
 
+            // Position of this sprite's data inside ElementStorage::sprites().
+            uint32_t get_storage_slot() const { return slot; }
+
         private:
-            struct Pimpl;
-            std::unique_ptr<Pimpl>pimpl;
+            // Binds the public 'color' and 'sorting_layer' references to an
+            // already claimed storage slot.
+            explicit Sprite2D(uint32_t storage_slot);
+            Sprite2D(const Sprite2D&) = delete;
+            Sprite2D& operator=(const Sprite2D&) = delete;
+
+            uint32_t slot = INVALID_ELEMENT_SLOT;
+            Sprite2DChunk* chunk = nullptr;
+            uint32_t index = 0;
+            // Keeps the texture resident; chunk->textures[index] is the raw copy render() reads.
+            TextureHandle texture_handle;
+            // Interned id for texture_id_path; rebuilt only when texture_path changes.
+            AssetId texture_id;
+            std::string texture_id_path;
+
             friend class cereal::access;
             template<class Archive>
             void serialize(Archive& archive);
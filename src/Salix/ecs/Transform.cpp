@@ -1,5 +1,6 @@
 // Salix/ecs/Transform.cpp
 #include <Salix/ecs/Transform.h>
+#include <Salix/ecs/ElementStorage.h>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/quaternion.hpp>
@@ -23,42 +24,65 @@
 #include <glm/gtx/matrix_decompose.hpp>
 
 namespace Salix {
-    struct Transform::Pimpl {
-        Transform* parent = nullptr;  // Runtime varaible
-        std::vector<Transform*> children;  // Runtime variable
-        
-        // Local transform properties (relative to its parent)
-        Vector3 position;
-        Vector3 rotation;
-        Vector3 scale;
-        Pimpl() = default;
-        template <class Archive>
-        void serialize(Archive & archive) {
-
-            // Nothing to serialize here as all Pimpl members are runtime variables.
+
+    namespace {
+        // translate * Rz * Ry * Rx * scale, with rotations in degrees.
+        glm::mat4 compose_local_matrix(const Vector3& position, const Vector3& rotation, const Vector3& scale) {
+            const glm::mat4 transform_x = glm::rotate(glm::mat4(1.0f), glm::radians(rotation.x),
+                glm::vec3(1.0f, 0.0f, 0.0f));
+            const glm::mat4 transform_y = glm::rotate(glm::mat4(1.0f), glm::radians(rotation.y),
+                glm::vec3(0.0f, 1.0f, 0.0f));
+            const glm::mat4 transform_z = glm::rotate(glm::mat4(1.0f), glm::radians(rotation.z),
+                glm::vec3(0.0f, 0.0f, 1.0f));
+            const glm::mat4 rotation_matrix = transform_z * transform_y * transform_x;
+            return glm::translate(glm::mat4(1.0f), position.to_glm()) *
+                   rotation_matrix *
+                   glm::scale(glm::mat4(1.0f), scale.to_glm());
         }
-    };
 
-    Transform::Transform() : pimpl(std::make_unique<Pimpl>()) {
+        // Interpolates each angle the short way round, so 350 -> 10 passes through 0.
+        float lerp_degrees(float from, float to, float alpha) {
+            float delta = std::fmod(to - from, 360.0f);
+            if (delta > 180.0f) delta -= 360.0f;
+            else if (delta < -180.0f) delta += 360.0f;
+            return from + delta * alpha;
+        }
+    }
+
+    Transform::Transform() {
+        // Claim a slot in the shared SoA storage; all of our state lives there.
+        auto& storage = ElementStorage::get().transforms();
+        slot = storage.allocate(this);
+        chunk = &storage.get_chunk_of(slot);
+        index = storage.get_index_in_chunk(slot);
+
         // Default scale is 1, so objects appear at thier normal size.
-        pimpl->position = { 0.0f, 0.0f, 0.0f };
-        pimpl->rotation = { 0.0f, 0.0f, 0.0f };
-        pimpl->scale = { 1.0f, 1.0f, 1.0f};
+        chunk->positions[index] = { 0.0f, 0.0f, 0.0f };
+        chunk->rotations[index] = { 0.0f, 0.0f, 0.0f };
+        chunk->scales[index] = { 1.0f, 1.0f, 1.0f};
+        chunk->parents[index] = nullptr;
+        chunk->children[index].clear();
+        chunk->dirty_flags[index] = TRANSFORM_ALL_DIRTY | TRANSFORM_NO_PREVIOUS;
+        ElementStorage::get().bump_transform_hierarchy_version();
         set_name(get_class_name());
     }
 
     Transform::~Transform() {
         
         // When a Transform is destroyed it must detatch itself from its parent.
-        if (pimpl->parent) {
-            pimpl->parent->remove_child(this);
+        if (chunk->parents[index]) {
+            chunk->parents[index]->remove_child(this);
         }
 
         // It must also orphan all of its children by calling their public API.
-        while (!pimpl->children.empty()) {
-            pimpl->children.front()->set_parent(nullptr);
+        while (!chunk->children[index].empty()) {
+            chunk->children[index].front()->set_parent(nullptr);
         }
-            
+
+        // Hand the slot back. The children vector keeps its capacity for the next owner.
+        chunk->parents[index] = nullptr;
+        ElementStorage::get().transforms().release(slot);
+        ElementStorage::get().bump_transform_hierarchy_version();
     }
 
     void Transform::update(float delta_time) {
@@ -69,14 +93,14 @@ namespace Salix {
    
 
     Transform* Transform::get_parent() const{
-        return pimpl->parent;
+        return chunk->parents[index];
     }
     
 
     // Test Code
     void Transform::set_parent(Transform* new_parent) {
         // Prevent invalid operations
-        if (pimpl->parent == new_parent) return;
+        if (chunk->parents[index] == new_parent) return;
         if (new_parent == this) return;
         if (new_parent && new_parent->is_child_of(this)) {
             std::cerr << "Circular transform hierarchy detected" << std::endl;
@@ -87,13 +111,15 @@ namespace Salix {
         glm::mat4 old_child_world_matrix = get_model_matrix();
 
         // --- 2. Update the hierarchy pointers ---
-        if (pimpl->parent) {
-            pimpl->parent->remove_child(this);
+        if (chunk->parents[index]) {
+            chunk->parents[index]->remove_child(this);
         }
-        pimpl->parent = new_parent;
-        if (pimpl->parent) {
-            pimpl->parent->add_child(this);
+        chunk->parents[index] = new_parent;
+        if (chunk->parents[index]) {
+            chunk->parents[index]->add_child(this);
         }
+        ElementStorage::get().bump_transform_hierarchy_version();
+        mark_world_dirty();
 
         // --- 3. Calculate new local state to preserve world state ---
         if (new_parent) {
@@ -131,7 +157,7 @@ namespace Salix {
 
     bool Transform::is_child_of(const Transform* potential_parent) const {
         if (!potential_parent) return false;
-        for (Transform* current = pimpl->parent; current != nullptr; current = current->get_parent()) {
+        for (Transform* current = chunk->parents[index]; current != nullptr; current = current->get_parent()) {
             if (current == potential_parent) {
                 return true;
             }
@@ -142,30 +168,30 @@ namespace Salix {
 
 
 
-    const std::vector<Transform*>& Transform::get_children() const {
-        return pimpl->children;
+    const PoolVector<Transform*>& Transform::get_children() const {
+        return chunk->children[index];
     }
 
     // --- Private Method Implementations ---
 
     void Transform::add_child(Transform* child) {
         // Check to prevent adding duplicates.
-        if (std::find(pimpl->children.begin(), pimpl->children.end(), child) == pimpl->children.end()) {
-            pimpl->children.push_back(child);
+        if (std::find(chunk->children[index].begin(), chunk->children[index].end(), child) == chunk->children[index].end()) {
+            chunk->children[index].push_back(child);
         }
     }
 
     void Transform::remove_child(Transform* child) {
         // This is the standard "erase-remove idiom". It's safe and efficient.
-        pimpl->children.erase(
-            std::remove(pimpl->children.begin(), pimpl->children.end(), child),
-            pimpl->children.end()
+        chunk->children[index].erase(
+            std::remove(chunk->children[index].begin(), chunk->children[index].end(), child),
+            chunk->children[index].end()
         );
     }
 
 
     void Transform::release_from_parent() {
-        if (!pimpl->parent) return;
+        if (!chunk->parents[index]) return;
         
         // 2. Get our current world-space values BEFORE detaching.
         Vector3 world_position = get_world_position();
@@ -191,35 +217,37 @@ namespace Salix {
 
 
     Vector3 Transform::get_world_rotation() const {
-        // A more robust way to get world rotation from the model matrix
-        glm::mat4 world_matrix = get_model_matrix();
-        glm::vec3 scale;
-        glm::quat rotation_quat;
-        glm::vec3 position;
-        glm::vec3 skew;
-        glm::vec4 perspective;
-        glm::decompose(world_matrix, scale, rotation_quat, position, skew, perspective);
-        return Vector3(glm::degrees(glm::eulerAngles(rotation_quat)));
+        update_world_decomposition();
+        return chunk->world_rotations[index];
     }
    
     
     Vector3 Transform::get_world_scale() const {
-        // A more robust way to get world scale from the model matrix
-        glm::mat4 world_matrix = get_model_matrix();
+        update_world_decomposition();
+        return chunk->world_scales[index];
+    }
+
+
+    void Transform::update_world_decomposition() const {
+        // Decomposing is the expensive part of the world getters, so do it once
+        // per change and keep both results.
+        if (!(chunk->dirty_flags[index] & TRANSFORM_DECOMPOSED_DIRTY)) return;
         glm::vec3 scale;
         glm::quat rotation_quat;
         glm::vec3 position;
         glm::vec3 skew;
         glm::vec4 perspective;
-        glm::decompose(world_matrix, scale, rotation_quat, position, skew, perspective);
-        return Vector3(scale);
+        glm::decompose(get_world_matrix(), scale, rotation_quat, position, skew, perspective);
+        chunk->world_rotations[index] = Vector3(glm::degrees(glm::eulerAngles(rotation_quat)));
+        chunk->world_scales[index] = Vector3(scale);
+        chunk->dirty_flags[index] &= ~TRANSFORM_DECOMPOSED_DIRTY;
     }
 
     void Transform::set_world_position(const Vector3& world_position) {
-        if (pimpl->parent) {
+        if (chunk->parents[index]) {
             // If there's a parent, calculate the new local position required
             // to achieve the desired world position.
-            glm::mat4 parent_world_inverse = glm::inverse(pimpl->parent->get_model_matrix());
+            glm::mat4 parent_world_inverse = glm::inverse(chunk->parents[index]->get_model_matrix());
             glm::vec4 new_local_position_4 = parent_world_inverse * glm::vec4(world_position.x, world_position.y, world_position.z, 1.0f);
             set_position(Vector3(new_local_position_4.x, new_local_position_4.y, new_local_position_4.z));
         } else {
@@ -232,9 +260,9 @@ namespace Salix {
         // Convert the desired world rotation from Euler degrees to a quaternion
         glm::quat world_rotation_quat = glm::quat(glm::radians(world_rotation_deg.to_glm()));
         
-        if (pimpl->parent) {
+        if (chunk->parents[index]) {
             // Get the parent's world rotation as a quaternion
-            glm::mat4 parent_world_matrix = pimpl->parent->get_model_matrix();
+            glm::mat4 parent_world_matrix = chunk->parents[index]->get_model_matrix();
             glm::quat parent_world_rotation_quat = glm::quat_cast(parent_world_matrix);
             
             // Calculate the new local rotation by "subtracting" the parent's world rotation
@@ -251,7 +279,7 @@ namespace Salix {
     }
 
     void Transform::set_world_scale(const Vector3& world_scale) {
-        if (pimpl->parent) {
+        if (chunk->parents[index]) {
             // This is a robust way to handle scale in a hierarchy without simple division.
             // We build a target world matrix with the new scale, then convert it back to local space.
             glm::mat4 target_world_matrix;
@@ -263,7 +291,7 @@ namespace Salix {
             target_world_matrix = trans * rot * scale;
             // --- End of GLM-only matrix construction ---
 
-            glm::mat4 parent_world_inverse = glm::inverse(pimpl->parent->get_model_matrix());
+            glm::mat4 parent_world_inverse = glm::inverse(chunk->parents[index]->get_model_matrix());
             glm::mat4 new_local_matrix = parent_world_inverse * target_world_matrix;
 
             // Decompose the new local matrix to get the final local scale
@@ -283,8 +311,8 @@ namespace Salix {
     // Hierarchical calculation helpers.
     // Converts the  world_position (absolute position) to the local position (relative to parent).
     Vector3 Transform::world_to_local_position(const Vector3& world_pos) const {
-        if (!pimpl->parent) return world_pos;
-        glm::vec4 local = glm::inverse(pimpl->parent->get_model_matrix()) * 
+        if (!chunk->parents[index]) return world_pos;
+        glm::vec4 local = glm::inverse(chunk->parents[index]->get_model_matrix()) * 
                         glm::vec4(world_pos.x, world_pos.y, world_pos.z, 1.0f);
         return Vector3(local.x, local.y, local.z);
     }
@@ -295,8 +323,8 @@ namespace Salix {
         // 1. Get the parent's world matrix.
         // If there is no parent, the "parent" is the world itself,
         // and its transformation matrix is the identity matrix.
-        glm::mat4 parent_world_matrix = pimpl->parent ? 
-            pimpl->parent->get_model_matrix() : 
+        glm::mat4 parent_world_matrix = chunk->parents[index] ? 
+            chunk->parents[index]->get_model_matrix() : 
             glm::mat4(1.0f);
 
         // 2. Transform the local point by the parent's world matrix.
@@ -351,85 +379,97 @@ namespace Salix {
 
     // --- POSITION ---
     void Transform::set_position(const Vector3& new_position) {
-        pimpl->position = new_position;
+        chunk->positions[index] = new_position;
+        mark_local_dirty();
     }
     void Transform::set_position(const float new_x, float new_y, float new_z) {
-        pimpl->position = { new_x, new_y, new_z };
+        chunk->positions[index] = { new_x, new_y, new_z };
+        mark_local_dirty();
     }
     
 
     // --- ROTATION ---
     void Transform::set_rotation(const Vector3& new_rotation) {
-        pimpl->rotation = new_rotation;
+        chunk->rotations[index] = new_rotation;
+        mark_local_dirty();
     }
     void Transform::set_rotation(const float new_x, float new_y, float new_z) {
-        pimpl->rotation = { new_x, new_y, new_z };
+        chunk->rotations[index] = { new_x, new_y, new_z };
+        mark_local_dirty();
     }
 
     // --- SCALE ---
     void Transform::set_scale(const Vector3& new_scale) {
-        pimpl->scale = new_scale;
+        chunk->scales[index] = new_scale;
+        mark_local_dirty();
     }
     void Transform::set_scale(const float new_x, float new_y, float new_z) {
-        pimpl->scale = { new_x, new_y, new_z };
+        chunk->scales[index] = { new_x, new_y, new_z };
+        mark_local_dirty();
     }
 
     // --- TRANSLATORS ---
     void Transform::translate(const Vector3& delta_position) {
-        pimpl->position += delta_position;
+        chunk->positions[index] += delta_position;
+        mark_local_dirty();
     }
     void Transform::translate(const float new_dp_x, float new_dp_y, float new_dp_z) {
-        pimpl->position += { new_dp_x, new_dp_y, new_dp_z };
+        chunk->positions[index] += { new_dp_x, new_dp_y, new_dp_z };
+        mark_local_dirty();
     }
 
     void Transform::translate(const glm::vec3& delta_position){
-        pimpl->position.x += delta_position.x;
-        pimpl->position.y += delta_position.y;
-        pimpl->position.z += delta_position.z;
+        chunk->positions[index].x += delta_position.x;
+        chunk->positions[index].y += delta_position.y;
+        chunk->positions[index].z += delta_position.z;
+        mark_local_dirty();
     }
 
     void Transform::rotate(const Vector3& delta_rotation) {
-     pimpl->rotation += delta_rotation;
+     chunk->rotations[index] += delta_rotation;
+     mark_local_dirty();
     }
 
     void Transform::rotate(const float new_dr_x, float new_dr_y, float new_dr_z) {
-     pimpl->rotation += { new_dr_x, new_dr_y, new_dr_z};
+     chunk->rotations[index] += { new_dr_x, new_dr_y, new_dr_z};
+     mark_local_dirty();
     }
 
     void Transform::rotate(const glm::vec3& delta_rotation) {
-    pimpl->rotation.x += delta_rotation.x;
-    pimpl->rotation.y += delta_rotation.y;
-    pimpl->rotation.z += delta_rotation.z;
+    chunk->rotations[index].x += delta_rotation.x;
+    chunk->rotations[index].y += delta_rotation.y;
+    chunk->rotations[index].z += delta_rotation.z;
+    mark_local_dirty();
     }
 
     const Vector3& Transform::get_position() const {
-    return pimpl->position;
+    return chunk->positions[index];
 }
 
     const Vector3& Transform::get_rotation() const {
-        return pimpl->rotation;
+        return chunk->rotations[index];
     }
 
     const Vector3& Transform::get_scale() const {
-        return pimpl->scale;
+        return chunk->scales[index];
     }
 
 
     glm::vec3 Transform::get_forward() const {
         // Convert the stored degrees to radians FOR THE CALCULATION
-        glm::quat orientation = glm::quat(glm::radians(pimpl->rotation.to_glm()));
+        glm::quat orientation = glm::quat(glm::radians(chunk->rotations[index].to_glm()));
         return orientation * glm::vec3(0.0f, 0.0f, -1.0f);
     }
 
     glm::vec3 Transform::get_up() const {
         // Convert the stored degrees to radians FOR THE CALCULATION
-        glm::quat orientation = glm::quat(glm::radians(pimpl->rotation.to_glm()));
+        glm::quat orientation = glm::quat(glm::radians(chunk->rotations[index].to_glm()));
         return orientation * glm::vec3(0.0f, 1.0f, 0.0f);
     }
 
     glm::vec3 Transform::get_right() const {
         // Convert the stored degrees to radians FOR THE CALCULATION
-        glm::quat orientation = glm::quat(glm::radians(pimpl->rotation.to_glm()));
+        glm::quat orientation = glm::quat(glm::radians(chunk->rotations[index].to_glm()));
         return orientation * glm::vec3(1.0f, 0.0f, 0.0f);
     }
 
@@ -437,25 +477,96 @@ namespace Salix {
 
 
     glm::mat4 Transform::get_model_matrix() const {
-        // 1. Calculate this transform's local matrix. Your existing code is perfect.
-        const glm::mat4 transform_x = glm::rotate(glm::mat4(1.0f), glm::radians(pimpl->rotation.x),
-            glm::vec3(1.0f, 0.0f, 0.0f));
-        const glm::mat4 transform_y = glm::rotate(glm::mat4(1.0f), glm::radians(pimpl->rotation.y),
-            glm::vec3(0.0f, 1.0f, 0.0f));
-        const glm::mat4 transform_z = glm::rotate(glm::mat4(1.0f), glm::radians(pimpl->rotation.z),
-            glm::vec3(0.0f, 0.0f, 1.0f));
-        const glm::mat4 rotation_matrix = transform_z * transform_y * transform_x;
-        const glm::mat4 local_matrix = glm::translate(glm::mat4(1.0f), pimpl->position.to_glm()) *
-                                    rotation_matrix *
-                                    glm::scale(glm::mat4(1.0f), pimpl->scale.to_glm());
-
-        // 2. If we have a parent, multiply our local matrix by our parent's world matrix.
-        if (pimpl->parent) {
-            return pimpl->parent->get_model_matrix() * local_matrix;
+        return get_world_matrix();
+    }
+
+
+    const glm::mat4& Transform::get_world_matrix() const {
+        uint8_t& flags = chunk->dirty_flags[index];
+        if (flags & TRANSFORM_WORLD_DIRTY) {
+            // Our parent's world matrix is itself cached, so only the dirty part
+            // of the chain is rebuilt.
+            const Transform* parent = chunk->parents[index];
+            chunk->world_matrices[index] = parent ?
+                parent->get_world_matrix() * get_local_matrix() :
+                get_local_matrix();
+            flags &= ~TRANSFORM_WORLD_DIRTY;
+        }
+        return chunk->world_matrices[index];
+    }
+
+
+    Vector3 Transform::get_interpolated_position(float alpha) const {
+        if (alpha >= 1.0f || (chunk->dirty_flags[index] & TRANSFORM_NO_PREVIOUS)) {
+            return chunk->positions[index];
+        }
+        const Vector3& from = chunk->previous_positions[index];
+        return from + (chunk->positions[index] - from) * alpha;
+    }
+
+    Vector3 Transform::get_interpolated_rotation(float alpha) const {
+        if (alpha >= 1.0f || (chunk->dirty_flags[index] & TRANSFORM_NO_PREVIOUS)) {
+            return chunk->rotations[index];
+        }
+        const Vector3& from = chunk->previous_rotations[index];
+        const Vector3& to = chunk->rotations[index];
+        return Vector3(lerp_degrees(from.x, to.x, alpha),
+                       lerp_degrees(from.y, to.y, alpha),
+                       lerp_degrees(from.z, to.z, alpha));
+    }
+
+    Vector3 Transform::get_interpolated_scale(float alpha) const {
+        if (alpha >= 1.0f || (chunk->dirty_flags[index] & TRANSFORM_NO_PREVIOUS)) {
+            return chunk->scales[index];
+        }
+        const Vector3& from = chunk->previous_scales[index];
+        return from + (chunk->scales[index] - from) * alpha;
+    }
+
+    glm::mat4 Transform::get_interpolated_world_matrix(float alpha) const {
+        if (alpha >= 1.0f) {
+            return get_world_matrix();
+        }
+        const glm::mat4 local = compose_local_matrix(get_interpolated_position(alpha),
+            get_interpolated_rotation(alpha), get_interpolated_scale(alpha));
+        const Transform* parent = chunk->parents[index];
+        return parent ? parent->get_interpolated_world_matrix(alpha) * local : local;
+    }
+
+    void Transform::reset_interpolation() {
+        chunk->previous_positions[index] = chunk->positions[index];
+        chunk->previous_rotations[index] = chunk->rotations[index];
+        chunk->previous_scales[index] = chunk->scales[index];
+        chunk->dirty_flags[index] &= ~TRANSFORM_NO_PREVIOUS;
+    }
+
+
+    const glm::mat4& Transform::get_local_matrix() const {
+        uint8_t& flags = chunk->dirty_flags[index];
+        if (!(flags & TRANSFORM_LOCAL_DIRTY)) {
+            return chunk->local_matrices[index];
+        }
+        chunk->local_matrices[index] = compose_local_matrix(chunk->positions[index],
+            chunk->rotations[index], chunk->scales[index]);
+        flags &= ~TRANSFORM_LOCAL_DIRTY;
+        return chunk->local_matrices[index];
+    }
+
+
+    void Transform::mark_local_dirty() {
+        chunk->dirty_flags[index] |= TRANSFORM_LOCAL_DIRTY;
+        mark_world_dirty();
+    }
+
+
+    void Transform::mark_world_dirty() {
+        uint8_t& flags = chunk->dirty_flags[index];
+        // Already dirty means our whole subtree is too, so there is nothing left to do.
+        if (flags & TRANSFORM_WORLD_DIRTY) return;
+        flags |= TRANSFORM_WORLD_DIRTY | TRANSFORM_DECOMPOSED_DIRTY;
+        for (Transform* child : chunk->children[index]) {
+            child->mark_world_dirty();
         }
-        
-        // 3. If there's no parent, our local matrix is our world matrix.
-        return local_matrix;
     }
 
 
@@ -465,12 +576,15 @@ namespace Salix {
         archive(cereal::base_class<Element>(this));
 
         // 2. Then, serialize the data specific to the Transform class.
-        //    This reads/writes directly to your private pimpl members.
+        //    This reads/writes directly to our slot in the element storage.
         archive(
-            cereal::make_nvp("position", pimpl->position),
-            cereal::make_nvp("rotation", pimpl->rotation),
-            cereal::make_nvp("scale", pimpl->scale)
+            cereal::make_nvp("position", chunk->positions[index]),
+            cereal::make_nvp("rotation", chunk->rotations[index]),
+            cereal::make_nvp("scale", chunk->scales[index])
         );
+        if constexpr (Archive::is_loading::value) {
+            mark_local_dirty();
+        }
     }
 
     // --- ADD THESE LINES AT THE VERY END OF Transform.cpp ---
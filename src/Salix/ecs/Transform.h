@@ -3,6 +3,7 @@
 
 #include <Salix/core/Core.h>
 #include <Salix/ecs/Element.h>
+#include <Salix/ecs/ElementStorage.h>
 #include <Salix/math/Vector3.h>
 #include <vector>
 #include <memory>
@@ -18,6 +19,7 @@ namespace Salix {
             virtual ~Transform();
 
             const char* get_class_name() const override { return "Transform"; }
+            bool is_update_thread_safe() const override { return true; }
             void update(float delta_time) override;
             // Coordinate Distance calculations.
             Vector3 get_world_position_of_local_point(const Vector3& local_point) const;
@@ -61,27 +63,55 @@ namespace Salix {
             Transform* get_parent() const;
             void release_from_parent();
             bool is_child_of(const Transform* potential_parent) const;
-            const std::vector<Transform*>& get_children() const;
+            const PoolVector<Transform*>& get_children() const;
             
             glm::vec3 get_forward() const;
             glm::vec3 get_up() const;
             glm::vec3 get_right() const;
             
             glm::mat4 get_model_matrix() const;
+            // Cached matrices. They are rebuilt on demand after a setter or a
+            // reparent marks them dirty; unchanged transforms cost a lookup.
+            // Not safe to call concurrently with writes to the same hierarchy.
+            const glm::mat4& get_local_matrix() const;
+            const glm::mat4& get_world_matrix() const;
 
+            // --- Fixed-step interpolation ---
+            // Blend between the state captured at the start of the last tick
+            // (alpha 0) and the current state (alpha 1). A transform that has not
+            // been through a capture yet returns its current state.
+            Vector3 get_interpolated_position(float alpha) const;
+            Vector3 get_interpolated_rotation(float alpha) const;
+            Vector3 get_interpolated_scale(float alpha) const;
+            glm::mat4 get_interpolated_world_matrix(float alpha) const;
+            // Makes the previous state equal the current one, e.g. after a teleport.
+            void reset_interpolation();
 
             
+            // Position of this transform's data inside ElementStorage::transforms().
+            uint32_t get_storage_slot() const { return slot; }
+
         private:
-            
-            // All implementation details are hidden behind this single pointer
-            struct Pimpl;
-            std::unique_ptr<Pimpl>pimpl;
+            // A Transform is a thin handle: its position, rotation, scale and
+            // hierarchy links live in a shared structure-of-arrays chunk.
+            uint32_t slot = INVALID_ELEMENT_SLOT;
+            TransformChunk* chunk = nullptr;
+            uint32_t index = 0;
+
+            // Copying would leave two handles pointing at one slot.
+            Transform(const Transform&) = delete;
+            Transform& operator=(const Transform&) = delete;
+
             friend class cereal::access;
             template <class Archive>
             void serialize(Archive& archive);
             // Private methods called by set_parent and the destructor
             void add_child(Transform* child);
             void remove_child(Transform* child);
+            // Invalidate our cached matrices (and our descendants' world matrices).
+            void mark_local_dirty();
+            void mark_world_dirty();
+            void update_world_decomposition() const;
             // These members are now private.
             
     };
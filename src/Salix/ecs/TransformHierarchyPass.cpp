@@ -0,0 +1,217 @@
+// =================================================================================
+// Filename:    Salix/ecs/TransformHierarchyPass.cpp
+// Author:      SalixGameStudio
+// Description: Implements the batched world-transform pass.
+// =================================================================================
+#include <Salix/ecs/TransformHierarchyPass.h>
+#include <Salix/ecs/ElementStorage.h>
+#include <Salix/ecs/Transform.h>
+#include <Salix/core/JobSystem.h>
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+    #include <xmmintrin.h>
+    #define SALIX_TRANSFORM_PASS_SSE 1
+#endif
+
+namespace Salix {
+
+    namespace {
+        // out = parent * local for column-major 4x4 matrices. 'out' may not alias 'parent'.
+        inline void multiply_matrix(const glm::mat4& parent, const glm::mat4& local, glm::mat4& out) {
+        #ifdef SALIX_TRANSFORM_PASS_SSE
+            // Each result column is a linear combination of the parent's columns,
+            // weighted by the matching column of the local matrix.
+            const float* p = &parent[0][0];
+            const float* l = &local[0][0];
+            float* o = &out[0][0];
+            const __m128 p0 = _mm_loadu_ps(p);
+            const __m128 p1 = _mm_loadu_ps(p + 4);
+            const __m128 p2 = _mm_loadu_ps(p + 8);
+            const __m128 p3 = _mm_loadu_ps(p + 12);
+            for (int column = 0; column < 4; ++column) {
+                const float* l_column = l + column * 4;
+                __m128 result = _mm_mul_ps(p0, _mm_set1_ps(l_column[0]));
+                result = _mm_add_ps(result, _mm_mul_ps(p1, _mm_set1_ps(l_column[1])));
+                result = _mm_add_ps(result, _mm_mul_ps(p2, _mm_set1_ps(l_column[2])));
+                result = _mm_add_ps(result, _mm_mul_ps(p3, _mm_set1_ps(l_column[3])));
+                _mm_storeu_ps(o + column * 4, result);
+            }
+        #else
+            out = parent * local;
+        #endif
+        }
+
+        struct Node {
+            TransformChunk* chunk = nullptr;
+            uint32_t index = 0;
+            const Transform* transform = nullptr;
+            // Position of the parent in the node array, or -1 for a root.
+            int32_t parent = -1;
+        };
+    }
+
+
+    struct TransformHierarchyPass::Pimpl {
+        // Every live transform, each root followed by its whole subtree in pre-order.
+        std::vector<Node> nodes;
+        // [begin, end) node ranges, one per root.
+        std::vector<std::pair<size_t, size_t>> subtrees;
+        uint64_t built_version = ~0ull;
+
+        // The JobSystem's workers plus the calling thread.
+        unsigned int max_workers = JobSystem::get().get_worker_count() + 1;
+        size_t last_visited_count = 0;
+        size_t last_updated_count = 0;
+        unsigned int last_worker_count = 0;
+
+        void rebuild();
+        size_t update_range(size_t begin, size_t end);
+    };
+
+
+    TransformHierarchyPass& TransformHierarchyPass::get() {
+        // Leaked for the same reason as ElementStorage.
+        static TransformHierarchyPass* instance = new TransformHierarchyPass();
+        return *instance;
+    }
+
+    TransformHierarchyPass::TransformHierarchyPass() : pimpl(std::make_unique<Pimpl>()) {}
+    TransformHierarchyPass::~TransformHierarchyPass() = default;
+
+
+    void TransformHierarchyPass::Pimpl::rebuild() {
+        auto& storage = ElementStorage::get().transforms();
+        nodes.clear();
+        subtrees.clear();
+        nodes.reserve(storage.get_live_count());
+
+        std::vector<std::pair<const Transform*, int32_t>> stack;
+        storage.for_each_live([&](TransformChunk& root_chunk, uint32_t root_index) {
+            if (root_chunk.parents[root_index]) return;
+
+            const size_t begin = nodes.size();
+            stack.emplace_back(root_chunk.owners[root_index], -1);
+            while (!stack.empty()) {
+                auto [transform, parent] = stack.back();
+                stack.pop_back();
+
+                const uint32_t slot = transform->get_storage_slot();
+                Node node;
+                node.chunk = &storage.get_chunk_of(slot);
+                node.index = storage.get_index_in_chunk(slot);
+                node.transform = transform;
+                node.parent = parent;
+                const int32_t position = static_cast<int32_t>(nodes.size());
+                nodes.push_back(node);
+
+                const auto& children = transform->get_children();
+                for (auto it = children.rbegin(); it != children.rend(); ++it) {
+                    stack.emplace_back(*it, position);
+                }
+            }
+            subtrees.emplace_back(begin, nodes.size());
+        });
+    }
+
+
+    size_t TransformHierarchyPass::Pimpl::update_range(size_t begin, size_t end) {
+        size_t updated = 0;
+        for (size_t i = begin; i < end; ++i) {
+            const Node& node = nodes[i];
+            uint8_t& flags = node.chunk->dirty_flags[node.index];
+            if (!(flags & TRANSFORM_WORLD_DIRTY)) continue;
+
+            // Parents come first, so a parent's world matrix is already current here.
+            const glm::mat4& local = node.transform->get_local_matrix();
+            glm::mat4& world = node.chunk->world_matrices[node.index];
+            if (node.parent >= 0) {
+                const Node& parent = nodes[node.parent];
+                multiply_matrix(parent.chunk->world_matrices[parent.index], local, world);
+            } else {
+                world = local;
+            }
+            flags &= ~TRANSFORM_WORLD_DIRTY;
+            ++updated;
+        }
+        return updated;
+    }
+
+
+    void TransformHierarchyPass::run() {
+        const uint64_t version = ElementStorage::get().get_transform_hierarchy_version();
+        if (version != pimpl->built_version) {
+            pimpl->rebuild();
+            pimpl->built_version = version;
+        }
+
+        const size_t node_count = pimpl->nodes.size();
+        pimpl->last_visited_count = node_count;
+
+        unsigned int worker_count = 1;
+        if (node_count >= PARALLEL_THRESHOLD && pimpl->max_workers > 1) {
+            worker_count = static_cast<unsigned int>(std::min<size_t>(pimpl->max_workers, pimpl->subtrees.size()));
+        }
+        if (worker_count <= 1) {
+            pimpl->last_worker_count = 1;
+            pimpl->last_updated_count = pimpl->update_range(0, node_count);
+            return;
+        }
+
+        // Group whole subtrees into contiguous node ranges of roughly equal size.
+        std::vector<std::pair<size_t, size_t>> ranges;
+        const size_t target = (node_count + worker_count - 1) / worker_count;
+        size_t range_begin = 0;
+        for (const auto& subtree : pimpl->subtrees) {
+            if (subtree.second - range_begin >= target && ranges.size() + 1 < worker_count) {
+                ranges.emplace_back(range_begin, subtree.second);
+                range_begin = subtree.second;
+            }
+        }
+        if (range_begin < node_count) {
+            ranges.emplace_back(range_begin, node_count);
+        }
+
+        std::vector<size_t> updated(ranges.size(), 0);
+        JobSystem::get().parallel_for(ranges.size(), [this, &ranges, &updated](size_t r) {
+            updated[r] = pimpl->update_range(ranges[r].first, ranges[r].second);
+        });
+
+        pimpl->last_worker_count = static_cast<unsigned int>(ranges.size());
+        pimpl->last_updated_count = 0;
+        for (size_t count : updated) {
+            pimpl->last_updated_count += count;
+        }
+    }
+
+
+    void TransformHierarchyPass::capture_previous_states() {
+        // Whole-array copies per chunk; free slots are copied too, which is
+        // harmless and cheaper than testing each owner.
+        auto& storage = ElementStorage::get().transforms();
+        for (size_t c = 0; c < storage.get_chunk_count(); ++c) {
+            TransformChunk& chunk = storage.get_chunk(c);
+            const uint32_t used = storage.get_used_in_chunk(c);
+            std::copy_n(chunk.positions, used, chunk.previous_positions);
+            std::copy_n(chunk.rotations, used, chunk.previous_rotations);
+            std::copy_n(chunk.scales, used, chunk.previous_scales);
+            for (uint32_t i = 0; i < used; ++i) {
+                chunk.dirty_flags[i] &= ~TRANSFORM_NO_PREVIOUS;
+            }
+        }
+    }
+
+
+    void TransformHierarchyPass::set_max_workers(unsigned int worker_count) {
+        pimpl->max_workers = std::max(1u, worker_count);
+    }
+
+    unsigned int TransformHierarchyPass::get_max_workers() const { return pimpl->max_workers; }
+    size_t TransformHierarchyPass::get_last_visited_count() const { return pimpl->last_visited_count; }
+    size_t TransformHierarchyPass::get_last_updated_count() const { return pimpl->last_updated_count; }
+    unsigned int TransformHierarchyPass::get_last_worker_count() const { return pimpl->last_worker_count; }
+
+} // namespace Salix
@@ -0,0 +1,56 @@
+// =================================================================================
+// Filename:    Salix/ecs/TransformHierarchyPass.h
+// Author:      SalixGameStudio
+// Description: Declares the once-per-frame pass that brings every cached
+//              Transform world matrix up to date in parent-before-child order.
+// =================================================================================
+#pragma once
+
+#include <Salix/core/Core.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Salix {
+
+    // Walks all live transforms as a flat, topologically ordered array and
+    // refreshes the world matrices that are marked dirty. Each root's subtree is
+    // contiguous in that array, so independent subtrees can be split across
+    // threads. After run(), Transform::get_world_matrix() is a plain read for
+    // everything that was up to date at the time of the call.
+    class SALIX_API TransformHierarchyPass {
+        public:
+            static TransformHierarchyPass& get();
+
+            void run();
+
+            // Copies every transform's local position, rotation and scale into its
+            // previous_* slots. The fixed-step loop calls this before each tick so
+            // renderers can interpolate between the last two ticks.
+            void capture_previous_states();
+
+            // Upper bound on the subtree batches handed to the JobSystem per run();
+            // 1 keeps the pass on the calling thread.
+            void set_max_workers(unsigned int worker_count);
+            unsigned int get_max_workers() const;
+
+            // Below this many transforms the pass never leaves the calling thread.
+            static constexpr size_t PARALLEL_THRESHOLD = 4096;
+
+            // --- Stats for the last run() ---
+            size_t get_last_visited_count() const;
+            size_t get_last_updated_count() const;
+            // Number of batches the last run() was split into.
+            unsigned int get_last_worker_count() const;
+
+        private:
+            TransformHierarchyPass();
+            ~TransformHierarchyPass();
+            TransformHierarchyPass(const TransformHierarchyPass&) = delete;
+            TransformHierarchyPass& operator=(const TransformHierarchyPass&) = delete;
+
+            struct Pimpl;
+            std::unique_ptr<Pimpl> pimpl;
+    };
+
+} // namespace Salix
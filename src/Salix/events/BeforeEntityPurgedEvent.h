@@ -2,6 +2,8 @@
 #pragma once
 #include <Salix/events/IEvent.h>
 #include <Salix/ecs/Entity.h>
+#include <algorithm>
+#include <vector>
 
 // Note: These macros should probably be moved into a shared header like IEvent.h
 // to avoid re-defining them, but for now, this works.
@@ -16,17 +18,24 @@
 
 namespace Salix {
 
-// This event is dispatched right before an entity is purged from the scene.
+// This event is dispatched right before entities are purged from the scene.
+// Realm::maintain() sends one event for everything it purges in that pass.
 class BeforeEntityPurgedEvent : public IEvent { 
     public:
         BeforeEntityPurgedEvent(Entity* entity_to_be_purged)
-            : entity(entity_to_be_purged) {}
+            : entities{ entity_to_be_purged } {}
+        BeforeEntityPurgedEvent(std::vector<Entity*> entities_to_be_purged)
+            : entities(std::move(entities_to_be_purged)) {}
 
         EVENT_CLASS_TYPE(BeforeEntityPurged)
         EVENT_CLASS_CATEGORY(EventCategory::Editor)
         CLONE_EVENT_METHOD(BeforeEntityPurgedEvent)
 
-        Entity* entity;
+        bool contains(const Entity* entity) const {
+            return std::find(entities.begin(), entities.end(), entity) != entities.end();
+        }
+
+        std::vector<Entity*> entities;
 };
 
-} // namespace Salix
\ No newline at end of file
+} // namespace Salix
@@ -8,6 +8,27 @@
 #include <algorithm> // For std::find
 
 namespace Salix {
+    namespace {
+        // Set by ScopedEventCapture for the current thread only.
+        thread_local std::vector<CapturedEvent>* capture_buffer = nullptr;
+    }
+
+    ScopedEventCapture::ScopedEventCapture(std::vector<CapturedEvent>& buffer)
+        : previous_buffer(capture_buffer) {
+        capture_buffer = &buffer;
+    }
+
+    ScopedEventCapture::~ScopedEventCapture() {
+        capture_buffer = previous_buffer;
+    }
+
+    void ScopedEventCapture::forward(std::vector<CapturedEvent>& buffer) {
+        for (auto& captured : buffer) {
+            captured.target->dispatch(std::move(captured.event));
+        }
+        buffer.clear();
+    }
+
     struct EventManager::Pimpl {
         std::map<EventCategory, std::vector<IEventListener*>> subscribers;
         std::vector<std::unique_ptr<IEvent>> event_queue; 
@@ -50,6 +71,12 @@ namespace Salix {
             return;
         }
 
+        // Events raised inside a capture scope are held for the scope's owner.
+        if (capture_buffer) {
+            capture_buffer->push_back(CapturedEvent{ this, std::move(event) });
+            return;
+        }
+
         // If the event is not blocked, add it to the queue for later processing.
         pimpl->event_queue.push_back(std::move(event));
     }
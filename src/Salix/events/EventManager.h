@@ -42,4 +42,29 @@ namespace Salix {
             std::unique_ptr<Pimpl> pimpl;
             
     };
+
+
+    // An event held back by a ScopedEventCapture, with the manager it was sent to.
+    struct CapturedEvent {
+        EventManager* target = nullptr;
+        std::unique_ptr<IEvent> event;
+    };
+
+    // While one of these is alive, dispatch() calls made on the same thread are
+    // appended to 'buffer' instead of a manager's queue. Used when elements update
+    // on worker threads: each batch collects its own events and the main thread
+    // forwards them afterwards in a fixed order.
+    class SALIX_API ScopedEventCapture {
+        public:
+            explicit ScopedEventCapture(std::vector<CapturedEvent>& buffer);
+            ~ScopedEventCapture();
+
+            // Sends every captured event on to its manager, in capture order.
+            static void forward(std::vector<CapturedEvent>& buffer);
+
+        private:
+            std::vector<CapturedEvent>* previous_buffer;
+            ScopedEventCapture(const ScopedEventCapture&) = delete;
+            ScopedEventCapture& operator=(const ScopedEventCapture&) = delete;
+    };
 }  // namespace Salix
\ No newline at end of file
@@ -14,6 +14,16 @@
 
 namespace Salix {
 
+    namespace {
+        // Atlas regions share their page's ImGui id, so the UVs pick the image out.
+        void set_icon_texture(IconInfo& info, const ITexture& texture) {
+            const glm::vec4 uv_rect = texture.get_uv_rect();
+            info.texture_id = texture.get_imgui_texture_id();
+            info.uv0 = ImVec2(uv_rect.x, uv_rect.y);
+            info.uv1 = ImVec2(uv_rect.x + uv_rect.z, uv_rect.y + uv_rect.w);
+        }
+    }
+
     struct ImGuiIconManager::Pimpl {
         AssetManager* asset_manager = nullptr;
         std::map<std::string, IconInfo> icon_registry;
@@ -43,7 +53,7 @@ namespace Salix {
          ITexture* texture = asset_manager->get_texture(path);
         if (texture) {
             IconInfo info;
-            info.texture_id = texture->get_imgui_texture_id();
+            set_icon_texture(info, *texture);
             info.path = path;
             icon_registry[type_name] = info;
         } else {
@@ -81,7 +91,7 @@ namespace Salix {
                 // This is a dynamic, user-specific icon. We create a temporary IconInfo for it.
                 // A more advanced system would cache this result.
                 static IconInfo dynamic_icon_info; // Static to avoid re-allocation
-                dynamic_icon_info.texture_id = texture->get_imgui_texture_id();
+                set_icon_texture(dynamic_icon_info, *texture);
                 return dynamic_icon_info;
             }
         }
@@ -129,7 +139,7 @@ namespace Salix {
         if (pimpl->icon_registry.count(type_name)) {
             ITexture* texture = pimpl->asset_manager->get_texture(new_path);
             if (texture) {
-                pimpl->icon_registry[type_name].texture_id = texture->get_imgui_texture_id();
+                set_icon_texture(pimpl->icon_registry[type_name], *texture);
                 pimpl->icon_registry[type_name].path = new_path;
             } else {
                 std::cerr << "ImGuiIconManager::update_icon - Failed to update icon, texture is nullptr!" <<
@@ -99,6 +99,7 @@ namespace Salix {
         for (const auto& pair : pimpl->realm_paths) {
             pimpl->realm_manager->create_realm(pair.first, pair.second);
         }
+
         
         // Now that the project is set up, load its specific game logic DLL.
         std::cout << "Project: Loading game script DLL '" << pimpl->game_dll_name << "'..." << std::endl;
@@ -1,9 +1,17 @@
 // Salix/management/RealmManager.cpp
 #include <Salix/management/RealmManager.h>
 #include <Salix/ecs/Realm.h>
+#include <Salix/ecs/RealmView.h>
+#include <Salix/ecs/Entity.h>
+#include <Salix/ecs/Sprite2D.h>
+#include <Salix/assets/AssetManager.h>
+#include <Salix/assets/TextureAtlas.h>
 #include <Salix/core/InitContext.h>
 #include <filesystem>
 #include <iostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
 
 namespace Salix {
 
@@ -56,6 +64,26 @@ namespace Salix {
 
     bool RealmManager::load_active_realm() {
         if (pimpl->active_realm == nullptr || pimpl->context.asset_manager == nullptr) return false;
+        // In the game, pack the first realm's sprite images into atlas pages
+        // before its sprites ask for them. Realms activated later stream their
+        // textures as usual; rebuilding would free regions still in use. The
+        // editor keeps standalone textures so images can change while it runs.
+        AssetManager* asset_manager = pimpl->context.asset_manager;
+        if (pimpl->context.engine_mode == EngineMode::Game && asset_manager->get_texture_atlas().get_page_count() == 0) {
+            // Every sprite on an entity counts, not just the first; each image once.
+            std::vector<std::string> image_paths;
+            std::unordered_set<std::string> seen_paths;
+            for (Entity* entity : pimpl->active_realm->view<Sprite2D>()) {
+                entity->for_each_element<Sprite2D>([&](Sprite2D& sprite) {
+                    const std::string& path = sprite.get_texture_path();
+                    if (path.empty() || asset_manager->is_in_texture_atlas(path)) return;
+                    if (seen_paths.insert(path).second) image_paths.push_back(path);
+                });
+            }
+            if (!image_paths.empty()) {
+                asset_manager->build_texture_atlas(image_paths);
+            }
+        }
         pimpl->active_realm->on_load(pimpl->context);
         return true;
     }
@@ -89,6 +89,12 @@ namespace Salix {
                 parse_app_state_type(root["Engine"]["initial_state"], out_config.initial_state);
                 if (root["Engine"]["target_fps"]) out_config.target_fps = root["Engine"]["target_fps"].as<int>();
             }
+            if (root["Simulation"]) {
+                const YAML::Node& simulation = root["Simulation"];
+                if (simulation["fixed_timestep"])     out_config.simulation.fixed_timestep     = simulation["fixed_timestep"].as<bool>();
+                if (simulation["tick_rate"])          out_config.simulation.tick_rate          = simulation["tick_rate"].as<int>();
+                if (simulation["max_catch_up_steps"]) out_config.simulation.max_catch_up_steps = simulation["max_catch_up_steps"].as<int>();
+            }
             if (root["Renderer"]) {
                 parse_renderer_type(root["Renderer"]["type"], out_config.renderer_type);
             }
@@ -162,6 +168,14 @@ namespace Salix {
             emitter << YAML::Key << "target_fps" << YAML::Value << config.target_fps;
             emitter << YAML::EndMap;
 
+            // Simulation Settings
+            emitter << YAML::Key << "Simulation";
+            emitter << YAML::BeginMap;
+            emitter << YAML::Key << "fixed_timestep" << YAML::Value << config.simulation.fixed_timestep;
+            emitter << YAML::Key << "tick_rate" << YAML::Value << config.simulation.tick_rate;
+            emitter << YAML::Key << "max_catch_up_steps" << YAML::Value << config.simulation.max_catch_up_steps;
+            emitter << YAML::EndMap;
+
             // Renderer Settings
             emitter << YAML::Key << "Renderer";
             emitter << YAML::BeginMap;
@@ -264,6 +278,9 @@ namespace Salix {
         // Write string safely
         write_string(out, config.window_config.title);
 
+        // Written last so a cache from before these settings existed fails to read them.
+        out.write(reinterpret_cast<const char*>(&config.simulation), sizeof(config.simulation));
+
         return true;
     }
 
@@ -285,7 +302,10 @@ namespace Salix {
         // Read string safely
         read_string(in, out_config.window_config.title);
 
-        return true;
+        in.read(reinterpret_cast<char*>(&out_config.simulation), sizeof(out_config.simulation));
+
+        // A short (older) cache leaves the stream failed; fall back to the YAML.
+        return static_cast<bool>(in);
     }
 
 } // namespace Salix
\ No newline at end of file
@@ -26,6 +26,8 @@ namespace Salix {
     // A static class cannot have a constructor.
     std::unordered_map<std::type_index, TypeInfo> ByteMirror::type_registry;
 
+    std::unordered_map<std::string, const TypeInfo*> ByteMirror::name_registry;
+
     // Define the static map for the constructor registry.
     std::unordered_map<std::string, constructor_func> ByteMirror::constructor_registry;
 
@@ -34,20 +36,36 @@ namespace Salix {
         constructor_registry[name] = func;
     }
 
-    std::vector<Property> ByteMirror::get_all_properties_for_type(const TypeInfo* type_info) {
-        std::vector<Property> all_properties;
-        const TypeInfo* current_type = type_info;
-
-        // Keep walking up the ancestor chain until we hit the top (nullptr)
-        while (current_type) {
-            // Add the properties from the current type to our list
-            all_properties.insert(all_properties.end(),
-                                current_type->properties.begin(),
-                                current_type->properties.end());
-            // Move to the parent
-            current_type = current_type->ancestor;
+    const std::vector<Property>& ByteMirror::get_all_properties_for_type(const TypeInfo* type_info) {
+        static const std::vector<Property> no_properties;
+        return type_info ? type_info->all_properties : no_properties;
+    }
+
+    const Property* ByteMirror::find_property(const TypeInfo* type_info, const std::string& property_name) {
+        if (!type_info) return nullptr;
+        auto it = type_info->property_indices.find(property_name);
+        return it != type_info->property_indices.end() ? &type_info->all_properties[it->second] : nullptr;
+    }
+
+    void ByteMirror::build_property_tables() {
+        name_registry.clear();
+        for (auto& pair : type_registry) {
+            TypeInfo& type_info = pair.second;
+            type_info.all_properties.clear();
+            type_info.property_indices.clear();
+
+            // Keep walking up the ancestor chain until we hit the top (nullptr)
+            for (const TypeInfo* current_type = &type_info; current_type; current_type = current_type->ancestor) {
+                type_info.all_properties.insert(type_info.all_properties.end(),
+                                                current_type->properties.begin(),
+                                                current_type->properties.end());
+            }
+            // A name declared on both a type and its ancestor resolves to the type's own.
+            for (size_t i = type_info.all_properties.size(); i-- > 0;) {
+                type_info.property_indices[type_info.all_properties[i].name] = i;
+            }
+            name_registry.emplace(type_info.name, &type_info);
         }
-        return all_properties;
     }
 
 
@@ -110,7 +128,7 @@ namespace Salix {
                 PropertyType::Bool,
                 nullptr,
                 // Getter
-                [](void* instance) {
+                [](void* instance) -> void* {
                     // Use a special static variable here to give ImGui a stable pointer for its checkbox.
                     thread_local static bool value;
                     value = static_cast<Element*>(instance)->is_visible();
@@ -341,7 +359,7 @@ namespace Salix {
                 PropertyType::Float,
                 nullptr,
                 // Getter
-                [](void* instance) {
+                [](void* instance) -> void* {
                     // Use a stable memory location for the return value
                     thread_local static float value; 
                     value = static_cast<Sprite2D*>(instance)->get_local_rotation();
@@ -410,7 +428,7 @@ namespace Salix {
             {
                 "width", PropertyType::Int, nullptr,
                 // Getter for the texture width
-                [](void* instance) {
+                [](void* instance) -> void* {
                     // Use a stable memory location for the return value
                     thread_local static int value; 
                     value = static_cast<Sprite2D*>(instance)->get_texture_width();
@@ -424,7 +442,7 @@ namespace Salix {
             {
                 "height", PropertyType::Int, nullptr,
                 // Getter for the texture height
-                [](void* instance) {
+                [](void* instance) -> void* {
                     // Use a stable memory location for the return value
                     thread_local static int value; 
                     value = static_cast<Sprite2D*>(instance)->get_texture_height();
@@ -451,7 +469,7 @@ namespace Salix {
             {
                 "active", PropertyType::Bool, nullptr,
                 // getter_func
-                [](void* instance) {
+                [](void* instance) -> void* {
                 thread_local static bool value;
                 value = static_cast<Camera*>(instance)->get_is_active();
                 return &value;
@@ -465,7 +483,7 @@ namespace Salix {
                 "projection_mode", PropertyType::EnumClass,
                 ByteMirror::get_type_info(typeid(Salix::ProjectionMode)),
                 // getter_func
-                [](void* instance) {
+                [](void* instance) -> void* {
                     // Create a stable memory location to hold our integer.
                     thread_local static int value;
                     // Get the enum, cast its value to an int, and store it.
@@ -582,6 +600,9 @@ namespace Salix {
         ByteMirror::register_type<BoxCollider>();
         ByteMirror::register_type<CppScript>();
 
+        // Every type is in now, so the ancestor chains can be flattened.
+        build_property_tables();
+
         // REGISTER CONSTRUCTORS
         ByteMirror::register_constructor("Transform",   []() -> Element* { return new Transform(); });
         ByteMirror::register_constructor("Sprite2D",    []() -> Element* { return new Sprite2D(); });
@@ -614,17 +635,8 @@ namespace Salix {
     const TypeInfo* ByteMirror::get_type_info_by_name(const std::string& name) {
         if (name.empty()) return nullptr;
 
-        // Loop through all the registered types in our map
-        for (const auto& pair : type_registry) {
-        // pair.first is the type_index, pair.second is the TypeInfo struct
-        if (pair.second.name == name) {
-            // If we find a TypeInfo whose name matches, return a pointer to it
-            return &pair.second;
-        }
-    }
-
-    // If we loop through everything and find no match, return nullptr
-    return nullptr;
+        auto it = name_registry.find(name);
+        return it != name_registry.end() ? it->second : nullptr;
     }
 
 
@@ -679,35 +691,34 @@ namespace Salix {
         }
 
         // 2. Find the specific property's reflection data
-        for (const auto& prop : get_all_properties_for_type(type_info)) {
-            if (prop.name == property_name) {
-                // 3. Use the property's generic getter to get the void* to the data
-                void* data_ptr = prop.get_data(element);
-                if (!data_ptr) {
-                    return {};
-                }
+        const Property* prop = find_property(type_info, property_name);
+        if (!prop) {
+            return {}; // Return empty if the property name was not found
+        }
 
-                // 4. Convert the void* to the correct type and return it in a PropertyValue variant
-                switch (prop.type) {
-                    case PropertyType::Int:       return *static_cast<int*>(data_ptr);
-                    case PropertyType::UInt64:    return *static_cast<uint64_t*>(data_ptr);
-                    case PropertyType::Float:     return *static_cast<float*>(data_ptr);
-                    case PropertyType::Bool:      return *static_cast<bool*>(data_ptr);
-                    case PropertyType::String:    return *static_cast<std::string*>(data_ptr);
-                    case PropertyType::Vector2:   return *static_cast<Vector2*>(data_ptr);
-                    case PropertyType::Vector3:   return *static_cast<Vector3*>(data_ptr);
-                    case PropertyType::Color:     return *static_cast<Color*>(data_ptr);
-                    case PropertyType::Point:     return *static_cast<Point*>(data_ptr);
-                    case PropertyType::Rect:      return *static_cast<Rect*>(data_ptr);
-                    // Note: Enums are read as integers by the reflection system
-                    case PropertyType::Enum:      return *static_cast<int*>(data_ptr);
-                    case PropertyType::EnumClass: return *static_cast<int*>(data_ptr);
-                    default:                      return {};
-                }
-            }
+        // 3. Use the property's generic getter to get the void* to the data
+        void* data_ptr = prop->get_data(element);
+        if (!data_ptr) {
+            return {};
         }
 
-        return {}; // Return empty if the property name was not found
+        // 4. Convert the void* to the correct type and return it in a PropertyValue variant
+        switch (prop->type) {
+            case PropertyType::Int:       return *static_cast<int*>(data_ptr);
+            case PropertyType::UInt64:    return *static_cast<uint64_t*>(data_ptr);
+            case PropertyType::Float:     return *static_cast<float*>(data_ptr);
+            case PropertyType::Bool:      return *static_cast<bool*>(data_ptr);
+            case PropertyType::String:    return *static_cast<std::string*>(data_ptr);
+            case PropertyType::Vector2:   return *static_cast<Vector2*>(data_ptr);
+            case PropertyType::Vector3:   return *static_cast<Vector3*>(data_ptr);
+            case PropertyType::Color:     return *static_cast<Color*>(data_ptr);
+            case PropertyType::Point:     return *static_cast<Point*>(data_ptr);
+            case PropertyType::Rect:      return *static_cast<Rect*>(data_ptr);
+            // Note: Enums are read as integers by the reflection system
+            case PropertyType::Enum:      return *static_cast<int*>(data_ptr);
+            case PropertyType::EnumClass: return *static_cast<int*>(data_ptr);
+            default:                      return {};
+        }
     }
 
 } // namespace Salix
\ No newline at end of file
@@ -44,10 +44,12 @@ namespace Salix {
 
 
     // A generic function that takes a element instance and returns a pointer to the property's data.
-    using getter_func = std::function<void*(void* type_instance)>;
+    // Accessors are captureless lambdas, so a plain function pointer holds them
+    // and a call is a direct jump rather than a std::function dispatch.
+    using getter_func = void* (*)(void* type_instance);
 
     // A generic function that takes a element instance and a pointer to the new data to set.
-    using setter_func = std::function<void(void* type_instance, void* data_to_set)>;
+    using setter_func = void (*)(void* type_instance, void* data_to_set);
 
     // A type definition for a function that constructs an Element.
     using constructor_func = std::function<Element*()>;
@@ -82,11 +84,15 @@ namespace Salix {
     struct TypeInfo
     {
         std::string name;
-        std::vector<Property> properties;
+        std::vector<Property> properties;   // Declared on this type only.
         const TypeInfo* ancestor = nullptr;
         std::optional<std::type_index> type_index;
         std::vector<std::string> derived_properties;
 
+        // Filled in once by ByteMirror::register_all_types(): this type's
+        // properties followed by each ancestor's, and where each name sits.
+        std::vector<Property> all_properties;
+        std::unordered_map<std::string, size_t> property_indices;
     };
 
 
@@ -101,9 +107,10 @@ namespace Salix {
             // Retrieves the reflection data for a given type.
             static const TypeInfo* get_type_info(std::type_index type_index)
             {
-                if (type_registry.count(type_index))
+                auto it = type_registry.find(type_index);
+                if (it != type_registry.end())
                 {
-                    return &type_registry.at(type_index);
+                    return &it->second;
                 }
                 return nullptr;
             }
@@ -122,16 +129,27 @@ namespace Salix {
             static void register_constructor(const std::string& name, constructor_func func);
             static Element* create_element_by_name(const std::string& name);
             
-            // Recursively collects all properties from a type and its ancestors.
-            static std::vector<Property> get_all_properties_for_type(const TypeInfo* type_info);
+            // All properties of a type and its ancestors, from the table built by
+            // register_all_types(). Returned by reference; nothing is copied.
+            static const std::vector<Property>& get_all_properties_for_type(const TypeInfo* type_info);
+
+            // Looks a property up by name in the same table; nullptr if there is none.
+            static const Property* find_property(const TypeInfo* type_info, const std::string& property_name);
 
             // Gets a property's value from a live element by name.
             static PropertyValue get_property_value(Element* element, const std::string& property_name);
 
         private:
+            // Flattens every registered type's ancestor chain into its all_properties
+            // table and indexes the types by name.
+            static void build_property_tables();
+
             // The static registry mapping a type_index to its reflection data.
             static std::unordered_map<std::type_index, TypeInfo> type_registry;
 
+            // The same types by TypeInfo::name, for get_type_info_by_name().
+            static std::unordered_map<std::string, const TypeInfo*> name_registry;
+
             // A registry to store the constructor for each component type.
             static std::unordered_map<std::string, constructor_func> constructor_registry;
         };
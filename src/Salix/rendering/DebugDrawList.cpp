@@ -0,0 +1,137 @@
+// =================================================================================
+// Filename:    Salix/rendering/DebugDrawList.cpp
+// Author:      SalixGameStudio
+// Description: Implements the DebugDrawList.
+// =================================================================================
+#include <Salix/rendering/DebugDrawList.h>
+#include <glm/gtc/constants.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace Salix {
+
+    namespace {
+        glm::vec4 to_vec4(const Color& color) {
+            return glm::vec4(color.r, color.g, color.b, color.a);
+        }
+
+        // Lines closer than this to a major line count as lying on it.
+        constexpr float GRID_EPSILON = 1e-4f;
+    }
+
+    struct DebugDrawList::Pimpl {
+        std::vector<DebugVertex> vertices;
+
+        void push(const glm::vec3& start, const glm::vec3& end, const glm::vec4& color) {
+            vertices.push_back({ start, color });
+            vertices.push_back({ end, color });
+        }
+    };
+
+
+    DebugDrawList::DebugDrawList() : pimpl(std::make_unique<Pimpl>()) {}
+    DebugDrawList::~DebugDrawList() = default;
+
+
+    void DebugDrawList::add_line(const glm::vec3& start, const glm::vec3& end, const Color& color) {
+        pimpl->push(start, end, to_vec4(color));
+    }
+
+
+    void DebugDrawList::add_wire_box(const glm::mat4& model_matrix, const Color& color) {
+        glm::vec3 corners[8];
+        for (int i = 0; i < 8; ++i) {
+            const glm::vec4 local((i & 1) ? 0.5f : -0.5f, (i & 2) ? 0.5f : -0.5f, (i & 4) ? 0.5f : -0.5f, 1.0f);
+            corners[i] = glm::vec3(model_matrix * local);
+        }
+        // Corners differing in exactly one bit share an edge.
+        static constexpr int edges[12][2] = {
+            {0, 1}, {2, 3}, {4, 5}, {6, 7},     // Along X
+            {0, 2}, {1, 3}, {4, 6}, {5, 7},     // Along Y
+            {0, 4}, {1, 5}, {2, 6}, {3, 7}      // Along Z
+        };
+        const glm::vec4 rgba = to_vec4(color);
+        pimpl->vertices.reserve(pimpl->vertices.size() + 24);
+        for (const auto& edge : edges) {
+            pimpl->push(corners[edge[0]], corners[edge[1]], rgba);
+        }
+    }
+
+
+    void DebugDrawList::add_wire_sphere(const glm::vec3& center, float radius, const Color& color, int segments) {
+        segments = std::max(segments, 3);
+        const glm::vec4 rgba = to_vec4(color);
+        const float step = glm::two_pi<float>() / static_cast<float>(segments);
+        pimpl->vertices.reserve(pimpl->vertices.size() + static_cast<size_t>(segments) * 6);
+
+        for (int i = 0; i < segments; ++i) {
+            const float a0 = step * static_cast<float>(i);
+            const float a1 = step * static_cast<float>(i + 1);
+            const float c0 = std::cos(a0) * radius, s0 = std::sin(a0) * radius;
+            const float c1 = std::cos(a1) * radius, s1 = std::sin(a1) * radius;
+            pimpl->push(center + glm::vec3(c0, s0, 0.0f), center + glm::vec3(c1, s1, 0.0f), rgba);  // XY
+            pimpl->push(center + glm::vec3(c0, 0.0f, s0), center + glm::vec3(c1, 0.0f, s1), rgba);  // XZ
+            pimpl->push(center + glm::vec3(0.0f, c0, s0), center + glm::vec3(0.0f, c1, s1), rgba);  // YZ
+        }
+    }
+
+
+    void DebugDrawList::add_grid(float half_extent, float major_division, float minor_division,
+                                 const Color& major_color, const Color& minor_color) {
+        if (half_extent <= 0.0f || major_division <= 0.0f) return;
+
+        // Lines sit on whole multiples of the division, so the grid lines up with
+        // the world origin (and with snapping) whatever the extent is.
+        const int major_count = static_cast<int>(std::floor(half_extent / major_division + GRID_EPSILON));
+        const glm::vec4 major_rgba = to_vec4(major_color);
+        for (int i = -major_count; i <= major_count; ++i) {
+            const float offset = static_cast<float>(i) * major_division;
+            pimpl->push({ offset, 0.0f, -half_extent }, { offset, 0.0f, half_extent }, major_rgba);
+            pimpl->push({ -half_extent, 0.0f, offset }, { half_extent, 0.0f, offset }, major_rgba);
+        }
+
+        if (minor_division <= 0.0f || minor_division >= major_division) return;
+
+        const int minor_count = static_cast<int>(std::floor(half_extent / minor_division + GRID_EPSILON));
+        const glm::vec4 minor_rgba = to_vec4(minor_color);
+        // When the major division is a whole number of minor ones (the usual
+        // case) the overlap test is exact; otherwise fall back to fmod.
+        const float ratio = major_division / minor_division;
+        const int minors_per_major = static_cast<int>(std::lround(ratio));
+        const bool aligned = std::fabs(ratio - static_cast<float>(minors_per_major)) < GRID_EPSILON;
+        for (int i = -minor_count; i <= minor_count; ++i) {
+            const float offset = static_cast<float>(i) * minor_division;
+            if (aligned) {
+                if (i % minors_per_major == 0) continue;
+            }
+            else {
+                const float remainder = std::fmod(std::fabs(offset), major_division);
+                if (remainder < GRID_EPSILON || major_division - remainder < GRID_EPSILON) continue;
+            }
+            pimpl->push({ offset, 0.0f, -half_extent }, { offset, 0.0f, half_extent }, minor_rgba);
+            pimpl->push({ -half_extent, 0.0f, offset }, { half_extent, 0.0f, offset }, minor_rgba);
+        }
+    }
+
+
+    void DebugDrawList::clear() {
+        pimpl->vertices.clear();
+    }
+
+    bool DebugDrawList::empty() const {
+        return pimpl->vertices.empty();
+    }
+
+    const std::vector<DebugVertex>& DebugDrawList::get_vertices() const {
+        return pimpl->vertices;
+    }
+
+    size_t DebugDrawList::get_vertex_count() const {
+        return pimpl->vertices.size();
+    }
+
+    size_t DebugDrawList::get_line_count() const {
+        return pimpl->vertices.size() / 2;
+    }
+
+} // namespace Salix
@@ -0,0 +1,57 @@
+// =================================================================================
+// Filename:    Salix/rendering/DebugDrawList.h
+// Author:      SalixGameStudio
+// Description: Declares DebugDrawList, a CPU-side list of coloured line
+//              vertices that debug shapes (lines, boxes, spheres, grids) are
+//              appended to before a renderer draws them in one call.
+// =================================================================================
+#pragma once
+
+#include <Salix/core/Core.h>
+#include <Salix/math/Color.h>
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Salix {
+
+    // One end of a line segment, exactly as it is uploaded to the GPU.
+    struct DebugVertex {
+        glm::vec3 position;
+        glm::vec4 color;
+    };
+
+    // Renderer agnostic: every shape is flattened into pairs of vertices
+    // (GL_LINES style) in world space. clear() keeps the storage, so a list
+    // reused every frame stops allocating once it has grown to its peak.
+    class SALIX_API DebugDrawList {
+        public:
+            DebugDrawList();
+            ~DebugDrawList();
+
+            void add_line(const glm::vec3& start, const glm::vec3& end, const Color& color);
+            // The 12 edges of the unit cube (-0.5..0.5) transformed by model_matrix,
+            // the same box draw_wire_box() outlines.
+            void add_wire_box(const glm::mat4& model_matrix, const Color& color);
+            // Three axis-aligned circles of 'segments' lines each.
+            void add_wire_sphere(const glm::vec3& center, float radius, const Color& color, int segments = 16);
+            // A square grid on the XZ plane, centred on the origin and reaching
+            // half_extent in each direction. Minor lines that fall on a major line
+            // are skipped; minor_division <= 0 draws major lines only.
+            void add_grid(float half_extent, float major_division, float minor_division,
+                          const Color& major_color, const Color& minor_color);
+
+            void clear();
+            bool empty() const;
+
+            const std::vector<DebugVertex>& get_vertices() const;
+            size_t get_vertex_count() const;
+            size_t get_line_count() const;
+
+        private:
+            struct Pimpl;
+            std::unique_ptr<Pimpl> pimpl;
+    };
+
+} // namespace Salix
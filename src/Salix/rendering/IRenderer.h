@@ -9,6 +9,8 @@
 #include <Salix/rendering/ITexture.h>  // Need this to use our own renderer agnostic Texture.
 #include <Salix/window/IWindow.h>
 #include <Salix/rendering/ICamera.h>
+#include <Salix/rendering/RenderStats.h>
+#include <Salix/rendering/RenderCommandList.h>
 #include <SDL.h>
 #include <cstdint>
 
@@ -29,6 +31,7 @@ namespace Salix {
 
     class OpenGLRenderer; // Forward declaration
     class SDLRenderer;
+    class DebugDrawList;
 
     // This is an abstract base class that defines the "contract" for any renderer.
 
@@ -75,6 +78,19 @@ namespace Salix {
         virtual void* get_native_handle() = 0;
         // A contract that all renderers must know how to load a texture.
         virtual ITexture* load_texture(const char* file_path) = 0;
+        // Builds a texture from pixels already in memory (tightly packed rows,
+        // 3 or 4 channels). Must run on the render thread. Renderers that cannot
+        // do this return nullptr, and callers fall back to load_texture().
+        virtual ITexture* create_texture(const unsigned char* pixels, int width, int height, int channels) {
+            (void)pixels; (void)width; (void)height; (void)channels;
+            return nullptr;
+        }
+        // Same, for RGBA8 data that already carries its full mip chain
+        // (mip_levels[0] is the full-size image). No mips are generated.
+        virtual ITexture* create_texture_with_mips(const unsigned char* const* mip_levels, int mip_count, int width, int height) {
+            (void)mip_levels; (void)mip_count; (void)width; (void)height;
+            return nullptr;
+        }
 
         // This is essential to prevent drawing artifacts from previous frames.
         virtual void clear() = 0; 
@@ -86,6 +102,32 @@ namespace Salix {
         virtual void draw_sprite(ITexture* texture, const glm::mat4& model_matrix, const Color& color) {
             (void)texture; (void)model_matrix; (void)color;
         }
+        // --- Sprite batching ---
+        // Between begin_sprite_batch() and end_sprite_batch(), submit_sprite() only
+        // records; end_sprite_batch() then draws everything grouped by sorting layer
+        // and texture. Outside a batch, submit_sprite() draws straight away.
+        // Renderers that record into a RenderCommandList keep batched sprites and
+        // debug shapes in the same list, so any flush point draws both.
+        virtual void begin_sprite_batch() {}
+        virtual void end_sprite_batch() {}
+        virtual void submit_sprite(ITexture* texture, const Transform* transform, const Color& color, SpriteFlip flip, int sorting_layer) {
+            (void)sorting_layer;
+            draw_sprite(texture, transform, color, flip);
+        }
+        virtual void submit_sprite(ITexture* texture, const glm::mat4& model_matrix, const Color& color, int sorting_layer) {
+            (void)sorting_layer;
+            draw_sprite(texture, model_matrix, color);
+        }
+        // --- Command lists ---
+        // Takes a list recorded elsewhere, possibly on another thread (see
+        // RenderCommandList), and draws it sorted together with this frame's own
+        // batched sprites and debug shapes at the next flush. Renderers that do
+        // not record their draws replay it through the calls above right away.
+        virtual void submit_commands(const RenderCommandList& commands) {
+            commands.execute(*this);
+        }
+        virtual RenderStats get_render_stats() const { return {}; }
+
         virtual void draw_wire_box(const glm::mat4& model_matrix, const Color& color) = 0;
         virtual void draw_line(const glm::vec3& start, const glm::vec3& end, const Color& color) = 0; 
         virtual const float get_line_width() const { return 1.0f; }
@@ -94,5 +136,29 @@ namespace Salix {
             const Color& color,
             int segments = 16) {(void)center, (void)radius, (void)color, (void)segments;}
         virtual void set_line_width(float line_width) {(void)line_width;}
+        // --- Batched debug drawing ---
+        // debug_*() only record into a per-pass list; flush_debug_draw() draws
+        // everything appended so far in one call. end_render_pass() and
+        // end_frame() flush on their own. Renderers without a debug buffer draw
+        // each shape straight away.
+        virtual void debug_line(const glm::vec3& start, const glm::vec3& end, const Color& color) {
+            draw_line(start, end, color);
+        }
+        virtual void debug_wire_box(const glm::mat4& model_matrix, const Color& color) {
+            draw_wire_box(model_matrix, color);
+        }
+        virtual void debug_wire_sphere(const glm::vec3& center, float radius, const Color& color, int segments = 16) {
+            draw_sphere(center, radius, color, segments);
+        }
+        virtual void flush_debug_draw() {}
+        // Static line geometry (e.g. an editor grid) uploaded once and drawn with
+        // a single call until it is deleted. Ids are never 0; 0 means unsupported.
+        virtual uint32_t create_line_mesh(const DebugDrawList& lines) { (void)lines; return 0; }
+        virtual void draw_line_mesh(uint32_t mesh_id) { (void)mesh_id; }
+        virtual void delete_line_mesh(uint32_t mesh_id) { (void)mesh_id; }
+        // Fixed-step mode: how far (0..1) the frame sits between the previous and
+        // the current simulation tick. 1 means "draw the current state".
+        virtual void set_interpolation_alpha(float alpha) {(void)alpha;}
+        virtual float get_interpolation_alpha() const { return 1.0f; }
     };
 } // namespace Salix
\ No newline at end of file
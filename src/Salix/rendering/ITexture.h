@@ -3,6 +3,7 @@
 
 #include <Salix/core/Core.h>
 #include <imgui/imgui.h>
+#include <glm/glm.hpp>
 namespace Salix {
 
     class SALIX_API ITexture {
@@ -12,6 +13,19 @@ namespace Salix {
             // A contract that all textures must be able to report their dimensions.
             virtual int get_width() const = 0;
             virtual int get_height() const = 0;
+            // Atlas regions return their page's id; pass get_uv_rect() to
+            // ImGui as the UVs so only the region shows.
             virtual ImTextureID get_imgui_texture_id() const = 0;
+
+            // The texture to actually bind. Streamed textures return their
+            // placeholder until the real image has been uploaded.
+            virtual ITexture* resolve() { return this; }
+            virtual bool is_ready() const { return true; }
+
+            // Atlas regions draw a sub-rectangle of a shared page: the page is
+            // what gets bound, and the UV rect is (u offset, v offset, u scale,
+            // v scale) into it.
+            virtual ITexture* get_base_texture() { return this; }
+            virtual glm::vec4 get_uv_rect() const { return glm::vec4(0.0f, 0.0f, 1.0f, 1.0f); }
     };
 }
\ No newline at end of file
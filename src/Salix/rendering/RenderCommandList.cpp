@@ -0,0 +1,374 @@
+// =================================================================================
+// Filename:    Salix/rendering/RenderCommandList.cpp
+// Author:      SalixGameStudio
+// Description: Implements the RenderCommandList.
+// =================================================================================
+#include <Salix/rendering/RenderCommandList.h>
+#include <Salix/rendering/ITexture.h>
+#include <Salix/rendering/IRenderer.h>
+#include <algorithm>
+#include <array>
+
+namespace Salix {
+
+    namespace {
+        // Programs a command needs, for the shader field of the key and for
+        // counting binds on replay.
+        enum ShaderSlot : uint32_t {
+            SHADER_TEXTURED = 0,
+            SHADER_SOLID = 1,
+            SHADER_DEBUG_LINE = 2
+        };
+
+        constexpr uint64_t mask(int bits) {
+            return (uint64_t(1) << bits) - 1;
+        }
+
+        constexpr int DEPTH_SHIFT = 0;
+        constexpr int TEXTURE_SHIFT = DEPTH_SHIFT + RenderSortKey::DEPTH_BITS;
+        constexpr int SHADER_SHIFT = TEXTURE_SHIFT + RenderSortKey::TEXTURE_BITS;
+        constexpr int LAYER_SHIFT = SHADER_SHIFT + RenderSortKey::SHADER_BITS;
+        constexpr int PASS_SHIFT = LAYER_SHIFT + RenderSortKey::LAYER_BITS;
+        static_assert(PASS_SHIFT + RenderSortKey::PASS_BITS == 64, "sort key fields must fill 64 bits");
+
+        // Signed layers are biased so that negative ones sort first.
+        constexpr int LAYER_BIAS = 1 << (RenderSortKey::LAYER_BITS - 1);
+
+        bool is_debug_shape(RenderCommandType type) {
+            return type == RenderCommandType::Line || type == RenderCommandType::WireBox ||
+                   type == RenderCommandType::WireSphere;
+        }
+    }
+
+
+    // --- RenderSortKey ---
+
+    uint64_t RenderSortKey::make(RenderCommandPass pass, int layer, uint32_t shader, uint32_t texture, float depth) {
+        const int biased_layer = std::clamp(layer + LAYER_BIAS, 0, static_cast<int>(mask(LAYER_BITS)));
+        const float clamped_depth = std::clamp(depth, 0.0f, 1.0f);
+        const uint64_t depth_bits = static_cast<uint64_t>(clamped_depth * static_cast<float>(mask(DEPTH_BITS)));
+        return ((static_cast<uint64_t>(pass) & mask(PASS_BITS)) << PASS_SHIFT) |
+               ((static_cast<uint64_t>(biased_layer) & mask(LAYER_BITS)) << LAYER_SHIFT) |
+               ((static_cast<uint64_t>(shader) & mask(SHADER_BITS)) << SHADER_SHIFT) |
+               ((static_cast<uint64_t>(texture) & mask(TEXTURE_BITS)) << TEXTURE_SHIFT) |
+               ((depth_bits & mask(DEPTH_BITS)) << DEPTH_SHIFT);
+    }
+
+    RenderCommandPass RenderSortKey::get_pass(uint64_t key) {
+        return static_cast<RenderCommandPass>((key >> PASS_SHIFT) & mask(PASS_BITS));
+    }
+
+    int RenderSortKey::get_layer(uint64_t key) {
+        return static_cast<int>((key >> LAYER_SHIFT) & mask(LAYER_BITS)) - LAYER_BIAS;
+    }
+
+    uint32_t RenderSortKey::get_shader(uint64_t key) {
+        return static_cast<uint32_t>((key >> SHADER_SHIFT) & mask(SHADER_BITS));
+    }
+
+    uint32_t RenderSortKey::get_texture(uint64_t key) {
+        return static_cast<uint32_t>((key >> TEXTURE_SHIFT) & mask(TEXTURE_BITS));
+    }
+
+    uint32_t RenderSortKey::texture_bits(const ITexture* texture) {
+        if (!texture) return 0;
+        // Fibonacci hashing of the address; the low bits of a heap pointer
+        // are mostly alignment zeros.
+        const uint64_t address = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(texture));
+        return static_cast<uint32_t>((address * 0x9E3779B97F4A7C15ull) >> (64 - TEXTURE_BITS));
+    }
+
+
+    // --- RenderCommandList ---
+
+    struct RenderCommandList::Pimpl {
+        std::vector<RenderCommand> commands;
+
+        // Scratch for sort(), kept between frames.
+        struct SortEntry {
+            uint64_t key;
+            uint32_t index;
+        };
+        std::vector<SortEntry> entries;
+        std::vector<SortEntry> entries_scratch;
+        std::vector<RenderCommand> commands_scratch;
+    };
+
+
+    RenderCommandList::RenderCommandList() : pimpl(std::make_unique<Pimpl>()) {}
+    RenderCommandList::~RenderCommandList() = default;
+    RenderCommandList::RenderCommandList(RenderCommandList&& other) noexcept = default;
+    RenderCommandList& RenderCommandList::operator=(RenderCommandList&& other) noexcept = default;
+
+
+    void RenderCommandList::add_sprite(ITexture* texture, const glm::mat4& model_matrix, const Color& color,
+                                       int sorting_layer, float depth) {
+        if (!texture) return;
+        RenderCommand command;
+        command.type = RenderCommandType::Sprite;
+        command.texture = texture;
+        command.transform = model_matrix;
+        command.color = glm::vec4(color.r, color.g, color.b, color.a);
+        command.sort_key = RenderSortKey::make(RenderCommandPass::Sprites, sorting_layer, SHADER_TEXTURED,
+                                               RenderSortKey::texture_bits(texture->get_base_texture()), depth);
+        pimpl->commands.push_back(command);
+    }
+
+    void RenderCommandList::add_sphere(const glm::vec3& center, float radius, const Color& color, int segments) {
+        RenderCommand command;
+        command.type = RenderCommandType::Sphere;
+        command.transform = glm::mat4(1.0f);
+        command.color = glm::vec4(color.r, color.g, color.b, color.a);
+        command.point_a = center;
+        command.radius = radius;
+        command.segments = segments;
+        command.sort_key = RenderSortKey::make(RenderCommandPass::World, 0, SHADER_SOLID, 0, 0.0f);
+        pimpl->commands.push_back(command);
+    }
+
+    void RenderCommandList::add_line(const glm::vec3& start, const glm::vec3& end, const Color& color) {
+        RenderCommand command;
+        command.type = RenderCommandType::Line;
+        command.transform = glm::mat4(1.0f);
+        command.color = glm::vec4(color.r, color.g, color.b, color.a);
+        command.point_a = start;
+        command.point_b = end;
+        command.sort_key = RenderSortKey::make(RenderCommandPass::Debug, 0, SHADER_DEBUG_LINE, 0, 0.0f);
+        pimpl->commands.push_back(command);
+    }
+
+    void RenderCommandList::add_wire_box(const glm::mat4& model_matrix, const Color& color) {
+        RenderCommand command;
+        command.type = RenderCommandType::WireBox;
+        command.transform = model_matrix;
+        command.color = glm::vec4(color.r, color.g, color.b, color.a);
+        command.sort_key = RenderSortKey::make(RenderCommandPass::Debug, 0, SHADER_DEBUG_LINE, 0, 0.0f);
+        pimpl->commands.push_back(command);
+    }
+
+    void RenderCommandList::add_wire_sphere(const glm::vec3& center, float radius, const Color& color, int segments) {
+        RenderCommand command;
+        command.type = RenderCommandType::WireSphere;
+        command.transform = glm::mat4(1.0f);
+        command.color = glm::vec4(color.r, color.g, color.b, color.a);
+        command.point_a = center;
+        command.radius = radius;
+        command.segments = segments;
+        command.sort_key = RenderSortKey::make(RenderCommandPass::Debug, 0, SHADER_DEBUG_LINE, 0, 0.0f);
+        pimpl->commands.push_back(command);
+    }
+
+    void RenderCommandList::add(const RenderCommand& command) {
+        pimpl->commands.push_back(command);
+    }
+
+
+    void RenderCommandList::append(const RenderCommand* commands, size_t count) {
+        if (!commands || count == 0) return;
+        pimpl->commands.insert(pimpl->commands.end(), commands, commands + count);
+    }
+
+    void RenderCommandList::append(const RenderCommandList& other) {
+        if (&other == this) return;
+        append(other.pimpl->commands.data(), other.pimpl->commands.size());
+    }
+
+
+    void RenderCommandList::sort() {
+        auto& commands = pimpl->commands;
+        const size_t count = commands.size();
+        if (count < 2) return;
+
+        // Sort (key, index) pairs rather than the commands themselves, then
+        // gather once: moving 16 bytes per pass instead of a whole command.
+        auto& entries = pimpl->entries;
+        auto& scratch = pimpl->entries_scratch;
+        entries.resize(count);
+        scratch.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            entries[i] = { commands[i].sort_key, static_cast<uint32_t>(i) };
+        }
+
+        // One histogram per byte, gathered in a single pass over the keys.
+        std::array<std::array<uint32_t, 256>, 8> histograms{};
+        for (const auto& entry : entries) {
+            for (int byte = 0; byte < 8; ++byte) {
+                ++histograms[byte][(entry.key >> (byte * 8)) & 0xFF];
+            }
+        }
+
+        for (int byte = 0; byte < 8; ++byte) {
+            auto& histogram = histograms[byte];
+            // Every key shares this byte (common for the pass and shader fields):
+            // the pass would not move anything.
+            if (histogram[(entries[0].key >> (byte * 8)) & 0xFF] == count) continue;
+
+            uint32_t offset = 0;
+            for (uint32_t& bucket : histogram) {
+                const uint32_t bucket_count = bucket;
+                bucket = offset;
+                offset += bucket_count;
+            }
+            for (const auto& entry : entries) {
+                scratch[histogram[(entry.key >> (byte * 8)) & 0xFF]++] = entry;
+            }
+            entries.swap(scratch);
+        }
+
+        auto& sorted = pimpl->commands_scratch;
+        sorted.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            sorted[i] = commands[entries[i].index];
+        }
+        commands.swap(sorted);
+    }
+
+
+    void RenderCommandList::clear() {
+        pimpl->commands.clear();
+    }
+
+    size_t RenderCommandList::size() const {
+        return pimpl->commands.size();
+    }
+
+    bool RenderCommandList::empty() const {
+        return pimpl->commands.empty();
+    }
+
+    const std::vector<RenderCommand>& RenderCommandList::get_commands() const {
+        return pimpl->commands;
+    }
+
+
+    void RenderCommandList::execute(IRenderer& renderer) const {
+        bool sprite_batch_open = false;
+        bool debug_pending = false;
+        RenderCommandPass current_pass = RenderCommandPass::World;
+
+        auto close_pass = [&]() {
+            if (sprite_batch_open) {
+                renderer.end_sprite_batch();
+                sprite_batch_open = false;
+            }
+            if (debug_pending) {
+                renderer.flush_debug_draw();
+                debug_pending = false;
+            }
+        };
+
+        for (const RenderCommand& command : pimpl->commands) {
+            const RenderCommandPass pass = RenderSortKey::get_pass(command.sort_key);
+            if (pass != current_pass) {
+                close_pass();
+                current_pass = pass;
+            }
+            const Color color(command.color.r, command.color.g, command.color.b, command.color.a);
+
+            switch (command.type) {
+                case RenderCommandType::Sprite:
+                    if (!sprite_batch_open) {
+                        renderer.begin_sprite_batch();
+                        sprite_batch_open = true;
+                    }
+                    renderer.submit_sprite(command.texture, command.transform, color,
+                                           RenderSortKey::get_layer(command.sort_key));
+                    break;
+                case RenderCommandType::Sphere:
+                    renderer.draw_sphere(command.point_a, command.radius, color, command.segments);
+                    break;
+                case RenderCommandType::Line:
+                    renderer.debug_line(command.point_a, command.point_b, color);
+                    debug_pending = true;
+                    break;
+                case RenderCommandType::WireBox:
+                    renderer.debug_wire_box(command.transform, color);
+                    debug_pending = true;
+                    break;
+                case RenderCommandType::WireSphere:
+                    renderer.debug_wire_sphere(command.point_a, command.radius, color, command.segments);
+                    debug_pending = true;
+                    break;
+            }
+        }
+        close_pass();
+    }
+
+
+    void RenderCommandList::execute(IRenderCommandExecutor& executor, RenderStats& stats) const {
+        const auto& commands = pimpl->commands;
+        constexpr uint32_t NO_SHADER = ~0u;
+        uint32_t bound_shader = NO_SHADER;
+        const ITexture* bound_texture = nullptr;
+
+        size_t first = 0;
+        while (first < commands.size()) {
+            const RenderCommand& command = commands[first];
+            size_t last = first + 1;
+            bool drawn = false;
+
+            if (command.type == RenderCommandType::Sprite) {
+                // Regions of one atlas page share the page's bind and draw.
+                ITexture* texture = command.texture ? command.texture->get_base_texture() : nullptr;
+                while (last < commands.size() && commands[last].type == RenderCommandType::Sprite &&
+                       (commands[last].texture ? commands[last].texture->get_base_texture() : nullptr) == texture) {
+                    ++last;
+                }
+                drawn = executor.draw_sprites(&command, last - first);
+                if (drawn) {
+                    if (texture != bound_texture) {
+                        bound_texture = texture;
+                        ++stats.texture_binds;
+                    }
+                    stats.sprites += static_cast<uint32_t>(last - first);
+                }
+            }
+            else if (is_debug_shape(command.type)) {
+                while (last < commands.size() && is_debug_shape(commands[last].type)) {
+                    ++last;
+                }
+                drawn = executor.draw_debug_shapes(&command, last - first);
+            }
+            else {
+                drawn = executor.draw_sphere(command);
+            }
+
+            if (drawn) {
+                const uint32_t shader = RenderSortKey::get_shader(command.sort_key);
+                if (shader != bound_shader) {
+                    bound_shader = shader;
+                    ++stats.shader_binds;
+                }
+                ++stats.draw_calls;
+            }
+            first = last;
+        }
+    }
+
+
+    RenderStats RenderCommandList::replay_to_stats() const {
+        RenderStatsExecutor executor;
+        RenderStats stats;
+        execute(executor, stats);
+        return stats;
+    }
+
+
+    // --- RenderStatsExecutor ---
+
+    bool RenderStatsExecutor::draw_sprites(const RenderCommand* commands, size_t count) {
+        (void)commands; (void)count;
+        return true;
+    }
+
+    bool RenderStatsExecutor::draw_sphere(const RenderCommand& command) {
+        (void)command;
+        return true;
+    }
+
+    bool RenderStatsExecutor::draw_debug_shapes(const RenderCommand* commands, size_t count) {
+        (void)commands; (void)count;
+        return true;
+    }
+
+} // namespace Salix
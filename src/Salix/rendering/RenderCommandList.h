@@ -0,0 +1,158 @@
+// =================================================================================
+// Filename:    Salix/rendering/RenderCommandList.h
+// Author:      SalixGameStudio
+// Description: Declares RenderCommandList, which records draws as plain data
+//              with 64-bit sort keys so they can be built on any thread,
+//              merged, sorted and then executed by a renderer or replayed
+//              into RenderStats without a GPU.
+// =================================================================================
+#pragma once
+
+#include <Salix/core/Core.h>
+#include <Salix/math/Color.h>
+#include <Salix/rendering/RenderStats.h>
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Salix {
+
+    // Forward declarations
+    class ITexture;
+    class IRenderer;
+
+    // Coarsest part of the sort key: passes execute in this order.
+    enum class RenderCommandPass : uint8_t {
+        World = 0,      // Solid 3D meshes.
+        Sprites = 1,
+        Debug = 2,      // Lines, wire boxes, wire spheres.
+        Overlay = 3
+    };
+
+    enum class RenderCommandType : uint8_t {
+        Sprite,
+        Sphere,
+        Line,
+        WireBox,
+        WireSphere
+    };
+
+    // One recorded draw. Plain data: copying or merging lists is a memcpy.
+    struct RenderCommand {
+        uint64_t sort_key = 0;
+        RenderCommandType type = RenderCommandType::Sprite;
+        ITexture* texture = nullptr;    // Sprite
+        glm::mat4 transform;            // Sprite, WireBox
+        glm::vec4 color;
+        glm::vec3 point_a;              // Line start, sphere centre
+        glm::vec3 point_b;              // Line end
+        float radius = 0.0f;            // Sphere, WireSphere
+        int32_t segments = 0;           // Sphere, WireSphere
+    };
+
+    // Sort key layout, most significant first:
+    //   pass (4) | layer (16) | shader (4) | texture (20) | depth (20)
+    // Sorting on the whole key orders by pass, then sorting layer, then keeps
+    // commands that share a program and a texture next to each other.
+    namespace RenderSortKey {
+        constexpr int PASS_BITS = 4;
+        constexpr int LAYER_BITS = 16;
+        constexpr int SHADER_BITS = 4;
+        constexpr int TEXTURE_BITS = 20;
+        constexpr int DEPTH_BITS = 20;
+
+        // depth is clamped to 0..1; smaller sorts first.
+        SALIX_API uint64_t make(RenderCommandPass pass, int layer, uint32_t shader, uint32_t texture, float depth);
+        SALIX_API RenderCommandPass get_pass(uint64_t key);
+        SALIX_API int get_layer(uint64_t key);
+        SALIX_API uint32_t get_shader(uint64_t key);
+        SALIX_API uint32_t get_texture(uint64_t key);
+        // Folds a texture pointer into TEXTURE_BITS. Equal textures always get
+        // equal bits; a collision only costs an extra texture bind.
+        SALIX_API uint32_t texture_bits(const ITexture* texture);
+    }
+
+    // Issues the draws of a sorted list. RenderCommandList::execute() cuts the
+    // list into runs that can share one draw and hands them over in order; an
+    // executor only talks to its API. Each call returns false if nothing could
+    // be drawn, in which case the run is not counted.
+    class SALIX_API IRenderCommandExecutor {
+        public:
+            virtual ~IRenderCommandExecutor() = default;
+
+            // Consecutive sprites whose textures share a base texture.
+            virtual bool draw_sprites(const RenderCommand* commands, size_t count) = 0;
+            virtual bool draw_sphere(const RenderCommand& command) = 0;
+            // Consecutive lines, wire boxes and wire spheres.
+            virtual bool draw_debug_shapes(const RenderCommand* commands, size_t count) = 0;
+    };
+
+    // Draws nothing and accepts every run, so executing through it leaves only
+    // the counting: the CPU side of a frame measured without a GPU.
+    class SALIX_API RenderStatsExecutor : public IRenderCommandExecutor {
+        public:
+            bool draw_sprites(const RenderCommand* commands, size_t count) override;
+            bool draw_sphere(const RenderCommand& command) override;
+            bool draw_debug_shapes(const RenderCommand* commands, size_t count) override;
+    };
+
+    // A list is filled by one thread at a time. To record in parallel give
+    // every worker its own list, then append() them together on one thread
+    // before sort() and execute().
+    class SALIX_API RenderCommandList {
+        public:
+            RenderCommandList();
+            ~RenderCommandList();
+            RenderCommandList(RenderCommandList&& other) noexcept;
+            RenderCommandList& operator=(RenderCommandList&& other) noexcept;
+
+            // depth is only used for ordering (0 = near, 1 = far).
+            void add_sprite(ITexture* texture, const glm::mat4& model_matrix, const Color& color,
+                            int sorting_layer, float depth = 0.0f);
+            void add_sphere(const glm::vec3& center, float radius, const Color& color, int segments = 16);
+            void add_line(const glm::vec3& start, const glm::vec3& end, const Color& color);
+            void add_wire_box(const glm::mat4& model_matrix, const Color& color);
+            void add_wire_sphere(const glm::vec3& center, float radius, const Color& color, int segments = 16);
+            // For callers that build their own keys.
+            void add(const RenderCommand& command);
+
+            // Copies other's commands after ours, keeping their order.
+            void append(const RenderCommand* commands, size_t count);
+            void append(const RenderCommandList& other);
+
+            // Stable LSD radix sort on sort_key: equal keys keep recording order.
+            void sort();
+
+            // Drops all commands but keeps the storage.
+            void clear();
+            size_t size() const;
+            bool empty() const;
+            const std::vector<RenderCommand>& get_commands() const;
+
+            // Hands the list, in order, to executor one run at a time and adds
+            // what drawing it costs to stats: a program bind whenever a run needs
+            // a different program than the last one drawn, a texture bind whenever
+            // a sprite run's base texture differs from the last one bound, and
+            // one draw per run. Renderers execute their recorded frame through
+            // this, so headless counts match what they report.
+            void execute(IRenderCommandExecutor& executor, RenderStats& stats) const;
+
+            // Issues every command, in list order, through the renderer's public
+            // batched entry points. For renderers that do not keep a list of
+            // their own (IRenderer::submit_commands() falls back to it).
+            void execute(IRenderer& renderer) const;
+
+            // execute() through a RenderStatsExecutor.
+            RenderStats replay_to_stats() const;
+
+        private:
+            RenderCommandList(const RenderCommandList&) = delete;
+            RenderCommandList& operator=(const RenderCommandList&) = delete;
+
+            struct Pimpl;
+            std::unique_ptr<Pimpl> pimpl;
+    };
+
+} // namespace Salix
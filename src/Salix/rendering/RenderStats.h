@@ -0,0 +1,24 @@
+// =================================================================================
+// Filename:    Salix/rendering/RenderStats.h
+// Author:      SalixGameStudio
+// Description: Declares RenderStats, the per-frame draw and state counters every
+//              renderer reports.
+// =================================================================================
+#pragma once
+
+#include <cstdint>
+
+namespace Salix {
+
+    // Counters a renderer resets in begin_frame() and bumps as it talks to the GPU.
+    struct RenderStats {
+        uint32_t draw_calls = 0;
+        uint32_t texture_binds = 0;
+        uint32_t shader_binds = 0;
+        uint32_t sprites = 0;
+        // GL state changes a renderer issued, and the redundant ones it skipped.
+        uint32_t state_changes = 0;
+        uint32_t state_changes_skipped = 0;
+    };
+
+} // namespace Salix
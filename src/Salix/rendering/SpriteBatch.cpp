@@ -0,0 +1,96 @@
+// =================================================================================
+// Filename:    Salix/rendering/SpriteBatch.cpp
+// Author:      SalixGameStudio
+// Description: Implements the SpriteBatch.
+// =================================================================================
+#include <Salix/rendering/SpriteBatch.h>
+#include <Salix/rendering/ITexture.h>
+#include <algorithm>
+#include <functional>
+
+namespace Salix {
+
+    struct SpriteBatch::Pimpl {
+        struct Submission {
+            ITexture* texture;
+            int sorting_layer;
+            SpriteInstance instance;
+        };
+
+        bool active = false;
+        std::vector<Submission> submissions;
+        // Indices into submissions, sorted in end().
+        std::vector<uint32_t> order;
+        std::vector<SpriteInstance> instances;
+        std::vector<SpriteRun> runs;
+    };
+
+
+    SpriteBatch::SpriteBatch() : pimpl(std::make_unique<Pimpl>()) {}
+    SpriteBatch::~SpriteBatch() = default;
+
+
+    void SpriteBatch::begin() {
+        pimpl->submissions.clear();
+        pimpl->instances.clear();
+        pimpl->runs.clear();
+        pimpl->active = true;
+    }
+
+    bool SpriteBatch::is_active() const {
+        return pimpl->active;
+    }
+
+    void SpriteBatch::submit(ITexture* texture, const glm::mat4& model_matrix, const Color& tint, int sorting_layer) {
+        if (!texture) return;
+        pimpl->submissions.push_back({ texture->get_base_texture(), sorting_layer,
+            { model_matrix, glm::vec4(tint.r, tint.g, tint.b, tint.a), texture->get_uv_rect() } });
+    }
+
+
+    void SpriteBatch::end() {
+        pimpl->active = false;
+        const auto& submissions = pimpl->submissions;
+        const uint32_t count = static_cast<uint32_t>(submissions.size());
+
+        pimpl->order.resize(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            pimpl->order[i] = i;
+        }
+        // The index is the last key, which makes the sort stable within a group.
+        std::sort(pimpl->order.begin(), pimpl->order.end(), [&submissions](uint32_t a, uint32_t b) {
+            const auto& left = submissions[a];
+            const auto& right = submissions[b];
+            if (left.sorting_layer != right.sorting_layer) return left.sorting_layer < right.sorting_layer;
+            if (left.texture != right.texture) return std::less<ITexture*>()(left.texture, right.texture);
+            return a < b;
+        });
+
+        pimpl->instances.resize(count);
+        pimpl->runs.clear();
+        for (uint32_t i = 0; i < count; ++i) {
+            const auto& submission = submissions[pimpl->order[i]];
+            pimpl->instances[i] = submission.instance;
+            // Instances of one draw are blended in order, so a texture that spans
+            // the end of one layer and the start of the next still needs one run.
+            if (pimpl->runs.empty() || pimpl->runs.back().texture != submission.texture) {
+                pimpl->runs.push_back({ submission.texture, submission.sorting_layer, i, 0 });
+            }
+            ++pimpl->runs.back().count;
+        }
+    }
+
+
+    const std::vector<SpriteInstance>& SpriteBatch::get_instances() const {
+        return pimpl->instances;
+    }
+
+    const std::vector<SpriteRun>& SpriteBatch::get_runs() const {
+        return pimpl->runs;
+    }
+
+    size_t SpriteBatch::get_sprite_count() const {
+        return pimpl->submissions.size();
+    }
+
+} // namespace Salix
@@ -0,0 +1,95 @@
+// =================================================================================
+// Filename:    Salix/rendering/SpriteBatch.h
+// Author:      SalixGameStudio
+// Description: Declares SpriteBatch, which collects a frame's sprite submissions
+//              and groups them into per-texture runs for instanced drawing.
+// =================================================================================
+#pragma once
+
+#include <Salix/core/Core.h>
+#include <Salix/math/Color.h>
+#include <Salix/rendering/RenderStats.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Salix {
+
+    // Forward declarations
+    class ITexture;
+
+    // Per-instance data exactly as it is streamed to the GPU.
+    struct SpriteInstance {
+        glm::mat4 model;
+        glm::vec4 tint;
+        glm::vec4 uv_rect;      // See ITexture::get_uv_rect().
+    };
+
+    // A contiguous range of instances that share a texture: one draw call.
+    // Sprites from one atlas page share the page's run.
+    struct SpriteRun {
+        ITexture* texture = nullptr;
+        int sorting_layer = 0;      // Layer of the run's first instance.
+        uint32_t first = 0;
+        uint32_t count = 0;
+    };
+
+    // Renderer agnostic: it only orders and packs the data. A renderer calls
+    // begin(), forwards its submit_sprite() calls, then end() and draws each run.
+    // Sprites are ordered by sorting layer, then texture; inside one (layer,
+    // texture) group they keep their submission order.
+    class SALIX_API SpriteBatch {
+        public:
+            SpriteBatch();
+            ~SpriteBatch();
+
+            // Discards the previous batch (keeping its storage) and starts recording.
+            void begin();
+            bool is_active() const;
+
+            void submit(ITexture* texture, const glm::mat4& model_matrix, const Color& tint, int sorting_layer);
+
+            // Stops recording and builds get_instances()/get_runs().
+            void end();
+
+            // Valid after end(), in draw order.
+            const std::vector<SpriteInstance>& get_instances() const;
+            const std::vector<SpriteRun>& get_runs() const;
+
+            // Walks the runs in draw order and adds what drawing them costs to
+            // stats: one program bind for the batch, a texture bind whenever a
+            // run's texture differs from the last one drawn, and one draw per
+            // run. draw_run(run, bind_texture) issues the run and returns false
+            // if it could not be drawn, in which case nothing is counted for it.
+            // Counts the same way RenderCommandList::execute() does for the
+            // renderers' recorded sprites.
+            template<typename DrawRun>
+            void draw_runs(RenderStats& stats, DrawRun&& draw_run) const {
+                const std::vector<SpriteRun>& runs = get_runs();
+                if (runs.empty()) return;
+                ++stats.shader_binds;
+                const ITexture* bound_texture = nullptr;
+                for (const SpriteRun& run : runs) {
+                    const bool bind_texture = run.texture != bound_texture;
+                    if (!draw_run(run, bind_texture)) continue;
+                    if (bind_texture) {
+                        bound_texture = run.texture;
+                        ++stats.texture_binds;
+                    }
+                    ++stats.draw_calls;
+                    stats.sprites += run.count;
+                }
+            }
+
+            size_t get_sprite_count() const;
+
+        private:
+            SpriteBatch(const SpriteBatch&) = delete;
+            SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+            struct Pimpl;
+            std::unique_ptr<Pimpl> pimpl;
+    };
+
+} // namespace Salix
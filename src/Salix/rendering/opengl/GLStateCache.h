@@ -0,0 +1,158 @@
+// =================================================================================
+// Filename:    Salix/rendering/opengl/GLStateCache.h
+// Author:      SalixGameStudio
+// Description: Declares GLStateCache, the renderer's shadow copy of the GL state
+//              it changes, used to drop redundant binds and toggles.
+// =================================================================================
+#pragma once
+#include <glad/glad.h>
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+
+namespace Salix {
+
+    // Shadow copy of the GL state the renderer touches. Every setter compares
+    // against the last value it issued and returns without a GL call when
+    // nothing would change. Anything that changes GL state behind its back
+    // (ImGui, a context switch) must be followed by invalidate().
+    //
+    // GL hands out the names of deleted objects again, so every delete of a
+    // texture, VAO or framebuffer must be paired with the matching forget_*()
+    // call; otherwise a new object that reuses the name looks already bound.
+    class GLStateCache {
+        public:
+            static constexpr int TEXTURE_UNITS = 16;
+
+            void use_program(GLuint program) {
+                if (program_known && program == program_id) { ++skipped; return; }
+                glad_glUseProgram(program);
+                program_id = program;
+                program_known = true;
+                ++issued;
+            }
+
+            void bind_vertex_array(GLuint vao) {
+                if (vao_known && vao == vao_id) { ++skipped; return; }
+                glad_glBindVertexArray(vao);
+                vao_id = vao;
+                vao_known = true;
+                ++issued;
+            }
+
+            // GL_TEXTURE_2D on the given unit.
+            void bind_texture(GLuint unit, GLuint texture) {
+                if (unit >= TEXTURE_UNITS) return;
+                if (texture_known[unit] && texture == textures[unit]) { ++skipped; return; }
+                if (!active_unit_known || active_unit != unit) {
+                    glad_glActiveTexture(GL_TEXTURE0 + unit);
+                    active_unit = unit;
+                    active_unit_known = true;
+                    ++issued;
+                }
+                glad_glBindTexture(GL_TEXTURE_2D, texture);
+                textures[unit] = texture;
+                texture_known[unit] = true;
+                ++issued;
+            }
+
+            void set_blend(bool enabled) { set_capability(GL_BLEND, enabled, blend); }
+            void set_depth_test(bool enabled) { set_capability(GL_DEPTH_TEST, enabled, depth_test); }
+
+            void set_depth_mask(bool enabled) {
+                if (depth_mask == static_cast<int8_t>(enabled)) { ++skipped; return; }
+                glad_glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+                depth_mask = static_cast<int8_t>(enabled);
+                ++issued;
+            }
+
+            // For GL_FRONT_AND_BACK; GL_FILL or GL_LINE.
+            void set_polygon_mode(GLenum mode) {
+                if (polygon_mode_known && mode == polygon_mode) { ++skipped; return; }
+                glad_glPolygonMode(GL_FRONT_AND_BACK, mode);
+                polygon_mode = mode;
+                polygon_mode_known = true;
+                ++issued;
+            }
+
+            void bind_framebuffer(GLuint framebuffer) {
+                if (framebuffer_known && framebuffer == framebuffer_id) { ++skipped; return; }
+                glad_glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+                framebuffer_id = framebuffer;
+                framebuffer_known = true;
+                ++issued;
+            }
+
+            // The draw framebuffer, queried from GL only when it is not known.
+            GLuint get_framebuffer() {
+                if (!framebuffer_known) {
+                    GLint binding = 0;
+                    glad_glGetIntegerv(GL_FRAMEBUFFER_BINDING, &binding);
+                    framebuffer_id = static_cast<GLuint>(binding);
+                    framebuffer_known = true;
+                }
+                return framebuffer_id;
+            }
+
+            // Call just before glDeleteTextures: every unit that held the name
+            // goes back to unknown.
+            void forget_texture(GLuint texture) {
+                for (int unit = 0; unit < TEXTURE_UNITS; ++unit) {
+                    if (textures[unit] == texture) texture_known[unit] = false;
+                }
+            }
+
+            // Call just before glDeleteVertexArrays.
+            void forget_vertex_array(GLuint vao) {
+                if (vao_id == vao) vao_known = false;
+            }
+
+            // Call just before glDeleteFramebuffers.
+            void forget_framebuffer(GLuint framebuffer) {
+                if (framebuffer_id == framebuffer) framebuffer_known = false;
+            }
+
+            // Forgets everything, so the next call to each setter reaches GL.
+            void invalidate() {
+                program_known = vao_known = framebuffer_known = false;
+                polygon_mode_known = active_unit_known = false;
+                std::fill(std::begin(texture_known), std::end(texture_known), false);
+                blend = depth_test = depth_mask = UNKNOWN;
+            }
+
+            uint32_t get_issued_count() const { return issued; }
+            uint32_t get_skipped_count() const { return skipped; }
+            void reset_counters() { issued = skipped = 0; }
+
+        private:
+            static constexpr int8_t UNKNOWN = -1;
+
+            void set_capability(GLenum capability, bool enabled, int8_t& state) {
+                if (state == static_cast<int8_t>(enabled)) { ++skipped; return; }
+                if (enabled) glad_glEnable(capability);
+                else glad_glDisable(capability);
+                state = static_cast<int8_t>(enabled);
+                ++issued;
+            }
+
+            GLuint program_id = 0;
+            bool program_known = false;
+            GLuint vao_id = 0;
+            bool vao_known = false;
+            GLuint textures[TEXTURE_UNITS] = {};
+            bool texture_known[TEXTURE_UNITS] = {};
+            GLuint active_unit = 0;
+            bool active_unit_known = false;
+            GLenum polygon_mode = GL_FILL;
+            bool polygon_mode_known = false;
+            GLuint framebuffer_id = 0;
+            bool framebuffer_known = false;
+            int8_t blend = UNKNOWN;
+            int8_t depth_test = UNKNOWN;
+            int8_t depth_mask = UNKNOWN;
+
+            uint32_t issued = 0;
+            uint32_t skipped = 0;
+    };
+
+} // namespace Salix
@@ -11,6 +11,7 @@
 #include <Salix/rendering/ICamera.h>
 #include <Salix/rendering/opengl/OpenGLRenderer.h> 
 #include <Salix/rendering/opengl/OpenGLTexture.h>
+#include <Salix/rendering/opengl/GLStateCache.h>
 #include <Salix/window/sdl/SDLWindow.h>
 #include <Salix/window/WindowConfig.h>
 #include <Salix/window/IWindow.h>
@@ -22,6 +23,9 @@
 #include <Salix/events/sdl/SDLEvent.h>
 // Include the header for your OpenGLShaderProgram class
 #include <Salix/rendering/opengl/OpenGLShaderProgram.h> 
+#include <Salix/rendering/SpriteBatch.h>
+#include <Salix/rendering/RenderCommandList.h>
+#include <Salix/rendering/DebugDrawList.h>
 #include <imgui/imgui.h> // required for ImGui framebuffers in the Editor.
 #include <glad/glad.h> // GLAD must be included before SDL_opengl.h (if used)
 #include <SDL.h>       // For SDL_GL_SwapWindow, SDL_GL_CreateContext, etc.
@@ -30,6 +34,9 @@
 #include <filesystem>
 #include <fstream>
 #include <stack>
+#include <algorithm>   // For std::clamp
+#include <iterator>
+#include <cstddef>     // For offsetof
 
 // GLM includes for matrix transformations
 #include <glm/glm.hpp>
@@ -39,6 +46,19 @@
 
 namespace Salix {
 
+    namespace {
+        // Interned once; per-draw uniform writes are then a location lookup.
+        const OpenGLShaderProgram::UniformId UNIFORM_MODEL = OpenGLShaderProgram::uniform_id("model");
+        const OpenGLShaderProgram::UniformId UNIFORM_PROJECTION = OpenGLShaderProgram::uniform_id("projection");
+        const OpenGLShaderProgram::UniformId UNIFORM_TINT_COLOR = OpenGLShaderProgram::uniform_id("tint_color");
+        const OpenGLShaderProgram::UniformId UNIFORM_UV_RECT = OpenGLShaderProgram::uniform_id("uvRect");
+        const OpenGLShaderProgram::UniformId UNIFORM_OBJECT_COLOR = OpenGLShaderProgram::uniform_id("object_color");
+        const OpenGLShaderProgram::UniformId UNIFORM_TEXTURE_SAMPLER = OpenGLShaderProgram::uniform_id("texture_sampler");
+
+        // Must match the CameraBlock binding in the 2D and 3D vertex shaders.
+        constexpr GLuint CAMERA_BLOCK_BINDING = 0;
+    }
+
     // --- OpenGLRenderer Pimpl Implementation ---
     struct OpenGLRenderer::Pimpl {
         std::unique_ptr<IWindow> window;
@@ -59,30 +79,82 @@ namespace Salix {
         const std::string color_fragment_file = "Assets/Shaders/OpenGL/2D/color.frag";
         std::unique_ptr<OpenGLShaderProgram> texture_shader; // For drawing textures/sprites.
         std::unique_ptr<OpenGLShaderProgram> color_shader;   // For drawing colored rectangles.
+        // Instanced sprites: model matrix and tint come from a per-instance buffer.
+        const std::string texture_instanced_vertex_file = "Assets/Shaders/OpenGL/2D/textured_instanced.vert";
+        const std::string texture_instanced_fragment_file = "Assets/Shaders/OpenGL/2D/textured_instanced.frag";
+        std::unique_ptr<OpenGLShaderProgram> texture_instanced_shader;
         float pixels_per_unit = 100.0f;
+        // Sprites are drawn this far between their previous and current tick state.
+        float interpolation_alpha = 1.0f;
         // 3D Shader
         const std::string simple_3d_vertex_file = "Assets/Shaders/OpenGL/3D/simple.vert";
         const std::string simple_3d_fragment_file = "Assets/Shaders/OpenGL/3D/color_only.frag";
         std::unique_ptr<OpenGLShaderProgram> simple_3d_shader;
+        // Debug lines: world-space positions with a per-vertex colour.
+        const std::string debug_line_vertex_file = "Assets/Shaders/OpenGL/3D/debug_line.vert";
+        const std::string debug_line_fragment_file = "Assets/Shaders/OpenGL/3D/debug_line.frag";
+        std::unique_ptr<OpenGLShaderProgram> debug_line_shader;
 
         // Framebuffer stack
         std::stack<GLint> framebuffer_stack;
 
+        // All program, VAO, texture, blend/depth/polygon and framebuffer changes
+        // go through here so repeated draws only pay for what actually differs.
+        // Shared with every OpenGLTexture created here, which forgets its name
+        // on deletion; textures that outlive the renderer find it gone.
+        std::shared_ptr<GLStateCache> state = std::make_shared<GLStateCache>();
+
         // --- Geometry ---
 
         // 2D Quad
         GLuint quad_vao = 0; // Vertex Array Object for the quad.
         GLuint quad_vbo = 0; // Vertex Buffer Object for the quad vertices (positions and texture coordinates).
 
+        // Sprite batching: the quad plus a streaming buffer of SpriteInstance.
+        GLuint sprite_instance_vao = 0;
+        GLuint sprite_instance_vbo = 0;
+        size_t sprite_instance_capacity = 0; // In instances.
+        std::vector<SpriteInstance> sprite_instances; // Staging for one upload.
+        RenderStats stats;
+
+        // Batched sprites and debug shapes are recorded here and drawn, sorted,
+        // by execute_commands() at the next flush point.
+        RenderCommandList commands;
+        bool sprite_batch_open = false;
+        struct CommandExecutor;
+
         // 3D Cube
         GLuint cube_vao = 0;
         GLuint cube_vbo = 0;
 
+        // Debug drawing: a run of recorded shapes is expanded into debug_lines
+        // and streamed through one persistent, growable buffer.
+        DebugDrawList debug_lines;
+        GLuint debug_vao = 0;
+        GLuint debug_vbo = 0;
+        size_t debug_capacity = 0; // In vertices.
+
+        // Static line meshes handed out by create_line_mesh().
+        struct LineMesh {
+            GLuint vao = 0;
+            GLuint vbo = 0;
+            GLsizei vertex_count = 0;
+        };
+        std::map<uint32_t, LineMesh> line_meshes;
+        uint32_t next_line_mesh_id = 1;
+
 
         // --- Matrices & Camera ---
         glm::mat4 projection_matrix_2d;        // Orthographic projection matrix.
         ICamera* active_camera = nullptr;    // Pointer to the active camera.
 
+        // Per-frame camera uniform buffer (view, then projection, std140).
+        // Re-uploaded only when the active camera's matrices change.
+        GLuint camera_ubo = 0;
+        glm::mat4 uploaded_view = glm::mat4(1.0f);
+        glm::mat4 uploaded_projection = glm::mat4(1.0f);
+        bool camera_block_valid = false;
+
         
 
         std::map<uint32_t, Framebuffer> framebuffers;
@@ -90,9 +162,21 @@ namespace Salix {
 
         // Private helper methods for Pimpl's internal setup
         void setup_quad_geometry();
+        void setup_sprite_instancing();   // Needs the quad VBO.
+        // Sorts and draws everything recorded in 'commands', then clears it.
+        void execute_commands();
+        void setup_debug_draw();
+        // Points 'vao' at a buffer of DebugVertex (positions at 0, colours at 1).
+        void configure_debug_vertex_array(GLuint vao, GLuint vbo) const;
+        bool draw_debug_lines();
+        bool draw_sphere_mesh(const glm::vec3& center, float radius, const Color& color);
+        glm::mat4 build_sprite_model_matrix(ITexture* texture, const Transform* transform, SpriteFlip flip) const;
         void setup_cube_geometry();
         void setup_sphere_geometry(int segments = 16); // Default segments
         void setup_shaders();
+        void setup_camera_block();
+        // Brings the camera block up to date with active_camera. False if there is none.
+        bool sync_camera_block();
         void create_2D_projection_matrix(int width, int height); // Takes window dimensions.
         
         void set_opengl_initial_state(); // Sets up blending, viewport, etc.
@@ -148,6 +232,260 @@ namespace Salix {
     }
 
 
+    void OpenGLRenderer::Pimpl::setup_sprite_instancing() {
+        glad_glCreateVertexArrays(1, &sprite_instance_vao);
+        glad_glCreateBuffers(1, &sprite_instance_vbo);
+
+        // Binding 0: the shared unit quad, exactly as in quad_vao.
+        glad_glVertexArrayVertexBuffer(sprite_instance_vao, 0, quad_vbo, 0, 4 * sizeof(float));
+        glad_glVertexArrayAttribBinding(sprite_instance_vao, 0, 0);
+        glad_glVertexArrayAttribFormat(sprite_instance_vao, 0, 2, GL_FLOAT, GL_FALSE, 0);
+        glad_glEnableVertexArrayAttrib(sprite_instance_vao, 0);
+        glad_glVertexArrayAttribBinding(sprite_instance_vao, 1, 0);
+        glad_glVertexArrayAttribFormat(sprite_instance_vao, 1, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float));
+        glad_glEnableVertexArrayAttrib(sprite_instance_vao, 1);
+
+        // Binding 1: one SpriteInstance per instance. The mat4 takes locations 2-5
+        // (one column each), the tint location 6 and the atlas UV rect location 7.
+        glad_glVertexArrayVertexBuffer(sprite_instance_vao, 1, sprite_instance_vbo, 0, sizeof(SpriteInstance));
+        glad_glVertexArrayBindingDivisor(sprite_instance_vao, 1, 1);
+        for (GLuint column = 0; column < 4; ++column) {
+            const GLuint location = 2 + column;
+            glad_glVertexArrayAttribBinding(sprite_instance_vao, location, 1);
+            glad_glVertexArrayAttribFormat(sprite_instance_vao, location, 4, GL_FLOAT, GL_FALSE,
+                static_cast<GLuint>(offsetof(SpriteInstance, model) + column * sizeof(glm::vec4)));
+            glad_glEnableVertexArrayAttrib(sprite_instance_vao, location);
+        }
+        glad_glVertexArrayAttribBinding(sprite_instance_vao, 6, 1);
+        glad_glVertexArrayAttribFormat(sprite_instance_vao, 6, 4, GL_FLOAT, GL_FALSE,
+            static_cast<GLuint>(offsetof(SpriteInstance, tint)));
+        glad_glEnableVertexArrayAttrib(sprite_instance_vao, 6);
+        glad_glVertexArrayAttribBinding(sprite_instance_vao, 7, 1);
+        glad_glVertexArrayAttribFormat(sprite_instance_vao, 7, 4, GL_FLOAT, GL_FALSE,
+            static_cast<GLuint>(offsetof(SpriteInstance, uv_rect)));
+        glad_glEnableVertexArrayAttrib(sprite_instance_vao, 7);
+    }
+
+
+    void OpenGLRenderer::Pimpl::configure_debug_vertex_array(GLuint vao, GLuint vbo) const {
+        glad_glVertexArrayVertexBuffer(vao, 0, vbo, 0, sizeof(DebugVertex));
+        glad_glVertexArrayAttribBinding(vao, 0, 0);
+        glad_glVertexArrayAttribFormat(vao, 0, 3, GL_FLOAT, GL_FALSE, static_cast<GLuint>(offsetof(DebugVertex, position)));
+        glad_glEnableVertexArrayAttrib(vao, 0);
+        glad_glVertexArrayAttribBinding(vao, 1, 0);
+        glad_glVertexArrayAttribFormat(vao, 1, 4, GL_FLOAT, GL_FALSE, static_cast<GLuint>(offsetof(DebugVertex, color)));
+        glad_glEnableVertexArrayAttrib(vao, 1);
+    }
+
+
+    void OpenGLRenderer::Pimpl::setup_debug_draw() {
+        glad_glCreateVertexArrays(1, &debug_vao);
+        glad_glCreateBuffers(1, &debug_vbo);
+        configure_debug_vertex_array(debug_vao, debug_vbo);
+    }
+
+
+    bool OpenGLRenderer::Pimpl::draw_debug_lines() {
+        if (debug_lines.empty() || !active_camera || !debug_line_shader) return false;
+
+        // Grow geometrically, then orphan and refill like the sprite instance buffer.
+        const auto& vertices = debug_lines.get_vertices();
+        const size_t count = vertices.size();
+        if (count > debug_capacity) {
+            debug_capacity = std::max<size_t>({ count, debug_capacity * 2, 1024 });
+        }
+        glad_glNamedBufferData(debug_vbo, debug_capacity * sizeof(DebugVertex), nullptr, GL_STREAM_DRAW);
+        glad_glNamedBufferSubData(debug_vbo, 0, count * sizeof(DebugVertex), vertices.data());
+
+        state->set_depth_mask(true);
+        state->use_program(debug_line_shader->ID);
+        sync_camera_block();
+        state->bind_vertex_array(debug_vao);
+        glad_glDrawArrays(GL_LINES, 0, static_cast<GLsizei>(count));
+        return true;
+    }
+
+
+    void OpenGLRenderer::Pimpl::setup_camera_block() {
+        glad_glCreateBuffers(1, &camera_ubo);
+        glad_glNamedBufferData(camera_ubo, 2 * sizeof(glm::mat4), nullptr, GL_DYNAMIC_DRAW);
+        glad_glBindBufferBase(GL_UNIFORM_BUFFER, CAMERA_BLOCK_BINDING, camera_ubo);
+        camera_block_valid = false;
+    }
+
+
+    bool OpenGLRenderer::Pimpl::sync_camera_block() {
+        if (!active_camera) return false;
+        const glm::mat4& view = active_camera->get_view_matrix();
+        const glm::mat4& projection = active_camera->get_projection_matrix();
+        if (camera_block_valid && view == uploaded_view && projection == uploaded_projection) {
+            return true;
+        }
+        uploaded_view = view;
+        uploaded_projection = projection;
+        glad_glNamedBufferSubData(camera_ubo, 0, sizeof(glm::mat4), glm::value_ptr(uploaded_view));
+        glad_glNamedBufferSubData(camera_ubo, sizeof(glm::mat4), sizeof(glm::mat4), glm::value_ptr(uploaded_projection));
+        camera_block_valid = true;
+        return true;
+    }
+
+
+    glm::mat4 OpenGLRenderer::Pimpl::build_sprite_model_matrix(ITexture* texture, const Transform* transform, SpriteFlip flip) const {
+        // 1. Build the LOCAL Model Matrix for the sprite
+        // In fixed-step mode, draw the state between the last two ticks.
+        const float alpha = interpolation_alpha;
+        const Vector3 position = transform->get_interpolated_position(alpha);
+        const Vector3 rotation = transform->get_interpolated_rotation(alpha);
+        const Vector3 scale = transform->get_interpolated_scale(alpha);
+        glm::mat4 local_model = glm::mat4(1.0f);
+        local_model = glm::translate(local_model, position.to_glm());
+        local_model = glm::rotate(local_model, glm::radians(rotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
+        
+        const float PIXELS_PER_UNIT = pixels_per_unit;
+        float world_width = (float)texture->get_width() / PIXELS_PER_UNIT;
+        float world_height = (float)texture->get_height() / PIXELS_PER_UNIT;
+
+        float scale_x = world_width * scale.x;
+        float scale_y = world_height * scale.y;
+        
+        if (flip == SpriteFlip::Horizontal || flip == SpriteFlip::Both) {
+            scale_x *= -1.0f;
+        }
+        if (flip == SpriteFlip::Vertical || flip == SpriteFlip::Both) {
+            scale_y *= -1.0f;
+        }
+        
+        local_model = glm::scale(local_model, glm::vec3(scale_x, scale_y, 1.0f));
+
+        // 2. Get the final world matrix by applying the parent's transform
+        const Transform* parent = transform->get_parent();
+        if (parent) {
+            // If there is a parent, multiply our local matrix by the parent's full world matrix
+            return parent->get_interpolated_world_matrix(alpha) * local_model;
+        }
+        return local_model;
+    }
+
+
+    // Issues a sorted RenderCommandList: sprite runs as instanced draws out of
+    // the buffer execute_commands() filled, debug runs through the line buffer.
+    struct OpenGLRenderer::Pimpl::CommandExecutor : IRenderCommandExecutor {
+        Pimpl& renderer;
+        uint32_t next_instance = 0; // Sprites in the list before the current run.
+
+        explicit CommandExecutor(Pimpl& owner) : renderer(owner) {}
+
+        bool draw_sprites(const RenderCommand* commands, size_t count) override {
+            const uint32_t first_instance = next_instance;
+            next_instance += static_cast<uint32_t>(count);
+            ITexture* texture = commands[0].texture;
+            OpenGLTexture* opengl_texture = texture ? dynamic_cast<OpenGLTexture*>(texture->get_base_texture()) : nullptr;
+            if (!opengl_texture || !renderer.texture_instanced_shader) return false;
+
+            // Same state as the single-sprite path: blended, no depth writes.
+            GLStateCache& state = *renderer.state;
+            state.set_blend(true);
+            state.set_depth_mask(false);
+            state.set_polygon_mode(GL_FILL);
+            state.use_program(renderer.texture_instanced_shader->ID);
+            renderer.sync_camera_block();
+            state.bind_vertex_array(renderer.sprite_instance_vao);
+            state.bind_texture(0, opengl_texture->get_id());
+            glad_glDrawArraysInstancedBaseInstance(GL_TRIANGLES, 0, 6, static_cast<GLsizei>(count), first_instance);
+            return true;
+        }
+
+        bool draw_sphere(const RenderCommand& command) override {
+            const Color color(command.color.r, command.color.g, command.color.b, command.color.a);
+            return renderer.draw_sphere_mesh(command.point_a, command.radius, color);
+        }
+
+        bool draw_debug_shapes(const RenderCommand* commands, size_t count) override {
+            DebugDrawList& lines = renderer.debug_lines;
+            lines.clear();
+            for (size_t i = 0; i < count; ++i) {
+                const RenderCommand& command = commands[i];
+                const Color color(command.color.r, command.color.g, command.color.b, command.color.a);
+                switch (command.type) {
+                    case RenderCommandType::Line:
+                        lines.add_line(command.point_a, command.point_b, color);
+                        break;
+                    case RenderCommandType::WireBox:
+                        lines.add_wire_box(command.transform, color);
+                        break;
+                    case RenderCommandType::WireSphere:
+                        lines.add_wire_sphere(command.point_a, command.radius, color, command.segments);
+                        break;
+                    default:
+                        break;
+                }
+            }
+            return renderer.draw_debug_lines();
+        }
+    };
+
+
+    void OpenGLRenderer::Pimpl::execute_commands() {
+        if (commands.empty()) return;
+        if (!active_camera) {
+            commands.clear();
+            return;
+        }
+        commands.sort();
+
+        // Every sprite's instance goes up in one upload, in list order, and each
+        // run draws its slice. Re-specifying the store orphans the one the GPU
+        // may still be reading, so uploading never waits on a previous draw.
+        sprite_instances.clear();
+        for (const RenderCommand& command : commands.get_commands()) {
+            if (command.type != RenderCommandType::Sprite) continue;
+            const glm::vec4 uv_rect = command.texture ? command.texture->get_uv_rect() : glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
+            sprite_instances.push_back({ command.transform, command.color, uv_rect });
+        }
+        const size_t count = sprite_instances.size();
+        if (count > 0) {
+            if (count > sprite_instance_capacity) {
+                sprite_instance_capacity = std::max<size_t>({ count, sprite_instance_capacity * 2, 256 });
+            }
+            glad_glNamedBufferData(sprite_instance_vbo, sprite_instance_capacity * sizeof(SpriteInstance), nullptr, GL_STREAM_DRAW);
+            glad_glNamedBufferSubData(sprite_instance_vbo, 0, count * sizeof(SpriteInstance), sprite_instances.data());
+        }
+
+        CommandExecutor executor(*this);
+        commands.execute(executor, stats);
+        commands.clear();
+    }
+
+
+    bool OpenGLRenderer::Pimpl::draw_sphere_mesh(const glm::vec3& center, float radius, const Color& color) {
+        if (!active_camera || !simple_3d_shader) return false;
+
+        // 1. Set up transform matrix (similar to your cube but with scale)
+        glm::mat4 model = glm::translate(glm::mat4(1.0f), center);
+        model = glm::scale(model, glm::vec3(radius));
+
+        // 2. Enable depth test (like your cube)
+        state->set_depth_test(true);
+        state->set_depth_mask(true);
+        state->set_polygon_mode(GL_FILL);
+        state->use_program(simple_3d_shader->ID);
+
+        // 3. Set shader uniforms (same as cube)
+        simple_3d_shader->setMat4(UNIFORM_MODEL, model);
+        sync_camera_block();
+        simple_3d_shader->setVec4(UNIFORM_TINT_COLOR, 
+            glm::vec4(color.r, color.g, color.b, color.a));
+
+        // 4. Draw the sphere
+        state->bind_vertex_array(sphere_vao);
+        glad_glDrawElements(GL_TRIANGLES, 
+                        sphere_index_count, 
+                        GL_UNSIGNED_INT, 
+                        nullptr);
+        return true;
+    }
+
+
     void OpenGLRenderer::Pimpl::setup_cube_geometry() {
         // A simple cube with positions and colors
         float vertices[] = {
@@ -308,28 +646,28 @@ namespace Salix {
         color_shader = std::make_unique<OpenGLShaderProgram>(color_vertex_file, color_fragment_file); 
         // Set the texture sampler uniform once (it refers to texture unit 0)
         texture_shader->use();
-        texture_shader->setInt("texture_sampler", 0); // Ensure the sampler is set to texture unit 0
+        texture_shader->setInt(UNIFORM_TEXTURE_SAMPLER, 0); // Ensure the sampler is set to texture unit 0
+        texture_instanced_shader = std::make_unique<OpenGLShaderProgram>(texture_instanced_vertex_file, texture_instanced_fragment_file);
+        texture_instanced_shader->use();
+        texture_instanced_shader->setInt(UNIFORM_TEXTURE_SAMPLER, 0);
         glad_glUseProgram(0); // Unuse shader
 
         // load the 3D shader
         simple_3d_shader = std::make_unique<OpenGLShaderProgram>(simple_3d_vertex_file, simple_3d_fragment_file);
+        debug_line_shader = std::make_unique<OpenGLShaderProgram>(debug_line_vertex_file, debug_line_fragment_file);
         if (!simple_3d_shader || simple_3d_shader->ID == 0) {
             std::cerr << "[FATAL] Failed to compile simple_3d_shader\n";
         }
 
 
-        GLint modelLoc = glad_glGetUniformLocation(texture_shader->ID, "model");
-        GLint projLoc = glad_glGetUniformLocation(texture_shader->ID, "projection");
-        GLint texSamplerLoc = glad_glGetUniformLocation(texture_shader->ID, "texture_sampler");
-        GLint tintColorLoc = glad_glGetUniformLocation(texture_shader->ID, "tint_color");
-        
-        
+        // View and projection come from the camera block, not per-program uniforms.
+        setup_camera_block();
+
         // --- DEBUG LINES ---
         std::cout << "DEBUG: Texture Shader Uniform Locations: "
-              << "model=" << modelLoc
-              << ", projection=" << projLoc
-              << ", texture_sampler=" << texSamplerLoc
-              << ", tint_color=" << tintColorLoc << std::endl;
+              << "model=" << texture_shader->get_uniform_location(UNIFORM_MODEL)
+              << ", texture_sampler=" << texture_shader->get_uniform_location(UNIFORM_TEXTURE_SAMPLER)
+              << ", tint_color=" << texture_shader->get_uniform_location(UNIFORM_TINT_COLOR) << std::endl;
         // --- END DEBUG LINES ---
 
 
@@ -354,13 +692,13 @@ namespace Salix {
 
     void OpenGLRenderer::Pimpl::set_opengl_initial_state() {
         // Enable blending for transparency
-        glad_glEnable(GL_BLEND);
+        state->set_blend(true);
         glad_glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
         // Disable depth testing for 2D rendering unless explicitly needed
         // glDisable(GL_DEPTH_TEST); 
 
         // Enable depth testing for 3D
-        glad_glEnable(GL_DEPTH_TEST);
+        state->set_depth_test(true);
 
         // Set initial clear color
         // glClearColor(0.1f, 0.1f, 0.2f, 1.0f); // Removed as it's set in clear() or set_clear_color()
@@ -449,6 +787,8 @@ namespace Salix {
 
         log_file << "[DEBUG] Setting up quad geometry..." << std::endl;
         pimpl->setup_quad_geometry();
+        pimpl->setup_sprite_instancing();
+        pimpl->setup_debug_draw();
         log_file << "[DEBUG] Quad geometry setup... OK" << std::endl;
 
         log_file << "[DEBUG] Setting up cube geometry..." << std::endl;
@@ -484,11 +824,42 @@ namespace Salix {
             pimpl->quad_vao = 0;
         }
 
+        if (pimpl->sprite_instance_vao != 0) {
+            glad_glDeleteVertexArrays(1, &pimpl->sprite_instance_vao);
+            pimpl->sprite_instance_vao = 0;
+        }
+        if (pimpl->sprite_instance_vbo != 0) {
+            glad_glDeleteBuffers(1, &pimpl->sprite_instance_vbo);
+            pimpl->sprite_instance_vbo = 0;
+            pimpl->sprite_instance_capacity = 0;
+        }
+        if (pimpl->camera_ubo != 0) {
+            glad_glDeleteBuffers(1, &pimpl->camera_ubo);
+            pimpl->camera_ubo = 0;
+            pimpl->camera_block_valid = false;
+        }
         if (pimpl->quad_vbo != 0) {
             glad_glDeleteBuffers(1, &pimpl->quad_vbo); 
             pimpl->quad_vbo = 0;
         }
 
+        pimpl->debug_lines.clear();
+        pimpl->commands.clear();
+        for (auto& [mesh_id, mesh] : pimpl->line_meshes) {
+            glad_glDeleteVertexArrays(1, &mesh.vao);
+            glad_glDeleteBuffers(1, &mesh.vbo);
+        }
+        pimpl->line_meshes.clear();
+        if (pimpl->debug_vao != 0) {
+            glad_glDeleteVertexArrays(1, &pimpl->debug_vao);
+            pimpl->debug_vao = 0;
+        }
+        if (pimpl->debug_vbo != 0) {
+            glad_glDeleteBuffers(1, &pimpl->debug_vbo);
+            pimpl->debug_vbo = 0;
+            pimpl->debug_capacity = 0;
+        }
+
         if (pimpl->cube_vao != 0) {
             glad_glDeleteVertexArrays(1, &pimpl->cube_vao);
             pimpl->cube_vao = 0;
@@ -511,6 +882,7 @@ namespace Salix {
 
         pimpl->simple_3d_shader.reset();    // Calls destructor, glDeleteProgram
         pimpl->texture_shader.reset();      // Calls destructor, glDeleteProgram
+        pimpl->texture_instanced_shader.reset();
         pimpl->color_shader.reset();        // Calls destructor, glDeleteProgram
 
         // --- Clean up any created framebuffers ---
@@ -522,6 +894,8 @@ namespace Salix {
         }
         
         pimpl->framebuffers.clear();
+        // Every name above is free for reuse now.
+        pimpl->state->invalidate();
 
 
         // Destroy OpenGL context
@@ -546,7 +920,12 @@ namespace Salix {
 
     void OpenGLRenderer::begin_frame() {
         SDL_GL_MakeCurrent(pimpl->sdl_window, pimpl->gl_context);
+        // ImGui and anything else outside the renderer may have changed GL state
+        // since the last frame, so the shadow copy starts from scratch.
+        pimpl->state->invalidate();
         pimpl->set_opengl_initial_state();   // Re-set state in case ImGui or other things changed it.
+        pimpl->stats = RenderStats{};
+        pimpl->state->reset_counters();
         // FIX: Removed glClearColor here, as it's set via set_clear_color or in set_opengl_initial_state
         clear(); // Clear the buffer.
     }
@@ -554,6 +933,7 @@ namespace Salix {
 
 
     void OpenGLRenderer::end_frame() {
+        pimpl->execute_commands();
         // Swaps the front and back buffers to display what's rendered
         SDL_GL_SwapWindow(pimpl->sdl_window);
     }
@@ -631,30 +1011,7 @@ namespace Salix {
                 return;
             }
 
-            // 1. Set up transform matrix (similar to your cube but with scale)
-            glm::mat4 model = glm::translate(glm::mat4(1.0f), center);
-            model = glm::scale(model, glm::vec3(radius));
-
-            // 2. Enable depth test (like your cube)
-            glad_glEnable(GL_DEPTH_TEST);
-            pimpl->simple_3d_shader->use();
-
-            // 3. Set shader uniforms (same as cube)
-            pimpl->simple_3d_shader->setMat4("model", model);
-            pimpl->simple_3d_shader->setMat4("view", pimpl->active_camera->get_view_matrix());
-            pimpl->simple_3d_shader->setMat4("projection", pimpl->active_camera->get_projection_matrix());
-            pimpl->simple_3d_shader->setVec4("tint_color", 
-                glm::vec4(color.r, color.g, color.b, color.a));
-
-            
-            // 4. Draw the sphere
-            glad_glBindVertexArray(pimpl->sphere_vao);
-            glad_glDrawElements(GL_TRIANGLES, 
-                            pimpl->sphere_index_count, 
-                            GL_UNSIGNED_INT, 
-                            nullptr);
-            glad_glBindVertexArray(0);
-            glad_glUseProgram(0);
+            pimpl->draw_sphere_mesh(center, radius, color);
         }
 
     
@@ -667,243 +1024,8 @@ namespace Salix {
 
 
 
-    void OpenGLRenderer::draw_cube(const glm::mat4& model_matrix, const Color& color) {
-        // --- ADD THESE DEBUG PRINTS ---
-        GLint test_binding = -1; // Initialize to an invalid value
-        glad_glGetIntegerv(GL_FRAMEBUFFER_BINDING, &test_binding); // <-- Test the problematic call here
-        // std::cout << "DEBUG: OpenGLRenderer::draw_cube() - GL_FRAMEBUFFER_BINDING: " << test_binding << std::endl;
-        // --- END DEBUG 
-        if (!pimpl->active_camera) {
-            std::cerr << "WARNING: Attempted to draw_cube with no active camera set." << std::endl;
-            return;
-        }
-
-        if (!pimpl->simple_3d_shader) {
-            std::cerr << "[FATAL] simple_3d_shader is null in draw_cube()\n";
-            return;
-        }
-        // Explicitly enable depth testing right before drawing a 3D object.
-        glad_glEnable(GL_DEPTH_TEST);
-        pimpl->simple_3d_shader->use();
-
-
-        // Pass the matrices to the shader.
-        pimpl->simple_3d_shader->setMat4("model", model_matrix);
-        pimpl->simple_3d_shader->setMat4("view", pimpl->active_camera->get_view_matrix());
-        pimpl->simple_3d_shader->setMat4("projection", pimpl->active_camera->get_projection_matrix());
-
-        // Create the glm::vec4 directly from your Color's float members. No division needed.
-        glm::vec4 tint = { color.r, color.g, color.b, color.a };
-        pimpl->simple_3d_shader->setVec4("tint_color", tint);
-
-        if (pimpl->cube_vao == 0) {
-            std::cerr << "[ERROR] cube_vao is zero (not initialized).\n";
-            return;
-        }
-        glad_glBindVertexArray(pimpl->cube_vao);
-        glad_glDrawArrays(GL_TRIANGLES, 0, 36);      // 36 vertices for a cube made of triangles.
-        glad_glBindVertexArray(0);
-        glad_glUseProgram(0);
-    }
-
-
-    void OpenGLRenderer::draw_cube(uint32_t framebuffer_id_magenta, uint32_t framebuffer_id_blue, float current_time) {
-
-        // 0. Initial checks
-        if (!pimpl->active_camera) {
-            std::cerr << "WARNING: draw_cube(fbo_ids) - No active camera set." << std::endl;
-            return;
-        }
-        if (!pimpl->simple_3d_shader) {
-            std::cerr << "[FATAL] draw_cube(fbo_ids) - simple_3d_shader is null.\n";
-            return;
-        }
-
-        // 1. Save the currently bound framebuffer
-        GLint last_bound_fbo = 0;
-        glad_glGetIntegerv(GL_FRAMEBUFFER_BINDING, &last_bound_fbo); // This should NOT crash here
-
-        // 2. Define colors for the two cubes
-        Color magenta_color = {1.0f, 0.0f, 1.0f, 1.0f};
-        Color blue_color = {0.0f, 0.0f, 1.0f, 1.0f};
-
-        // 3. Define dimensions for framebuffers (assuming they were created with consistent sizes)
-        // You'll need to know the dimensions of your FBOs. For simplicity, let's use a fixed size for this test.
-        // In a real scenario, you'd retrieve them from your 'framebuffers' map.
-        // For now, let's assume a standard size or get it from your Framebuffer struct (if you expand it).
-        // For this test, let's just hardcode a common size like 800x600 for rendering to them.
-        // You should use the actual dimensions of the created FBOs if you have them.
-        int fbo_width = 800; // Replace with actual FBO width
-        int fbo_height = 600; // Replace with actual FBO height
-        // Better: Retrieve from your pimpl->framebuffers map:
-        // auto it_magenta = pimpl->framebuffers.find(framebuffer_id_magenta);
-        // if (it_magenta != pimpl->framebuffers.end()) { fbo_width = it_magenta->second.width; ... }
-        // (You'd need to add width/height to your Framebuffer struct if not already there)
-
-        // 4. Alternate rendering between framebuffers based on time
-        uint32_t target_fbo_id = (static_cast<int>(current_time * 2.0f) % 2 == 0) ? framebuffer_id_magenta : framebuffer_id_blue;
-        Color target_color = (target_fbo_id == framebuffer_id_magenta) ? magenta_color : blue_color;
-
-        // 5. Bind target framebuffer
-        bind_framebuffer(target_fbo_id); // This will bind the FBO and update glViewport internally.
-                                        // Ensure bind_framebuffer also sets the correct viewport for the FBO.
-                                        // (Your current bind_framebuffer doesn't take dimensions,
-                                        // so it might rely on global state or the FBO's internal dimensions).
-                                        // If your FBOs have fixed internal sizes, your current glViewport in RealmDesignerPanel's crashing method is correct:
-                                        // glViewport(0, 0, fbo_width, fbo_height); // Make sure to use actual FBO size here.
-        
-        // For this test, let's directly set viewport based on assumed sizes if bind_framebuffer doesn't.
-        glad_glViewport(0, 0, fbo_width, fbo_height); // Set viewport for the FBO content.
-
-        // 6. Clear the target framebuffer
-        clear(); // This will clear the currently bound FBO (target_fbo_id)
-
-        // 7. Render the cube to the target framebuffer
-        glad_glEnable(GL_DEPTH_TEST);
-        pimpl->simple_3d_shader->use();
-        pimpl->simple_3d_shader->setMat4("model", glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -5.0f)));
-        pimpl->simple_3d_shader->setMat4("view", pimpl->active_camera->get_view_matrix());
-        pimpl->simple_3d_shader->setMat4("projection", pimpl->active_camera->get_projection_matrix());
-        pimpl->simple_3d_shader->setVec4("tint_color", glm::vec4(target_color.r, target_color.g, target_color.b, target_color.a));
-        glad_glBindVertexArray(pimpl->cube_vao);
-        glad_glDrawArrays(GL_TRIANGLES, 0, 36);
-        glad_glBindVertexArray(0);
-        glad_glUseProgram(0);
-
-        // 8. Restore the previous framebuffer binding
-        glad_glBindFramebuffer(GL_FRAMEBUFFER, last_bound_fbo); // Restore original FBO (usually 0)
-
-    }
-
-
-
-
-
-
-
-    // IRenderer Interface methods (getters)
-    IWindow* OpenGLRenderer::get_window() { return pimpl->window.get(); }
-
-    void* OpenGLRenderer::get_native_handle() {
-        // The "native handle" for this renderer is its GL context
-        return pimpl->gl_context;
-    }
-
-    SDL_GLContext OpenGLRenderer::get_sdl_gl_context() const {
-        return pimpl->gl_context;
-    }
-    SDL_Window* OpenGLRenderer::get_sdl_window() const {
-        return pimpl->sdl_window;
-    }
-
-    GLint OpenGLRenderer::get_gl_framebuffer_binding_internal() const {
-        GLint binding = 0;
-        glad_glGetIntegerv(GL_FRAMEBUFFER_BINDING, &binding); // Direct GLAD call
-        return binding;
-    }
-
-    void OpenGLRenderer::set_gl_viewport_internal(int x, int y, int width, int height) {
-        glad_glViewport(x, y, static_cast<GLsizei>(width), static_cast<GLsizei>(height)); // Direct GLAD call
-    }
-
-
-    // --- Texture Management ---
-
-    ITexture* OpenGLRenderer::load_texture(const char* file_path) {
-        int width, height, channels;
-        // (In OpenGL (0,0) is bottom-left, images often top-left)
-        // stbi_set_flip_vertically_on_load(true); // FIX: Moved to initialize()
-
-        unsigned char* data = stbi_load(file_path, &width, &height, &channels, 0);
-
-        if (!data) {
-            std::cerr << "ERROR: Failed to load texture: " << file_path << " - " << stbi_failure_reason() << std::endl;
-            return nullptr;
-        }
-
-        GLuint texture_id;
-        glad_glGenTextures(1, &texture_id);
-        // While glGenTextures creates the ID, using glBindTexture here is still necessary
-        // for glTextureStorage2D and glTextureSubImage2D in some older GL versions (pre-4.5)
-        // or if not using the full DSA path for setup. However, for 4.5, direct access is preferred.
-        // The glTextureStorage2D and glTextureSubImage2D functions below are DSA.
-        glad_glBindTexture(GL_TEXTURE_2D, texture_id); 
-        
-        // These are not DSA texture parameter setting, but valid.
-        // For DSA equivalents: glTextureParameteri(texture_id, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glad_glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE); 
-        glad_glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE); 
-        glad_glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-        glad_glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR); 
-
-        GLenum format = GL_RGB;
-        GLenum internal_format = GL_RGB8;   // Specify internal format for GPU storage
-
-        if (channels == 4) {
-            format = GL_RGBA;
-            internal_format = GL_RGBA8;
-        } else if (channels == 3) {
-            format = GL_RGB;
-            internal_format = GL_RGB8;
-        } else {
-            std::cerr << "WARNING: Unsupported number of channels (" << channels << ") for texture: " <<
-            file_path << std::endl;
-
-            stbi_image_free(data);
-            glad_glDeleteTextures(1, &texture_id);
-            return nullptr;
-        }
-
-        glad_glPixelStorei(GL_UNPACK_ALIGNMENT, 1);   // <--- TEST CODE
-        // Use glTextureStorage2D for immutable storage (OpenGL 4.5 feature)
-        // This allocates the memory once, making it more efficient.
-        glad_glTextureStorage2D(texture_id, 1, internal_format, width, height);   // Mip levels = 1 for now.
-
-        // Then, upload data to the base mip level.
-        glad_glTextureSubImage2D(texture_id, 0, 0, 0, width, height, format, GL_UNSIGNED_BYTE, data);
-
-        // Generate mipmaps for the immutable texture.
-        glad_glGenerateTextureMipmap(texture_id);
-
-        stbi_image_free(data);
-        glad_glBindTexture(GL_TEXTURE_2D, 0);    // Unbind texture.
-        
-        std::cout << "DEBUG: Loaded texture " << file_path << " (ID: " << texture_id <<
-        ", " << width << "x" << height << ")" << std::endl;
-        
-        return new OpenGLTexture(texture_id, width, height);
-    }
-    
-
-
-
-    void OpenGLRenderer::purge_texture(ITexture* texture) {
-        if (texture) {
-        // The OpenGLTexture destructor automatically calls glDeleteTextures
-            delete texture;
-        }
-    }
-
-    void OpenGLRenderer::draw_texture(ITexture* texture, const Rect& dest_rect) {
-        // Create a temporary Transform on the fly from the Rect
-        Transform temp_transform;
-        temp_transform.set_position({(float)dest_rect.x, (float)dest_rect.y, 0.0f});
-        temp_transform.set_scale({(float)dest_rect.w, (float)dest_rect.h, 1.0f});
-        
-        // Define a default white color
-        Color white = { 1.0f, 1.0f, 1.0f, 1.0f };
-
-        // Call the new draw_sprite function with the temporary transform
-        draw_sprite(texture, &temp_transform, white, SpriteFlip::None);
-    }
-    
-    void OpenGLRenderer::set_pixels_per_unit(float ppu) {
-        pimpl->pixels_per_unit = ppu;
-    }
-    
-    
-    float OpenGLRenderer::get_pixels_per_unit() const {
-        return pimpl->pixels_per_unit ;
+    float OpenGLRenderer::get_interpolation_alpha() const {
+        return pimpl->interpolation_alpha;
     }
 
 
@@ -911,92 +1033,108 @@ namespace Salix {
     void OpenGLRenderer::draw_sprite(ITexture* texture, const Transform* transform,
                                  const Color& color, SpriteFlip flip) {
         if (!texture || !transform) return;
-        OpenGLTexture* opengl_texture = dynamic_cast<OpenGLTexture*>(texture);
+        // Atlas regions bind their page and sample a sub-rect of it.
+        OpenGLTexture* opengl_texture = dynamic_cast<OpenGLTexture*>(texture->get_base_texture());
         if (!opengl_texture) return;
 
         // --- State setup for transparency ---
-        glad_glDepthMask(GL_FALSE);
-        pimpl->texture_shader->use();
+        pimpl->state->set_blend(true);
+        pimpl->state->set_depth_mask(false);
+        pimpl->state->set_polygon_mode(GL_FILL);
+        pimpl->state->use_program(pimpl->texture_shader->ID);
 
         // 1. Get the 3D camera matrices
         if (!pimpl->active_camera) {
             std::cerr << "WARNING: draw_sprite called with no active 3D camera." << std::endl;
             return;
         }
-        pimpl->texture_shader->setMat4("view", pimpl->active_camera->get_view_matrix());
-        pimpl->texture_shader->setMat4("projection", pimpl->active_camera->get_projection_matrix());
-        
-        // 2. Build the LOCAL Model Matrix for the sprite
-        glm::mat4 local_model = glm::mat4(1.0f);
-        local_model = glm::translate(local_model, transform->get_position().to_glm());
-        local_model = glm::rotate(local_model, glm::radians(transform->get_rotation().z), glm::vec3(0.0f, 0.0f, 1.0f));
-        
-        const float PIXELS_PER_UNIT = pimpl->pixels_per_unit;
-        float world_width = (float)texture->get_width() / PIXELS_PER_UNIT;
-        float world_height = (float)texture->get_height() / PIXELS_PER_UNIT;
-
-        float scale_x = world_width * transform->get_scale().x;
-        float scale_y = world_height * transform->get_scale().y;
-        
-        if (flip == SpriteFlip::Horizontal || flip == SpriteFlip::Both) {
-            scale_x *= -1.0f;
-        }
-        if (flip == SpriteFlip::Vertical || flip == SpriteFlip::Both) {
-            scale_y *= -1.0f;
-        }
+        pimpl->sync_camera_block();
         
-        local_model = glm::scale(local_model, glm::vec3(scale_x, scale_y, 1.0f));
+        // 2. Build the sprite's world matrix (texture size, flip and parent included)
+        const glm::mat4 final_world_model = pimpl->build_sprite_model_matrix(texture, transform, flip);
 
-        
-        // 3. Get the final world matrix by applying the parent's transform
-        glm::mat4 final_world_model = local_model;
-        const Transform* parent = transform->get_parent();
-        if (parent) {
-            // If there is a parent, multiply our local matrix by the parent's full world matrix
-            final_world_model = parent->get_model_matrix() * local_model;
-        }
+        pimpl->texture_shader->setMat4(UNIFORM_MODEL, final_world_model);
 
-        pimpl->texture_shader->setMat4("model", final_world_model);
-
-        // 4. Set color, bind texture, and draw
-        pimpl->texture_shader->setVec4("tint_color", glm::vec4(color.r, color.g, color.b, color.a));
-        glad_glActiveTexture(GL_TEXTURE0);
-        glad_glBindTexture(GL_TEXTURE_2D, opengl_texture->get_id());
-        glad_glBindVertexArray(pimpl->quad_vao);
+        // 3. Set color, bind texture, and draw
+        pimpl->texture_shader->setVec4(UNIFORM_TINT_COLOR, glm::vec4(color.r, color.g, color.b, color.a));
+        pimpl->texture_shader->setVec4(UNIFORM_UV_RECT, texture->get_uv_rect());
+        pimpl->state->bind_texture(0, opengl_texture->get_id());
+        pimpl->state->bind_vertex_array(pimpl->quad_vao);
         glad_glDrawArrays(GL_TRIANGLES, 0, 6);
-        glad_glBindVertexArray(0);
-        glad_glDepthMask(GL_TRUE);
+        ++pimpl->stats.shader_binds;
+        ++pimpl->stats.texture_binds;
+        ++pimpl->stats.draw_calls;
+        ++pimpl->stats.sprites;
     }
      
     void OpenGLRenderer::draw_sprite(ITexture* texture, const glm::mat4& model_matrix, const Color& color) {
     if (!texture) return;
-    OpenGLTexture* opengl_texture = dynamic_cast<OpenGLTexture*>(texture);
+    OpenGLTexture* opengl_texture = dynamic_cast<OpenGLTexture*>(texture->get_base_texture());
     if (!opengl_texture || !pimpl->active_camera) return;
 
     // Set OpenGL state for 2D rendering (transparency, no depth writing)
-    glad_glEnable(GL_BLEND);
-    glad_glDepthMask(GL_FALSE); 
+    pimpl->state->set_blend(true);
+    pimpl->state->set_depth_mask(false);
+    pimpl->state->set_polygon_mode(GL_FILL);
 
-    pimpl->texture_shader->use();
+    pimpl->state->use_program(pimpl->texture_shader->ID);
 
     // Set camera matrices and the final model matrix for the sprite
-    pimpl->texture_shader->setMat4("view", pimpl->active_camera->get_view_matrix());
-    pimpl->texture_shader->setMat4("projection", pimpl->active_camera->get_projection_matrix());
-    pimpl->texture_shader->setMat4("model", model_matrix);
-    pimpl->texture_shader->setVec4("tint_color", glm::vec4(color.r, color.g, color.b, color.a));
+    pimpl->sync_camera_block();
+    pimpl->texture_shader->setMat4(UNIFORM_MODEL, model_matrix);
+    pimpl->texture_shader->setVec4(UNIFORM_TINT_COLOR, glm::vec4(color.r, color.g, color.b, color.a));
+    pimpl->texture_shader->setVec4(UNIFORM_UV_RECT, texture->get_uv_rect());
 
     // Bind texture and draw the quad
-    glad_glActiveTexture(GL_TEXTURE0);
-    glad_glBindTexture(GL_TEXTURE_2D, opengl_texture->get_id());
-    glad_glBindVertexArray(pimpl->quad_vao);
+    pimpl->state->bind_texture(0, opengl_texture->get_id());
+    pimpl->state->bind_vertex_array(pimpl->quad_vao);
     glad_glDrawArrays(GL_TRIANGLES, 0, 6);
-
-    // Clean up and restore OpenGL state
-    glad_glBindVertexArray(0);
-    glad_glDepthMask(GL_TRUE);
-    glad_glDisable(GL_BLEND);
-    glad_glUseProgram(0);
+    ++pimpl->stats.shader_binds;
+    ++pimpl->stats.texture_binds;
+    ++pimpl->stats.draw_calls;
+    ++pimpl->stats.sprites;
 }
+
+
+    void OpenGLRenderer::begin_sprite_batch() {
+        pimpl->sprite_batch_open = true;
+    }
+
+    void OpenGLRenderer::end_sprite_batch() {
+        if (!pimpl->sprite_batch_open) return;
+        pimpl->sprite_batch_open = false;
+        pimpl->execute_commands();
+    }
+
+    void OpenGLRenderer::submit_sprite(ITexture* texture, const Transform* transform,
+                                       const Color& color, SpriteFlip flip, int sorting_layer) {
+        if (!pimpl->sprite_batch_open) {
+            draw_sprite(texture, transform, color, flip);
+            return;
+        }
+        if (!texture || !transform) return;
+        pimpl->commands.add_sprite(texture, pimpl->build_sprite_model_matrix(texture, transform, flip), color, sorting_layer);
+    }
+
+    void OpenGLRenderer::submit_sprite(ITexture* texture, const glm::mat4& model_matrix,
+                                       const Color& color, int sorting_layer) {
+        if (!pimpl->sprite_batch_open) {
+            draw_sprite(texture, model_matrix, color);
+            return;
+        }
+        pimpl->commands.add_sprite(texture, model_matrix, color, sorting_layer);
+    }
+
+    void OpenGLRenderer::submit_commands(const RenderCommandList& commands) {
+        pimpl->commands.append(commands);
+    }
+
+    RenderStats OpenGLRenderer::get_render_stats() const {
+        RenderStats stats = pimpl->stats;
+        stats.state_changes = pimpl->state->get_issued_count();
+        stats.state_changes_skipped = pimpl->state->get_skipped_count();
+        return stats;
+    }
        
 
 
@@ -1005,73 +1143,86 @@ namespace Salix {
 
         if (!pimpl->active_camera) return;
         // Use the same 3D shader as the solid cube
-        pimpl->simple_3d_shader->use();
-        pimpl->simple_3d_shader->setMat4("model", model_matrix);
-        pimpl->simple_3d_shader->setMat4("view", pimpl->active_camera->get_view_matrix());
-        pimpl->simple_3d_shader->setMat4("projection", pimpl->active_camera->get_projection_matrix());
-        pimpl->simple_3d_shader->setVec4("tint_color", { color.r, color.g, color.b, color.a });
-        glad_glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-
-        glad_glBindVertexArray(pimpl->cube_vao);
+        pimpl->state->set_depth_mask(true);
+        pimpl->state->use_program(pimpl->simple_3d_shader->ID);
+        pimpl->simple_3d_shader->setMat4(UNIFORM_MODEL, model_matrix);
+        pimpl->sync_camera_block();
+        pimpl->simple_3d_shader->setVec4(UNIFORM_TINT_COLOR, { color.r, color.g, color.b, color.a });
+        // Solid draws set GL_FILL themselves, so the line mode is not undone here.
+        pimpl->state->set_polygon_mode(GL_LINE);
+
+        pimpl->state->bind_vertex_array(pimpl->cube_vao);
         glad_glDrawArrays(GL_TRIANGLES, 0, 36);
-        glad_glBindVertexArray(0);
-
-        glad_glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-        glad_glUseProgram(0);
     }
     
 
 
     void OpenGLRenderer::draw_line(const glm::vec3& start, const glm::vec3& end, const Color& color) {
-        // 1. Initial safety check
         if (!pimpl->active_camera) {
             std::cerr << "WARNING: draw_line called with no active camera set." << std::endl;
             return;
         }
+        // Immediate: executed together with anything already recorded, so
+        // earlier debug shapes keep their order.
+        pimpl->commands.add_line(start, end, color);
+        pimpl->execute_commands();
+    }
 
-        // 2. Use the 3D shader that understands view and projection matrices
-        pimpl->simple_3d_shader->use();
 
-        // 3. Set the camera matrices
-        pimpl->simple_3d_shader->setMat4("view", pimpl->active_camera->get_view_matrix());
-        pimpl->simple_3d_shader->setMat4("projection", pimpl->active_camera->get_projection_matrix());
-        
-        // 4. The line's vertices are already in world space, so the model matrix is the identity
-        pimpl->simple_3d_shader->setMat4("model", glm::mat4(1.0f));
-        
-        // 5. Set the line color
-        pimpl->simple_3d_shader->setVec4("tint_color", { color.r, color.g, color.b, color.a });
+    void OpenGLRenderer::debug_line(const glm::vec3& start, const glm::vec3& end, const Color& color) {
+        pimpl->commands.add_line(start, end, color);
+    }
 
-        // --- 6. Create geometry on the fly ---
-        GLuint line_vao, line_vbo;
-        float vertices[] = {
-            start.x, start.y, start.z,
-            end.x,   end.y,   end.z
-        };
+    void OpenGLRenderer::debug_wire_box(const glm::mat4& model_matrix, const Color& color) {
+        pimpl->commands.add_wire_box(model_matrix, color);
+    }
 
-        // Create and bind the Vertex Array Object and Vertex Buffer Object
-        glad_glGenVertexArrays(1, &line_vao);
-        glad_glGenBuffers(1, &line_vbo);
+    void OpenGLRenderer::debug_wire_sphere(const glm::vec3& center, float radius, const Color& color, int segments) {
+        pimpl->commands.add_wire_sphere(center, radius, color, segments);
+    }
 
-        glad_glBindVertexArray(line_vao);
-        glad_glBindBuffer(GL_ARRAY_BUFFER, line_vbo);
-        
-        // Upload the vertex data to the VBO
-        glad_glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-        // Set up the vertex attribute pointer (we only have position for this)
-        // Location 0, 3 components (x,y,z), float type, not normalized, stride is 3 floats, offset is 0
-        glad_glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-        glad_glEnableVertexAttribArray(0);
-
-        // --- 7. Draw the line ---
-        glad_glDrawArrays(GL_LINES, 0, 2);
-
-        // --- 8. Clean up temporary objects ---
-        glad_glBindVertexArray(0);
-        glad_glDeleteVertexArrays(1, &line_vao);
-        glad_glDeleteBuffers(1, &line_vbo);
-        glad_glUseProgram(0);
+    void OpenGLRenderer::flush_debug_draw() {
+        pimpl->execute_commands();
+    }
+
+
+    uint32_t OpenGLRenderer::create_line_mesh(const DebugDrawList& lines) {
+        if (lines.empty()) return 0;
+        const auto& vertices = lines.get_vertices();
+
+        Pimpl::LineMesh mesh;
+        glad_glCreateVertexArrays(1, &mesh.vao);
+        glad_glCreateBuffers(1, &mesh.vbo);
+        // Immutable storage: the mesh is replaced, never edited.
+        glad_glNamedBufferStorage(mesh.vbo, vertices.size() * sizeof(DebugVertex), vertices.data(), 0);
+        pimpl->configure_debug_vertex_array(mesh.vao, mesh.vbo);
+        mesh.vertex_count = static_cast<GLsizei>(vertices.size());
+
+        const uint32_t mesh_id = pimpl->next_line_mesh_id++;
+        pimpl->line_meshes[mesh_id] = mesh;
+        return mesh_id;
+    }
+
+    void OpenGLRenderer::draw_line_mesh(uint32_t mesh_id) {
+        auto found = pimpl->line_meshes.find(mesh_id);
+        if (found == pimpl->line_meshes.end() || !pimpl->active_camera || !pimpl->debug_line_shader) return;
+
+        pimpl->state->set_depth_mask(true);
+        pimpl->state->use_program(pimpl->debug_line_shader->ID);
+        pimpl->sync_camera_block();
+        pimpl->state->bind_vertex_array(found->second.vao);
+        glad_glDrawArrays(GL_LINES, 0, found->second.vertex_count);
+        ++pimpl->stats.shader_binds;
+        ++pimpl->stats.draw_calls;
+    }
+
+    void OpenGLRenderer::delete_line_mesh(uint32_t mesh_id) {
+        auto found = pimpl->line_meshes.find(mesh_id);
+        if (found == pimpl->line_meshes.end()) return;
+        pimpl->state->forget_vertex_array(found->second.vao);
+        glad_glDeleteVertexArrays(1, &found->second.vao);
+        glad_glDeleteBuffers(1, &found->second.vbo);
+        pimpl->line_meshes.erase(found);
     }
 
 
@@ -1097,18 +1248,19 @@ namespace Salix {
     void OpenGLRenderer::draw_rectangle(const Rect& rect, const Color& color, bool filled) {
         // For drawing a filled rectangle, we can use the same quad geometry
         // and apply a color-only shader.
-        pimpl->color_shader->use();
+        pimpl->state->set_polygon_mode(GL_FILL);
+        pimpl->state->use_program(pimpl->color_shader->ID);
 
-        pimpl->color_shader->setMat4("projection", pimpl->projection_matrix_2d);
+        pimpl->color_shader->setMat4(UNIFORM_PROJECTION, pimpl->projection_matrix_2d);
 
         glm::mat4 model = glm::mat4(1.0f);
         model = glm::translate(model, glm::vec3(rect.x, rect.y, 0.0f));
         model = glm::scale(model, glm::vec3(rect.w, rect.h, 1.0f));
-        pimpl->color_shader->setMat4("model", model);
+        pimpl->color_shader->setMat4(UNIFORM_MODEL, model);
             
-        pimpl->color_shader->setVec4("object_color", glm::vec4(color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f));
+        pimpl->color_shader->setVec4(UNIFORM_OBJECT_COLOR, glm::vec4(color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f));
 
-        glad_glBindVertexArray(pimpl->quad_vao);
+        pimpl->state->bind_vertex_array(pimpl->quad_vao);
         if (filled) {
             glDrawArrays(GL_TRIANGLES, 0, 6); // Draw 2 triangles for a filled quad
         } else {
@@ -1119,9 +1271,6 @@ namespace Salix {
             // glPolygonMode(GL_FRONT_AND_BACK, GL_FILL); // Switch back
         std::cerr << "WARNING: OpenGLRenderer::draw_rectangle - unfilled mode not fully implemented." << std::endl;
         }
-
-        glad_glBindVertexArray(0);
-        glad_glUseProgram(0);
     }
 
 
@@ -1132,11 +1281,12 @@ namespace Salix {
 
         // 1. Generate a Framebuffer Object (FBO)
         glad_glGenFramebuffers(1, &fb.fbo_id);
-        glad_glBindFramebuffer(GL_FRAMEBUFFER, fb.fbo_id);
+        const GLuint previous_fbo = pimpl->state->get_framebuffer();
+        pimpl->state->bind_framebuffer(fb.fbo_id);
 
         // 2. Create a color texture attachment
         glad_glGenTextures(1, &fb.texture_id);
-        glad_glBindTexture(GL_TEXTURE_2D, fb.texture_id);
+        pimpl->state->bind_texture(0, fb.texture_id);
         glad_glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, NULL);
         glad_glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
         glad_glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -1154,15 +1304,17 @@ namespace Salix {
         if (glad_glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
             std::cerr << "ERROR::FRAMEBUFFER:: Framebuffer is not complete!" << std::endl;
             // Clean up on failure
+            pimpl->state->forget_framebuffer(fb.fbo_id);
+            pimpl->state->forget_texture(fb.texture_id);
             glad_glDeleteFramebuffers(1, &fb.fbo_id);
             glad_glDeleteTextures(1, &fb.texture_id);
             glad_glDeleteRenderbuffers(1, &fb.rbo_id);
-            glad_glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            pimpl->state->bind_framebuffer(previous_fbo);
             return 0; // Return 0 to indicate failure
         }
 
         // 5. Unbind the framebuffer to avoid accidentally rendering to it
-        glad_glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        pimpl->state->bind_framebuffer(previous_fbo);
 
         // 6. Store it and return our own ID
         uint32_t our_id = pimpl->next_framebuffer_id++;
@@ -1194,7 +1346,7 @@ namespace Salix {
         if (pimpl->framebuffers.count(framebuffer_id)) {
             GLuint fbo_handle = pimpl->framebuffers.at(framebuffer_id).fbo_id;
             // FIX: Use the glad_ prefix here!
-            glad_glBindFramebuffer(GL_FRAMEBUFFER, fbo_handle);
+            pimpl->state->bind_framebuffer(fbo_handle);
             // OR if you made a private helper (which is even better encapsulation):
             // pimpl->bind_gl_framebuffer_internal(GL_FRAMEBUFFER, fbo_handle);
         }
@@ -1202,13 +1354,14 @@ namespace Salix {
     
     
     void OpenGLRenderer::unbind_framebuffer() {
-        // Use the glad_ prefix here!
-        glad_glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        pimpl->state->bind_framebuffer(0);
     }
 
     void OpenGLRenderer::delete_framebuffer(uint32_t framebuffer_id) {
         if (pimpl->framebuffers.count(framebuffer_id)) {
             const Framebuffer& fb = pimpl->framebuffers.at(framebuffer_id);
+            pimpl->state->forget_texture(fb.texture_id);
+            pimpl->state->forget_framebuffer(fb.fbo_id);
             glad_glDeleteRenderbuffers(1, &fb.rbo_id);
             glad_glDeleteTextures(1, &fb.texture_id);
             glad_glDeleteFramebuffers(1, &fb.fbo_id);
@@ -1218,9 +1371,8 @@ namespace Salix {
     }
 
     GLint OpenGLRenderer::get_current_framebuffer_binding() const {
-        GLint binding = 0;
-        glad_glGetIntegerv(GL_FRAMEBUFFER_BINDING, &binding);
-        return binding;
+        // Answered from the state cache; GL is only asked when it is unknown.
+        return static_cast<GLint>(pimpl->state->get_framebuffer());
     }
 
     void OpenGLRenderer::set_viewport(int x, int y, int width, int height) {
@@ -1228,14 +1380,13 @@ namespace Salix {
     }
 
     void OpenGLRenderer::restore_framebuffer_binding(GLint fbo_id) {
-        glad_glBindFramebuffer(GL_FRAMEBUFFER, fbo_id); 
+        pimpl->state->bind_framebuffer(static_cast<GLuint>(fbo_id));
     }
 
     void OpenGLRenderer::begin_render_pass(uint32_t framebuffer_id) {
 
         // 1. Get and save the current FBO binding by pushing it onto the stack.
-        GLint last_bound_fbo = 0;
-        glad_glGetIntegerv(GL_FRAMEBUFFER_BINDING, &last_bound_fbo);
+        const GLint last_bound_fbo = static_cast<GLint>(pimpl->state->get_framebuffer());
         pimpl->framebuffer_stack.push(last_bound_fbo);
 
         // 2. Bind the new framebuffer that the caller requested.
@@ -1245,6 +1396,8 @@ namespace Salix {
     }
         
     void OpenGLRenderer::end_render_pass() {
+        // Recorded draws belong to the pass's framebuffer; draw them before leaving it.
+        pimpl->execute_commands();
         // 1. Check if the stack is empty to avoid errors.
     if (!pimpl->framebuffer_stack.empty()) {
         // 2. Get the last FBO binding from the top of the stack.
@@ -1252,7 +1405,7 @@ namespace Salix {
         pimpl->framebuffer_stack.pop();
 
         // 3. Restore the previous framebuffer binding.
-        glad_glBindFramebuffer(GL_FRAMEBUFFER, last_fbo);
+        pimpl->state->bind_framebuffer(static_cast<GLuint>(last_fbo));
     }
 
     }
@@ -59,15 +59,25 @@ namespace Salix {
 
         void purge_texture(ITexture* texture);
         ITexture* load_texture(const char* file_path) override;
+        ITexture* create_texture(const unsigned char* pixels, int width, int height, int channels) override;
+        ITexture* create_texture_with_mips(const unsigned char* const* mip_levels, int mip_count, int width, int height) override;
         void draw_texture(ITexture* texture, const Rect& dest_rect) override;
         void draw_sprite(ITexture* texture, const Transform* transform, const Color& color, SpriteFlip flip) override;
         virtual void draw_sprite(ITexture* texture, const glm::mat4& model_matrix, const Color& color) override;
+        void begin_sprite_batch() override;
+        void end_sprite_batch() override;
+        void submit_sprite(ITexture* texture, const Transform* transform, const Color& color, SpriteFlip flip, int sorting_layer) override;
+        void submit_sprite(ITexture* texture, const glm::mat4& model_matrix, const Color& color, int sorting_layer) override;
+        void submit_commands(const RenderCommandList& commands) override;
+        RenderStats get_render_stats() const override;
         void set_clear_color(const Color& color);
         Color get_clear_color() const override;
         void draw_rectangle(const Rect& rect, const Color& color, bool filled);
         void on_window_resize(int width, int height) override;
         void set_pixels_per_unit(float ppu) override;
         float get_pixels_per_unit() const override;
+        void set_interpolation_alpha(float alpha) override;
+        float get_interpolation_alpha() const override;
         // --- 3D-SPECIFIC METHODS ---
 
         // Sets the active camera that the renderer will use to get view/projection matrices.
@@ -89,6 +99,14 @@ namespace Salix {
             const Color& color,
             int segments = 16
             ) override;
+
+        void debug_line(const glm::vec3& start, const glm::vec3& end, const Color& color) override;
+        void debug_wire_box(const glm::mat4& model_matrix, const Color& color) override;
+        void debug_wire_sphere(const glm::vec3& center, float radius, const Color& color, int segments = 16) override;
+        void flush_debug_draw() override;
+        uint32_t create_line_mesh(const DebugDrawList& lines) override;
+        void draw_line_mesh(uint32_t mesh_id) override;
+        void delete_line_mesh(uint32_t mesh_id) override;
         
     private:
         struct Pimpl;
@@ -11,16 +11,96 @@
 #include <iostream>             // Needed here for std::cerr
 #include <sstream>
 #include <fstream>
+#include <algorithm>
 #include <memory>               // Needed here for std::make_unique
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 namespace Salix {
+
+    namespace {
+        // The process-wide name -> UniformId table.
+        struct UniformNameTable {
+            std::mutex mutex;
+            std::unordered_map<std::string, OpenGLShaderProgram::UniformId> ids;
+            std::vector<std::string> names;
+        };
+
+        UniformNameTable& get_uniform_name_table() {
+            static UniformNameTable table;
+            return table;
+        }
+
+        // By value: another thread may grow 'names' once the lock is released.
+        std::string get_uniform_name(OpenGLShaderProgram::UniformId id) {
+            UniformNameTable& table = get_uniform_name_table();
+            std::lock_guard<std::mutex> lock(table.mutex);
+            return table.names[id];
+        }
+    }
     
     // Pimpl struct definition
     struct OpenGLShaderProgram::Pimpl {
         // Utility function for checking shader compilation/linking errors.
         void checkCompileErrors(GLuint shader, const std::string& type); // Note: GLuint, not GLuint&
         std::string read_file(const std::string& file_path);
+        // Fills 'locations' from the program's active uniforms.
+        void cache_uniform_locations(GLuint program);
+
+        // Indexed by UniformId. Ids past the end, or still NOT_ACTIVE, are not
+        // uniforms of this program.
+        static constexpr GLint NOT_ACTIVE = -1;
+        std::vector<GLint> locations;
+        // So a missing uniform is reported once rather than every frame.
+        mutable std::vector<bool> warned;
     };
 
+
+    OpenGLShaderProgram::UniformId OpenGLShaderProgram::uniform_id(const std::string& name) {
+        UniformNameTable& table = get_uniform_name_table();
+        std::lock_guard<std::mutex> lock(table.mutex);
+        auto found = table.ids.find(name);
+        if (found != table.ids.end()) {
+            return found->second;
+        }
+        const UniformId id = static_cast<UniformId>(table.names.size());
+        table.names.push_back(name);
+        table.ids.emplace(name, id);
+        return id;
+    }
+
+
+    void OpenGLShaderProgram::Pimpl::cache_uniform_locations(GLuint program) {
+        GLint uniform_count = 0;
+        glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &uniform_count);
+        GLint max_name_length = 0;
+        glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_name_length);
+        std::vector<char> name_buffer(static_cast<size_t>(std::max(max_name_length, 1)));
+
+        for (GLint i = 0; i < uniform_count; ++i) {
+            GLsizei length = 0;
+            GLint size = 0;
+            GLenum type = 0;
+            glGetActiveUniform(program, static_cast<GLuint>(i), static_cast<GLsizei>(name_buffer.size()),
+                &length, &size, &type, name_buffer.data());
+            std::string name(name_buffer.data(), static_cast<size_t>(length));
+            // Members of uniform blocks have no location; they are set through the buffer.
+            const GLint location = glGetUniformLocation(program, name.c_str());
+            if (location < 0) continue;
+            // Arrays are reported as "name[0]"; callers use the bare name.
+            const size_t bracket = name.find('[');
+            if (bracket != std::string::npos) {
+                name.erase(bracket);
+            }
+            const UniformId id = uniform_id(name);
+            if (id >= locations.size()) {
+                locations.resize(id + 1, NOT_ACTIVE);
+            }
+            locations[id] = location;
+        }
+        warned.assign(locations.size(), false);
+    }
+
     std::string OpenGLShaderProgram::Pimpl::read_file(const std::string& filePath) {
         std::ifstream fileStream(filePath, std::ios::in);
         if (!fileStream.is_open()) {
@@ -93,6 +173,7 @@ namespace Salix {
         glAttachShader(ID, fragment);
         glLinkProgram(ID);
         pimpl->checkCompileErrors(ID, "PROGRAM"); // Use pimpl instance
+        pimpl->cache_uniform_locations(ID);
 
         
         // Delete the shaders as they're linked into our program now and no longer necessary
@@ -114,39 +195,52 @@ namespace Salix {
         glUseProgram(ID);
     }
 
-    // --- NEW: Robust Uniform Setters with Error Checking ---
+    // --- Uniform Setters (cached locations) ---
 
-    void OpenGLShaderProgram::setMat4(const std::string& name, const glm::mat4& mat) const {
-        GLint location = glGetUniformLocation(ID, name.c_str());
-        if (location == -1) {
-            std::cerr << "SHADER WARNING: Uniform '" << name << "' not found in shader program " << ID << std::endl;
+    GLint OpenGLShaderProgram::get_uniform_location(UniformId id) const {
+        if (id < pimpl->locations.size() && pimpl->locations[id] != Pimpl::NOT_ACTIVE) {
+            return pimpl->locations[id];
         }
-        glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(mat));
+        if (id >= pimpl->warned.size()) {
+            pimpl->warned.resize(id + 1, false);
+        }
+        if (!pimpl->warned[id]) {
+            pimpl->warned[id] = true;
+            std::cerr << "SHADER WARNING: Uniform '" << get_uniform_name(id) << "' not found in shader program " << ID << std::endl;
+        }
+        return Pimpl::NOT_ACTIVE;
+    }
+
+    void OpenGLShaderProgram::setMat4(UniformId id, const glm::mat4& mat) const {
+        glUniformMatrix4fv(get_uniform_location(id), 1, GL_FALSE, glm::value_ptr(mat));
+    }
+
+    void OpenGLShaderProgram::setInt(UniformId id, int value) const {
+        glUniform1i(get_uniform_location(id), value);
+    }
+
+    void OpenGLShaderProgram::setVec4(UniformId id, const glm::vec4& value) const {
+        glUniform4fv(get_uniform_location(id), 1, glm::value_ptr(value));
+    }
+
+    void OpenGLShaderProgram::setVec3(UniformId id, const glm::vec3& value) const {
+        glUniform3fv(get_uniform_location(id), 1, glm::value_ptr(value));
+    }
+
+    void OpenGLShaderProgram::setMat4(const std::string& name, const glm::mat4& mat) const {
+        setMat4(uniform_id(name), mat);
     }
 
     void OpenGLShaderProgram::setInt(const std::string& name, int value) const {
-        GLint location = glGetUniformLocation(ID, name.c_str());
-        if (location == -1) {
-            std::cerr << "SHADER WARNING: Uniform '" << name << "' not found in shader program " << ID << std::endl;
-        }
-        glUniform1i(location, value);
+        setInt(uniform_id(name), value);
     }
 
     void OpenGLShaderProgram::setVec4(const std::string& name, const glm::vec4& value) const {
-        GLint location = glGetUniformLocation(ID, name.c_str());
-        if (location == -1) {
-            std::cerr << "SHADER WARNING: Uniform '" << name << "' not found in shader program " << ID << std::endl;
-        }
-        glUniform4fv(location, 1, glm::value_ptr(value));
+        setVec4(uniform_id(name), value);
     }
 
-    // You should also add a robust version for setVec3 if you have one
     void OpenGLShaderProgram::setVec3(const std::string& name, const glm::vec3& value) const {
-        GLint location = glGetUniformLocation(ID, name.c_str());
-        if (location == -1) {
-            std::cerr << "SHADER WARNING: Uniform '" << name << "' not found in shader program " << ID << std::endl;
-        }
-        glUniform3fv(location, 1, glm::value_ptr(value));
+        setVec3(uniform_id(name), value);
     }
     // --- REMOVED GLSL Shader Sources from here ---
     // These should only be defined in OpenGLRenderer.cpp where they are used to create the shader program objects.
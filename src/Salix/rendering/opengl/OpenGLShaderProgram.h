@@ -7,6 +7,7 @@
 #include <Salix/core/Core.h> // For SALIX_API
 #include <glm/glm.hpp>       // For glm::mat4, glm::vec4
 #include <glad/glad.h>       // For GLuint
+#include <cstdint>
 #include <string>
 #include <memory>            // For std::unique_ptr
 
@@ -16,6 +17,12 @@
 namespace Salix {
     class SALIX_API OpenGLShaderProgram {
     public:
+        // Uniform names are interned process-wide into small integers. Each
+        // program resolves the locations of its active uniforms once, at link
+        // time, so setting a uniform by id is an array lookup, not a GL query.
+        using UniformId = uint32_t;
+        static UniformId uniform_id(const std::string& name);
+
         GLuint ID; // The OpenGL program ID 
 
         // Constructor takes pointers to the vertex and fragment shader source code.
@@ -27,12 +34,20 @@ namespace Salix {
         // Activate the shader program for rendering.
         void use() const;
 
-        // Set uniform values.
+        // Set uniform values. Hot paths should pass a UniformId obtained once
+        // from uniform_id(); the string overloads intern the name first.
+        void setMat4(UniformId id, const glm::mat4& mat) const;
+        void setInt(UniformId id, int value) const;
+        void setVec4(UniformId id, const glm::vec4& value) const;
+        void setVec3(UniformId id, const glm::vec3& value) const;
         void setMat4(const std::string& name, const glm::mat4& mat) const;
         void setInt(const std::string& name, int value) const;
         void setVec4(const std::string& name, const glm::vec4& value) const;
         void setVec3(const std::string& name, const glm::vec3& value) const;
 
+        // -1 if the uniform is not active in this program.
+        GLint get_uniform_location(UniformId id) const;
+
     private:
         // Pimpl idiom to hide internal implementation details like checkCompileErrors.
         struct Pimpl;
@@ -1,5 +1,6 @@
 // Salix/rendering/OpenGLTexture.cpp
 #include <Salix/rendering/opengl/OpenGLTexture.h>
+#include <Salix/rendering/opengl/GLStateCache.h>
 #include <iostream> // For debug output
 
 namespace Salix {
@@ -8,14 +9,16 @@ namespace Salix {
         GLuint texture_id;
         int width;
         int height;
+        std::weak_ptr<GLStateCache> state;
     };
     
     
     
-    OpenGLTexture::OpenGLTexture(GLuint texture_id, int width, int height) : pimpl(std::make_unique<Pimpl>()) {
+    OpenGLTexture::OpenGLTexture(GLuint texture_id, int width, int height, std::weak_ptr<GLStateCache> state) : pimpl(std::make_unique<Pimpl>()) {
         pimpl->texture_id = texture_id;
         pimpl->width = width;
         pimpl->height = height;
+        pimpl->state = std::move(state);
         std::cout << "DEBUG: OpenGLTexture created with ID: " << pimpl->texture_id << std::endl;
     }
     
@@ -23,6 +26,10 @@ namespace Salix {
     
     OpenGLTexture::~OpenGLTexture() {
         if (pimpl->texture_id != 0) {
+            // GL reuses the name, so the renderer must not think it is still bound.
+            if (auto state = pimpl->state.lock()) {
+                state->forget_texture(pimpl->texture_id);
+            }
             glDeleteTextures(1, &pimpl->texture_id);
             std::cout << "DEBUG: OpenGLTexture " << pimpl->texture_id << std::endl;
             pimpl->texture_id = 0;  // Mark as deleted.
@@ -5,10 +5,13 @@
 #include <memory>
 
 namespace Salix {
+    class GLStateCache;
+
     class OpenGLTexture : public ITexture {
     public:
-        // Constructor that takes the OpenGL texture ID, width, and height
-        OpenGLTexture(GLuint texture_id, int width, int height);
+        // Constructor that takes the OpenGL texture ID, width, and height.
+        // state is the creating renderer's cache, told when the ID is deleted.
+        OpenGLTexture(GLuint texture_id, int width, int height, std::weak_ptr<GLStateCache> state = {});
 
         // Destructor to delete the OpenGL texture from GPU memory
         ~OpenGLTexture() override; 
@@ -1,11 +1,17 @@
 // Salix/rendering/sdl/SDLRenderer.cpp
 #include <Salix/rendering/sdl/SDLRenderer.h>
 #include <Salix/rendering/sdl/SDLTexture.h>
+#include <Salix/rendering/RenderCommandList.h>
+#include <Salix/rendering/DebugDrawList.h>
+#include <Salix/ecs/Transform.h>
 #include <SDL_image.h>
 #include <Salix/window/sdl/SDLWindow.h>
 #include <imgui/imgui.h>
 #include <iostream>
+#include <cmath>
 #include <SDL.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
 
 
 namespace Salix {
@@ -17,8 +23,116 @@ namespace Salix {
         SDL_Window* sdl_window = nullptr;
         SDL_GLContext sdl_gl_context = nullptr;
         Color clear_color = Color::from_rgba_int(15, 20, 40, 255);
+
+        // Batched sprites and debug shapes are recorded here and drawn, sorted,
+        // by execute_commands() at the next flush point.
+        RenderCommandList commands;
+        bool sprite_batch_open = false;
+        DebugDrawList debug_lines;  // Scratch for expanding a run of debug shapes.
+        RenderStats stats;
+        struct CommandExecutor;
+
+        void execute_commands();
     };
 
+
+    // Issues a sorted RenderCommandList through SDL_Renderer, which batches the
+    // copies and lines of a run itself. There is no camera here: world units
+    // are pixels, as with draw_texture().
+    struct SDLRenderer::Pimpl::CommandExecutor : IRenderCommandExecutor {
+        Pimpl& renderer;
+
+        explicit CommandExecutor(Pimpl& owner) : renderer(owner) {}
+
+        bool draw_sprites(const RenderCommand* commands, size_t count) override {
+            ITexture* texture = commands[0].texture;
+            SDLTexture* sdl_texture = texture ? dynamic_cast<SDLTexture*>(texture->get_base_texture()) : nullptr;
+            if (!sdl_texture || !renderer.sdl_renderer) return false;
+            SDL_Texture* raw_texture = sdl_texture->get_raw_texture();
+            const float page_width = static_cast<float>(sdl_texture->get_width());
+            const float page_height = static_cast<float>(sdl_texture->get_height());
+
+            for (size_t i = 0; i < count; ++i) {
+                const RenderCommand& command = commands[i];
+                // The model matrix scales and places a unit quad centred on the origin.
+                const glm::mat4& model = command.transform;
+                const float width = glm::length(glm::vec2(model[0]));
+                const float height = glm::length(glm::vec2(model[1]));
+                const SDL_Rect dest_rect = {
+                    static_cast<int>(model[3].x - width * 0.5f), static_cast<int>(model[3].y - height * 0.5f),
+                    static_cast<int>(width), static_cast<int>(height) };
+                const glm::vec4 uv_rect = command.texture->get_uv_rect();
+                const SDL_Rect source_rect = {
+                    static_cast<int>(uv_rect.x * page_width), static_cast<int>(uv_rect.y * page_height),
+                    static_cast<int>(uv_rect.z * page_width), static_cast<int>(uv_rect.w * page_height) };
+                // The angle follows the x axis, so a mirrored quad comes out as
+                // one rotated half a turn with its y axis flipped.
+                const double angle = glm::degrees(std::atan2(model[0].y, model[0].x));
+                const bool mirrored = model[0].x * model[1].y - model[0].y * model[1].x < 0.0f;
+
+                const glm::vec4& tint = command.color;
+                SDL_SetTextureColorMod(raw_texture, static_cast<Uint8>(tint.r * 255.0f),
+                                       static_cast<Uint8>(tint.g * 255.0f), static_cast<Uint8>(tint.b * 255.0f));
+                SDL_SetTextureAlphaMod(raw_texture, static_cast<Uint8>(tint.a * 255.0f));
+                SDL_RenderCopyEx(renderer.sdl_renderer, raw_texture, &source_rect, &dest_rect, angle, nullptr,
+                                 mirrored ? SDL_FLIP_VERTICAL : SDL_FLIP_NONE);
+            }
+            return true;
+        }
+
+        bool draw_sphere(const RenderCommand& command) override {
+            // No meshes without a 3D pipeline.
+            (void)command;
+            return false;
+        }
+
+        bool draw_debug_shapes(const RenderCommand* commands, size_t count) override {
+            if (!renderer.sdl_renderer) return false;
+            DebugDrawList& lines = renderer.debug_lines;
+            lines.clear();
+            for (size_t i = 0; i < count; ++i) {
+                const RenderCommand& command = commands[i];
+                const Color color(command.color.r, command.color.g, command.color.b, command.color.a);
+                switch (command.type) {
+                    case RenderCommandType::Line:
+                        lines.add_line(command.point_a, command.point_b, color);
+                        break;
+                    case RenderCommandType::WireBox:
+                        lines.add_wire_box(command.transform, color);
+                        break;
+                    case RenderCommandType::WireSphere:
+                        lines.add_wire_sphere(command.point_a, command.radius, color, command.segments);
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+            // Flattened to x/y; depth is dropped.
+            const auto& vertices = lines.get_vertices();
+            for (size_t i = 0; i + 1 < vertices.size(); i += 2) {
+                const glm::vec4& color = vertices[i].color;
+                SDL_SetRenderDrawColor(renderer.sdl_renderer, static_cast<Uint8>(color.r * 255.0f),
+                                       static_cast<Uint8>(color.g * 255.0f), static_cast<Uint8>(color.b * 255.0f),
+                                       static_cast<Uint8>(color.a * 255.0f));
+                SDL_RenderDrawLine(renderer.sdl_renderer,
+                                   static_cast<int>(vertices[i].position.x), static_cast<int>(vertices[i].position.y),
+                                   static_cast<int>(vertices[i + 1].position.x), static_cast<int>(vertices[i + 1].position.y));
+            }
+            return true;
+        }
+    };
+
+
+    void SDLRenderer::Pimpl::execute_commands() {
+        if (commands.empty()) return;
+        commands.sort();
+        CommandExecutor executor(*this);
+        commands.execute(executor, stats);
+        commands.clear();
+    }
+
+
     SDLRenderer::SDLRenderer() : pimpl(std::make_unique<Pimpl>()) {}
 
     SDLRenderer::~SDLRenderer() {
@@ -74,6 +188,7 @@ namespace Salix {
         }
 
         pimpl->sdl_renderer = nullptr; // Prevent double-deletion  
+        pimpl->commands.clear();
         pimpl->window = nullptr;
     }
 
@@ -86,9 +201,11 @@ namespace Salix {
         // Set the draw color and clear the screen
         SDL_SetRenderDrawColor(pimpl->sdl_renderer, 15, 20, 40, 255); // A dark-blue color.
         SDL_RenderClear(pimpl->sdl_renderer);
+        pimpl->stats = RenderStats{};
     }
 
     void SDLRenderer::end_frame() {
+        pimpl->execute_commands();
         // Present the back buffer to the screen.
         SDL_RenderPresent(pimpl->sdl_renderer);
     }
@@ -133,6 +250,58 @@ namespace Salix {
     }
           
 
+    void SDLRenderer::begin_sprite_batch() {
+        pimpl->sprite_batch_open = true;
+    }
+
+    void SDLRenderer::end_sprite_batch() {
+        if (!pimpl->sprite_batch_open) return;
+        pimpl->sprite_batch_open = false;
+        pimpl->execute_commands();
+    }
+
+    void SDLRenderer::submit_sprite(ITexture* texture, const Transform* transform, const Color& color, SpriteFlip flip, int sorting_layer) {
+        if (!texture || !transform) return;
+        // One world unit is one pixel here, so the quad takes the texture's size.
+        glm::vec3 size(static_cast<float>(texture->get_width()), static_cast<float>(texture->get_height()), 1.0f);
+        if (flip == SpriteFlip::Horizontal || flip == SpriteFlip::Both) size.x = -size.x;
+        if (flip == SpriteFlip::Vertical || flip == SpriteFlip::Both) size.y = -size.y;
+        pimpl->commands.add_sprite(texture, glm::scale(transform->get_world_matrix(), size), color, sorting_layer);
+        // Outside a batch the list is drawn straight away.
+        if (!pimpl->sprite_batch_open) pimpl->execute_commands();
+    }
+
+    void SDLRenderer::submit_sprite(ITexture* texture, const glm::mat4& model_matrix, const Color& color, int sorting_layer) {
+        pimpl->commands.add_sprite(texture, model_matrix, color, sorting_layer);
+        if (!pimpl->sprite_batch_open) pimpl->execute_commands();
+    }
+
+    void SDLRenderer::submit_commands(const RenderCommandList& commands) {
+        pimpl->commands.append(commands);
+    }
+
+    RenderStats SDLRenderer::get_render_stats() const {
+        return pimpl->stats;
+    }
+
+
+    void SDLRenderer::debug_line(const glm::vec3& start, const glm::vec3& end, const Color& color) {
+        pimpl->commands.add_line(start, end, color);
+    }
+
+    void SDLRenderer::debug_wire_box(const glm::mat4& model_matrix, const Color& color) {
+        pimpl->commands.add_wire_box(model_matrix, color);
+    }
+
+    void SDLRenderer::debug_wire_sphere(const glm::vec3& center, float radius, const Color& color, int segments) {
+        pimpl->commands.add_wire_sphere(center, radius, color, segments);
+    }
+
+    void SDLRenderer::flush_debug_draw() {
+        pimpl->execute_commands();
+    }
+          
+
     void SDLRenderer::on_window_resize(int width, int height) {
     
         if (pimpl->sdl_renderer && width > 0 && height > 0) {
@@ -61,6 +61,18 @@ namespace Salix{
             void draw_texture(ITexture* texture, const Rect& dest_rect) override;
 
             void draw_sprite(ITexture* texture, const Transform* transform, const Color& color, SpriteFlip flip) override; 
+            // Batched sprites and debug shapes are recorded and drawn, sorted, at
+            // end_sprite_batch(), flush_debug_draw() or end_frame().
+            void begin_sprite_batch() override;
+            void end_sprite_batch() override;
+            void submit_sprite(ITexture* texture, const Transform* transform, const Color& color, SpriteFlip flip, int sorting_layer) override;
+            void submit_sprite(ITexture* texture, const glm::mat4& model_matrix, const Color& color, int sorting_layer) override;
+            void submit_commands(const RenderCommandList& commands) override;
+            RenderStats get_render_stats() const override;
+            void debug_line(const glm::vec3& start, const glm::vec3& end, const Color& color) override;
+            void debug_wire_box(const glm::mat4& model_matrix, const Color& color) override;
+            void debug_wire_sphere(const glm::vec3& center, float radius, const Color& color, int segments = 16) override;
+            void flush_debug_draw() override;
             void draw_wire_box(const glm::mat4& model_matrix, const Color& color) override {
                 (void) model_matrix; 
                 (void) color;
@@ -12,7 +12,12 @@ namespace Salix {
 
         virtual void on_enter(const InitContext& context) = 0;
         virtual void on_exit() = 0;
+        // Once per frame: input, UI and anything else tied to the display.
         virtual void update(float delta_time) = 0;
+        // Advances the simulation (the active realm) by one step. With a fixed
+        // timestep this runs zero or more times per frame, after update();
+        // otherwise once per frame with the frame's delta time.
+        virtual void simulate(float step) { (void)step; }
         virtual void render(IRenderer* renderer) = 0;
     };
 }
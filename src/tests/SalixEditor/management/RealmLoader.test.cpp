@@ -0,0 +1,183 @@
+// =================================================================================
+// Filename:    src/Tests/SalixEditor/management/RealmLoader.test.cpp
+// Description: Contains unit tests for the parallel YAML realm loader, its
+//              binary archetype cache and its background load task.
+// =================================================================================
+#include <doctest.h>
+#include <Editor/management/RealmLoader.h>
+#include <Salix/core/JobSystem.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+    // Entity i has id 100 + i, a parent of 100 + i - 1 (none for the first)
+    // and one Transform element with id 10000 + i.
+    std::string write_realm_yaml(const std::string& file_name, int entity_count, bool add_broken_entity) {
+        std::filesystem::path path = std::filesystem::temp_directory_path() / file_name;
+        std::ofstream out(path.string());
+        out << "Entities:\n";
+        for (int i = 0; i < entity_count; ++i) {
+            out << "  - name: Entity" << i << "\n"
+                << "    id: " << (100 + i) << "\n";
+            if (i > 0) out << "    parent: " << (100 + i - 1) << "\n";
+            out << "    elements:\n"
+                << "      Transform:\n"
+                << "        id: " << (10000 + i) << "\n"
+                << "        position: {x: " << i << ", y: 0, z: 0}\n";
+            if (add_broken_entity && i == entity_count / 2) {
+                out << "  - name: NoId\n";
+            }
+        }
+        return path.string();
+    }
+
+    void remove_realm(const std::string& path) {
+        std::filesystem::remove(path);
+        std::filesystem::remove(Salix::get_realm_cache_path(path));
+    }
+}
+
+TEST_SUITE("Salix::editor::RealmLoader") {
+    TEST_CASE("entities come back in file order when built on several workers") {
+        const int entity_count = 500;
+        const std::string path = write_realm_yaml("salix_realm_loader_order.yaml", entity_count, true);
+        Salix::JobSystem jobs(4);
+
+        std::vector<size_t> reported;
+        size_t reported_total = 0;
+        auto archetypes = Salix::load_archetypes_from_file(path,
+            [&](size_t entities_done, size_t entity_total) {
+                reported.push_back(entities_done);
+                reported_total = entity_total;
+            }, &jobs);
+
+        // The entity without an id is dropped; the rest keep their order.
+        REQUIRE(archetypes.size() == entity_count);
+        for (int i = 0; i < entity_count; ++i) {
+            CHECK(archetypes[i].name == "Entity" + std::to_string(i));
+            CHECK(archetypes[i].id.get_value() == static_cast<uint64_t>(100 + i));
+            REQUIRE(archetypes[i].elements.size() == 1);
+            CHECK(archetypes[i].elements[0].owner_id == archetypes[i].id);
+        }
+        CHECK_FALSE(archetypes[0].parent_id.is_valid());
+        CHECK(archetypes[1].parent_id.get_value() == 100);
+
+        CHECK(reported_total == entity_count + 1);
+        REQUIRE(reported.size() >= 2);
+        CHECK(reported.front() == 0);
+        CHECK(reported.back() == entity_count + 1);
+        for (size_t i = 1; i < reported.size(); ++i) {
+            CHECK(reported[i] >= reported[i - 1]);
+        }
+        remove_realm(path);
+    }
+
+    TEST_CASE("an unchanged realm is read back from its cache") {
+        const std::string path = write_realm_yaml("salix_realm_loader_cache.yaml", 40, false);
+        // Flow style and a non-Transform element must survive the round trip.
+        {
+            std::ofstream out(path, std::ios::app);
+            out << "  - name: Tagged\n"
+                << "    id: 900\n"
+                << "    elements:\n"
+                << "      Sprite2D:\n"
+                << "        id: 901\n"
+                << "        allows_duplication: false\n"
+                << "        texture_path: \"42\"\n"
+                << "        tags: [a, b]\n";
+        }
+        Salix::JobSystem jobs(2);
+        const std::string cache_path = Salix::get_realm_cache_path(path);
+        std::filesystem::remove(cache_path);
+
+        auto from_yaml = Salix::load_archetypes_from_file(path, Salix::RealmLoadProgressCallback(), &jobs);
+        REQUIRE(from_yaml.size() == 41);
+        REQUIRE(std::filesystem::exists(cache_path));
+
+        // Swap the YAML's contents for garbage of the same size and time; if
+        // the loader still gets the realm, it never parsed the YAML.
+        const auto size = std::filesystem::file_size(path);
+        const auto write_time = std::filesystem::last_write_time(path);
+        {
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            out << std::string(static_cast<size_t>(size), '{');
+        }
+        std::filesystem::last_write_time(path, write_time);
+
+        std::vector<size_t> reported;
+        auto from_cache = Salix::load_archetypes_from_file(path,
+            [&](size_t entities_done, size_t) { reported.push_back(entities_done); }, &jobs);
+        REQUIRE(from_cache.size() == from_yaml.size());
+        CHECK(reported.back() == from_yaml.size());
+        for (size_t i = 0; i < from_yaml.size(); ++i) {
+            CHECK(from_cache[i].name == from_yaml[i].name);
+            CHECK(from_cache[i].id == from_yaml[i].id);
+            CHECK(from_cache[i].parent_id == from_yaml[i].parent_id);
+            REQUIRE(from_cache[i].elements.size() == from_yaml[i].elements.size());
+            for (size_t e = 0; e < from_yaml[i].elements.size(); ++e) {
+                const auto& cached = from_cache[i].elements[e];
+                const auto& parsed = from_yaml[i].elements[e];
+                CHECK(cached.type_name == parsed.type_name);
+                CHECK(cached.name == parsed.name);
+                CHECK(cached.id == parsed.id);
+                CHECK(cached.owner_id == parsed.owner_id);
+                CHECK(cached.allows_duplication == parsed.allows_duplication);
+                CHECK(YAML::Dump(cached.data) == YAML::Dump(parsed.data));
+            }
+        }
+        const auto& sprite = from_cache.back().elements[0];
+        CHECK_FALSE(sprite.allows_duplication);
+        CHECK(sprite.data["texture_path"].as<std::string>() == "42");
+        CHECK(sprite.data["tags"].Style() == YAML::EmitterStyle::Flow);
+        CHECK(from_cache[3].elements[0].data["position"]["x"].as<int>() == 3);
+        remove_realm(path);
+    }
+
+    TEST_CASE("an edited realm is parsed again and its cache refreshed") {
+        const std::string path = write_realm_yaml("salix_realm_loader_stale.yaml", 10, false);
+        Salix::JobSystem jobs(0);
+        CHECK(Salix::load_archetypes_from_file(path, Salix::RealmLoadProgressCallback(), &jobs).size() == 10);
+
+        const auto old_time = std::filesystem::last_write_time(path);
+        write_realm_yaml("salix_realm_loader_stale.yaml", 12, false);
+        std::filesystem::last_write_time(path, old_time + std::chrono::seconds(1));
+        CHECK(Salix::load_archetypes_from_file(path, Salix::RealmLoadProgressCallback(), &jobs).size() == 12);
+        CHECK(Salix::load_archetypes_from_file(path, Salix::RealmLoadProgressCallback(), &jobs).size() == 12);
+
+        // A damaged cache is ignored, not trusted.
+        std::filesystem::resize_file(Salix::get_realm_cache_path(path), 30);
+        CHECK(Salix::load_archetypes_from_file(path, Salix::RealmLoadProgressCallback(), &jobs).size() == 12);
+        remove_realm(path);
+    }
+
+    TEST_CASE("a load task finishes in the background and hands over the result") {
+        const std::string path = write_realm_yaml("salix_realm_loader_task.yaml", 64, false);
+        Salix::JobSystem jobs(2);
+
+        Salix::RealmLoadTask task(path, &jobs);
+        auto archetypes = task.take_result();
+        CHECK(task.is_done());
+        CHECK(task.get_progress() == doctest::Approx(1.0f));
+        CHECK(task.get_entity_total() == 64);
+        CHECK(archetypes.size() == 64);
+        remove_realm(path);
+    }
+
+    TEST_CASE("a load task without a job system brings its own") {
+        const std::string path = write_realm_yaml("salix_realm_loader_own_jobs.yaml", 200, false);
+        Salix::RealmLoadTask task(path);
+        auto archetypes = task.take_result();
+        CHECK(task.get_entity_total() == 200);
+        CHECK(archetypes.size() == 200);
+        remove_realm(path);
+    }
+
+    TEST_CASE("a missing file gives an empty realm") {
+        Salix::JobSystem jobs(0);
+        auto archetypes = Salix::load_archetypes_from_file("does/not/exist.yaml", Salix::RealmLoadProgressCallback(), &jobs);
+        CHECK(archetypes.empty());
+    }
+}
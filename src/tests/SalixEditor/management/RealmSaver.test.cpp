@@ -0,0 +1,263 @@
+// =================================================================================
+// Filename:    src/Tests/SalixEditor/management/RealmSaver.test.cpp
+// Description: Contains unit tests for full realm saves and the append-only
+//              journal used for incremental saves.
+// =================================================================================
+#include <doctest.h>
+#include <Editor/management/RealmSaver.h>
+#include <Editor/management/RealmLoader.h>
+#include <Salix/core/JobSystem.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+    Salix::EntityArchetype make_entity(uint64_t id, uint64_t parent_id, float x) {
+        Salix::EntityArchetype entity;
+        entity.name = "Entity" + std::to_string(id);
+        entity.id = Salix::SimpleGuid::from_value(id);
+        entity.parent_id = parent_id ? Salix::SimpleGuid::from_value(parent_id) : Salix::SimpleGuid::invalid();
+
+        Salix::ElementArchetype transform;
+        transform.type_name = "Transform";
+        transform.name = "Transform";
+        transform.id = Salix::SimpleGuid::from_value(id * 100);
+        transform.owner_id = entity.id;
+        transform.allows_duplication = false;
+        transform.data["name"] = "Transform";
+        transform.data["position"]["x"] = x;
+        transform.data["position"]["y"] = 0.0f;
+        transform.data["position"]["z"] = 0.0f;
+        entity.elements.push_back(transform);
+        return entity;
+    }
+
+    std::vector<Salix::EntityArchetype> make_realm(uint64_t entity_count) {
+        std::vector<Salix::EntityArchetype> realm;
+        for (uint64_t i = 1; i <= entity_count; ++i) {
+            realm.push_back(make_entity(i, i > 1 ? i - 1 : 0, static_cast<float>(i)));
+        }
+        return realm;
+    }
+
+    std::string temp_realm_path(const std::string& file_name) {
+        return (std::filesystem::temp_directory_path() / file_name).string();
+    }
+
+    void remove_realm(const std::string& path) {
+        std::filesystem::remove(path);
+        std::filesystem::remove(Salix::get_realm_cache_path(path));
+        std::filesystem::remove(Salix::get_realm_journal_path(path));
+    }
+
+    std::vector<Salix::EntityArchetype> load(const std::string& path) {
+        Salix::JobSystem jobs(0);
+        return Salix::load_archetypes_from_file(path, Salix::RealmLoadProgressCallback(), &jobs);
+    }
+
+    float position_x(const Salix::EntityArchetype& entity) {
+        return entity.elements.at(0).data["position"]["x"].as<float>();
+    }
+}
+
+TEST_SUITE("Salix::editor::RealmSaver") {
+    TEST_CASE("a full save loads back and keeps the file's other keys") {
+        const std::string path = temp_realm_path("salix_realm_saver_full.yaml");
+        remove_realm(path);
+        {
+            std::ofstream out(path);
+            out << "# hand written\n"
+                << "RealmFileVersion: 1.0\n"
+                << "Settings:\n"
+                << "  name: \"Kept\"\n"
+                << "\n"
+                << "Entities:\n"
+                << "  - id: 1\n"
+                << "    name: Old\n";
+        }
+
+        auto realm = make_realm(5);
+        realm[2].elements.push_back(realm[2].elements[0]);
+        realm[2].elements[1].id = Salix::SimpleGuid::from_value(999);
+        REQUIRE(Salix::save_archetypes_to_file(path, realm));
+
+        const YAML::Node file = YAML::LoadFile(path);
+        CHECK(file["Settings"]["name"].as<std::string>() == "Kept");
+        CHECK(file["RealmFileVersion"].as<std::string>() == "1.0");
+
+        auto loaded = load(path);
+        REQUIRE(loaded.size() == realm.size());
+        for (size_t i = 0; i < realm.size(); ++i) {
+            CHECK(loaded[i].id == realm[i].id);
+            CHECK(loaded[i].name == realm[i].name);
+            CHECK(loaded[i].parent_id == realm[i].parent_id);
+            REQUIRE(loaded[i].elements.size() == realm[i].elements.size());
+            CHECK(loaded[i].elements[0].id == realm[i].elements[0].id);
+            CHECK_FALSE(loaded[i].elements[0].allows_duplication);
+            CHECK(position_x(loaded[i]) == doctest::Approx(position_x(realm[i])));
+        }
+        // Two elements of the same type both survive.
+        CHECK(loaded[2].elements[1].id.get_value() == 999);
+        remove_realm(path);
+    }
+
+    TEST_CASE("journal saves patch the realm without touching its file") {
+        const std::string path = temp_realm_path("salix_realm_saver_journal.yaml");
+        remove_realm(path);
+        auto realm = make_realm(20);
+        REQUIRE(Salix::save_archetypes_to_file(path, realm));
+        load(path); // writes the archetype cache
+
+        Salix::RealmFileStamp before;
+        REQUIRE(Salix::get_realm_file_stamp(path, before));
+
+        // Save 1: move entity 4, purge entity 7, add entity 50.
+        realm[3].elements[0].data["position"]["x"] = 123.0f;
+        Salix::EntityArchetype added = make_entity(50, 1, 50.0f);
+        REQUIRE(Salix::append_realm_journal(path, { &realm[3], &added }, { Salix::SimpleGuid::from_value(7) }));
+        // Save 2: rename entity 4 again.
+        realm[3].name = "Renamed";
+        REQUIRE(Salix::append_realm_journal(path, { &realm[3] }, {}));
+
+        Salix::RealmFileStamp after;
+        REQUIRE(Salix::get_realm_file_stamp(path, after));
+        CHECK(after.size == before.size);
+        CHECK(after.write_time == before.write_time);
+
+        auto loaded = load(path);
+        REQUIRE(loaded.size() == 20);
+        CHECK(loaded[3].name == "Renamed");
+        CHECK(position_x(loaded[3]) == doctest::Approx(123.0f));
+        CHECK(loaded[6].id.get_value() == 8); // 7 is gone; the order is kept.
+        CHECK(loaded.back().id.get_value() == 50);
+        CHECK(loaded.back().parent_id.get_value() == 1);
+
+        // A full save folds the journal into the file.
+        REQUIRE(Salix::save_archetypes_to_file(path, loaded));
+        CHECK_FALSE(std::filesystem::exists(Salix::get_realm_journal_path(path)));
+        CHECK(load(path).size() == 20);
+        remove_realm(path);
+    }
+
+    TEST_CASE("a save cut short by a crash is dropped on its own") {
+        const std::string path = temp_realm_path("salix_realm_saver_torn.yaml");
+        remove_realm(path);
+        auto realm = make_realm(4);
+        REQUIRE(Salix::save_archetypes_to_file(path, realm));
+
+        realm[0].name = "Saved";
+        REQUIRE(Salix::append_realm_journal(path, { &realm[0] }, {}));
+        realm[1].name = "Lost";
+        REQUIRE(Salix::append_realm_journal(path, { &realm[1] }, {}));
+
+        // Chop the last save before its Commit line, or partway through it.
+        const std::string journal_path = Salix::get_realm_journal_path(path);
+        std::string text;
+        {
+            std::ifstream in(journal_path, std::ios::binary);
+            text.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+        const size_t commit = text.rfind("Commit:");
+        REQUIRE(commit != std::string::npos);
+        size_t cut = commit;
+        SUBCASE("at a line break") { cut = commit; }
+        SUBCASE("mid-line") { cut = commit + 4; }
+        {
+            std::ofstream out(journal_path, std::ios::binary | std::ios::trunc);
+            out << text.substr(0, cut);
+        }
+
+        auto loaded = load(path);
+        REQUIRE(loaded.size() == 4);
+        CHECK(loaded[0].name == "Saved");
+        CHECK(loaded[1].name == "Entity2");
+
+        // The next save replaces the damaged one instead of landing behind it.
+        realm[2].name = "After";
+        REQUIRE(Salix::append_realm_journal(path, { &realm[2] }, {}));
+        loaded = load(path);
+        REQUIRE(loaded.size() == 4);
+        CHECK(loaded[0].name == "Saved");
+        CHECK(loaded[1].name == "Entity2");
+        CHECK(loaded[2].name == "After");
+
+        realm[3].name = "Later";
+        REQUIRE(Salix::append_realm_journal(path, { &realm[3] }, {}));
+        loaded = load(path);
+        REQUIRE(loaded.size() == 4);
+        CHECK(loaded[2].name == "After");
+        CHECK(loaded[3].name == "Later");
+        remove_realm(path);
+    }
+
+    TEST_CASE("a journal for another version of the file is ignored and restarted") {
+        const std::string path = temp_realm_path("salix_realm_saver_stale.yaml");
+        remove_realm(path);
+        auto realm = make_realm(3);
+        REQUIRE(Salix::save_archetypes_to_file(path, realm));
+        realm[0].name = "FromJournal";
+        REQUIRE(Salix::append_realm_journal(path, { &realm[0] }, {}));
+
+        // Someone else rewrites the file; the journal no longer applies.
+        auto replacement = make_realm(2);
+        {
+            const std::string journal_path = Salix::get_realm_journal_path(path);
+            const std::string kept = journal_path + ".kept";
+            std::filesystem::copy_file(journal_path, kept, std::filesystem::copy_options::overwrite_existing);
+            REQUIRE(Salix::save_archetypes_to_file(path, replacement));
+            std::filesystem::rename(kept, journal_path);
+        }
+        std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + std::chrono::seconds(1));
+        auto loaded = load(path);
+        REQUIRE(loaded.size() == 2);
+        CHECK(loaded[0].name == "Entity1");
+
+        // The next incremental save starts over against the new file.
+        replacement[1].name = "Fresh";
+        REQUIRE(Salix::append_realm_journal(path, { &replacement[1] }, {}));
+        loaded = load(path);
+        REQUIRE(loaded.size() == 2);
+        CHECK(loaded[0].name == "Entity1");
+        CHECK(loaded[1].name == "Fresh");
+        remove_realm(path);
+    }
+
+    TEST_CASE("the journal asks for compaction once it outgrows the ratio") {
+        const std::string path = temp_realm_path("salix_realm_saver_compact.yaml");
+        remove_realm(path);
+        auto realm = make_realm(40);
+        REQUIRE(Salix::save_archetypes_to_file(path, realm));
+        CHECK_FALSE(Salix::realm_journal_needs_compaction(path));
+
+        REQUIRE(Salix::append_realm_journal(path, { &realm[0] }, {}));
+        CHECK_FALSE(Salix::realm_journal_needs_compaction(path));
+
+        std::vector<const Salix::EntityArchetype*> half;
+        for (size_t i = 0; i < realm.size() / 2; ++i) half.push_back(&realm[i]);
+        REQUIRE(Salix::append_realm_journal(path, half, {}));
+        CHECK(Salix::realm_journal_needs_compaction(path));
+        remove_realm(path);
+    }
+
+    TEST_CASE("benchmark: full save versus a one-entity journal save" * doctest::skip()) {
+        const std::string path = temp_realm_path("salix_realm_saver_benchmark.yaml");
+        remove_realm(path);
+        auto realm = make_realm(200000);
+
+        auto start = std::chrono::steady_clock::now();
+        REQUIRE(Salix::save_archetypes_to_file(path, realm));
+        const double full_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        realm[1000].elements[0].data["position"]["x"] = -1.0f;
+        start = std::chrono::steady_clock::now();
+        REQUIRE(Salix::append_realm_journal(path, { &realm[1000] }, {}));
+        const double journal_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << "[benchmark] " << std::filesystem::file_size(path) / (1024 * 1024) << " MB realm: full save "
+                  << full_ms << " ms, journal save " << journal_ms << " ms" << std::endl;
+        remove_realm(path);
+    }
+}
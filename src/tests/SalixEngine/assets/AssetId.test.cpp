@@ -0,0 +1,38 @@
+// =================================================================================
+// Filename:    src/Tests/SalixEngine/assets/AssetId.test.cpp
+// Description: Contains unit tests for AssetId normalisation and interning.
+// =================================================================================
+#include <doctest.h>
+#include <Salix/assets/AssetId.h>
+#include <string>
+#include <unordered_set>
+
+TEST_SUITE("Salix::assets::AssetId") {
+    TEST_CASE("an empty path gives an invalid id") {
+        Salix::AssetId id = Salix::AssetId::from_path("");
+        CHECK_FALSE(id.is_valid());
+        CHECK(id == Salix::AssetId());
+        CHECK(id.get_path().empty());
+    }
+
+    TEST_CASE("spellings of the same path give the same id") {
+        Salix::AssetId plain = Salix::AssetId::from_path("Assets/Images/player.png");
+        CHECK(plain.is_valid());
+        CHECK(Salix::AssetId::from_path("Assets/./Images/player.png") == plain);
+        CHECK(Salix::AssetId::from_path("Assets/Sounds/../Images/player.png") == plain);
+        CHECK(Salix::AssetId::from_path("Assets/Images/enemy.png") != plain);
+    }
+
+    TEST_CASE("an id gives back its normalised path") {
+        Salix::AssetId id = Salix::AssetId::from_path("Assets/Sounds/../Images/tree.png");
+        CHECK(id.get_path() == "Assets/Images/tree.png");
+    }
+
+    TEST_CASE("ids work as hash keys") {
+        std::unordered_set<Salix::AssetId, Salix::AssetIdHash> ids;
+        ids.insert(Salix::AssetId::from_path("a.png"));
+        ids.insert(Salix::AssetId::from_path("./a.png"));
+        ids.insert(Salix::AssetId::from_path("b.png"));
+        CHECK(ids.size() == 2);
+    }
+}
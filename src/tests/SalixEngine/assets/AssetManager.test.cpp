@@ -4,6 +4,7 @@
 // ================================================================================= 
 #include <doctest.h>
 #include <Salix/assets/AssetManager.h>
+#include <Salix/assets/TextureCache.h>
 #include <doctest.h>
 #include <Salix/rendering/IRenderer.h>
 #include <Salix/rendering/ITexture.h>
@@ -78,4 +79,211 @@ TEST_SUITE("Salix::assets::AssetManager") {
             CHECK(texture1 != texture2);
         }
     }
-}
\ No newline at end of file
+}
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+namespace {
+    // Writes a binary PPM, which stb_image decodes without any extra setup.
+    std::string write_test_image(const std::string& name, int width, int height) {
+        std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+        std::ofstream out(path.string(), std::ios::binary);
+        out << "P6\n" << width << " " << height << "\n255\n";
+        for (int i = 0; i < width * height; ++i) {
+            out.put(static_cast<char>(200)).put(static_cast<char>(100)).put(static_cast<char>(50));
+        }
+        return path.string();
+    }
+}
+
+TEST_SUITE("Salix::assets::AssetManager streaming") {
+    TEST_CASE("request_texture falls back to a synchronous load") {
+        Salix::AssetManager asset_manager;
+        MockIRenderer mock_renderer;
+        asset_manager.initialize(&mock_renderer);
+
+        Salix::TextureHandle handle = asset_manager.request_texture("assets/textures/test.png");
+        Salix::ITexture* texture = handle.get();
+        REQUIRE(texture != nullptr);
+        CHECK(texture->is_ready());
+        CHECK(texture == asset_manager.get_texture("assets/textures/test.png"));
+        CHECK(asset_manager.get_pending_texture_count() == 0);
+        CHECK(asset_manager.process_texture_uploads() == 0);
+    }
+
+    TEST_CASE("a requested texture shows the placeholder until it is uploaded") {
+        Salix::AssetManager asset_manager;
+        MockIRenderer mock_renderer;
+        mock_renderer.supports_create_texture = true;
+        asset_manager.initialize(&mock_renderer);
+        const std::string path = write_test_image("salix_stream_a.ppm", 4, 2);
+
+        Salix::TextureHandle handle = asset_manager.request_texture(path);
+        Salix::ITexture* texture = handle.get();
+        REQUIRE(texture != nullptr);
+        CHECK_FALSE(texture->is_ready());
+        CHECK(texture->get_width() == 2);   // The 2x2 placeholder.
+        CHECK(texture->resolve() != texture);
+        CHECK(asset_manager.request_texture(path).get() == texture);
+
+        asset_manager.finish_texture_requests();
+        CHECK(texture->is_ready());
+        CHECK(texture->get_width() == 4);
+        CHECK(texture->get_height() == 2);
+        CHECK(asset_manager.get_pending_texture_count() == 0);
+        CHECK(mock_renderer.create_texture_call_count == 2);   // Placeholder + image.
+
+        asset_manager.shutdown();
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("uploads respect the per-frame budget") {
+        Salix::AssetManager asset_manager;
+        MockIRenderer mock_renderer;
+        mock_renderer.supports_create_texture = true;
+        asset_manager.initialize(&mock_renderer);
+        // A 4x2 image cooks to 44 bytes of RGBA8 with its mips (32 + 8 + 4), so
+        // only the one upload every call is allowed fits under this budget.
+        asset_manager.set_texture_upload_budget(30);
+
+        std::vector<std::string> paths;
+        for (int i = 0; i < 3; ++i) {
+            paths.push_back(write_test_image("salix_stream_b" + std::to_string(i) + ".ppm", 4, 2));
+            asset_manager.request_texture(paths.back());
+        }
+        CHECK(asset_manager.get_pending_texture_count() == 3);
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (asset_manager.get_pending_texture_count() > 0 && std::chrono::steady_clock::now() < deadline) {
+            CHECK(asset_manager.process_texture_uploads() <= 1);
+            std::this_thread::yield();
+        }
+        CHECK(asset_manager.get_pending_texture_count() == 0);
+
+        asset_manager.shutdown();
+        for (const std::string& path : paths) std::filesystem::remove(path);
+    }
+
+    TEST_CASE("a texture that fails to decode keeps the placeholder") {
+        Salix::AssetManager asset_manager;
+        MockIRenderer mock_renderer;
+        mock_renderer.supports_create_texture = true;
+        asset_manager.initialize(&mock_renderer);
+
+        Salix::TextureHandle handle = asset_manager.request_texture("does/not/exist.png");
+        Salix::ITexture* texture = handle.get();
+        asset_manager.finish_texture_requests();
+        CHECK_FALSE(texture->is_ready());
+        CHECK(texture->get_width() == 2);
+        CHECK(asset_manager.get_pending_texture_count() == 0);
+    }
+
+    TEST_CASE("streamed textures are cooked and reused from the cache") {
+        const std::string path = write_test_image("salix_stream_c.ppm", 4, 2);
+        const std::filesystem::path cache_dir = std::filesystem::temp_directory_path() / "salix_stream_cache";
+        std::filesystem::remove_all(cache_dir);
+        const std::string cooked_path = Salix::TextureCache(cache_dir.string()).get_cooked_path(path);
+
+        for (int run = 0; run < 2; ++run) {
+            Salix::AssetManager asset_manager;
+            MockIRenderer mock_renderer;
+            mock_renderer.supports_create_texture = true;
+            asset_manager.initialize(&mock_renderer);
+            asset_manager.set_texture_cache_directory(cache_dir.string());
+
+            Salix::TextureHandle handle = asset_manager.request_texture(path);
+            Salix::ITexture* texture = handle.get();
+            asset_manager.finish_texture_requests();
+            CHECK(texture->is_ready());
+            CHECK(texture->get_width() == 4);
+            CHECK(std::filesystem::exists(cooked_path));
+            asset_manager.shutdown();
+        }
+
+        std::filesystem::remove_all(cache_dir);
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("handles count references and keep textures from being evicted") {
+        Salix::AssetManager asset_manager;
+        MockIRenderer mock_renderer;
+        asset_manager.initialize(&mock_renderer);
+
+        Salix::TextureHandle first = asset_manager.acquire_texture("assets/a.png");
+        REQUIRE(first);
+        CHECK(first.get_ref_count() == 1);
+        {
+            Salix::TextureHandle copy = first;
+            CHECK(first.get_ref_count() == 2);
+            Salix::TextureHandle moved = std::move(copy);
+            CHECK(first.get_ref_count() == 2);
+        }
+        CHECK(first.get_ref_count() == 1);
+
+        // Every mock texture is 16x16, counted as RGBA8.
+        const size_t texture_bytes = 16 * 16 * 4;
+        Salix::TextureHandle second = asset_manager.acquire_texture("assets/b.png");
+        asset_manager.set_texture_memory_budget(texture_bytes);
+        CHECK(asset_manager.trim_textures() == 0);   // Both still referenced.
+        CHECK(asset_manager.get_texture_cache_stats().resident_bytes == 2 * texture_bytes);
+
+        second.reset();
+        CHECK(asset_manager.trim_textures() == 1);
+        Salix::AssetCacheStats stats = asset_manager.get_texture_cache_stats();
+        CHECK(stats.resident_count == 1);
+        CHECK(stats.resident_bytes == texture_bytes);
+        CHECK(stats.evictions == 1);
+        CHECK(stats.evicted_bytes == texture_bytes);
+        CHECK(first->get_width() == 16);
+
+        asset_manager.shutdown();
+        first.reset();   // Safe after the cache is gone.
+    }
+
+    TEST_CASE("eviction is least recently used first and skips pinned textures") {
+        Salix::AssetManager asset_manager;
+        MockIRenderer mock_renderer;
+        asset_manager.initialize(&mock_renderer);
+        const size_t texture_bytes = 16 * 16 * 4;
+
+        asset_manager.acquire_texture("assets/old.png");
+        asset_manager.acquire_texture("assets/new.png");
+        Salix::ITexture* pinned = asset_manager.get_texture("assets/pinned.png");
+        asset_manager.acquire_texture("assets/old.png");   // Now the most recent of the two.
+        asset_manager.reset_texture_cache_stats();
+
+        asset_manager.set_texture_memory_budget(2 * texture_bytes);
+        CHECK(asset_manager.trim_textures() == 1);
+
+        // "new" went, so asking for it again is a miss; "old" and the pinned one are hits.
+        asset_manager.acquire_texture("assets/old.png");
+        CHECK(asset_manager.get_texture("assets/pinned.png") == pinned);
+        asset_manager.acquire_texture("assets/new.png");
+        Salix::AssetCacheStats stats = asset_manager.get_texture_cache_stats();
+        CHECK(stats.hits == 2);
+        CHECK(stats.misses == 1);
+        CHECK(stats.get_hit_rate() == doctest::Approx(2.0 / 3.0));
+    }
+
+    TEST_CASE("ids and paths share one cache entry") {
+        Salix::AssetManager asset_manager;
+        MockIRenderer mock_renderer;
+        asset_manager.initialize(&mock_renderer);
+
+        Salix::AssetId id = Salix::AssetId::from_path("assets/textures/shared.png");
+        Salix::ITexture* by_id = asset_manager.get_texture(id);
+        REQUIRE(by_id != nullptr);
+        CHECK(asset_manager.get_texture("assets/textures/shared.png") == by_id);
+        CHECK(asset_manager.get_texture("assets/sounds/../textures/shared.png") == by_id);
+        CHECK(asset_manager.acquire_texture(id).get() == by_id);
+        CHECK(asset_manager.get_texture(Salix::AssetId()) == nullptr);
+
+        Salix::AssetCacheStats stats = asset_manager.get_texture_cache_stats();
+        CHECK(stats.misses == 1);
+        CHECK(stats.hits == 3);
+    }
+}
@@ -0,0 +1,168 @@
+// =================================================================================
+// Filename:    src/Tests/SalixEngine/assets/TextureAtlas.test.cpp
+// Description: Contains unit tests for atlas packing, atlas building (also
+//              through the cooked cache and the AssetManager) and batching of
+//              sprites that share an atlas page.
+// =================================================================================
+#include <doctest.h>
+#include <Salix/assets/AssetManager.h>
+#include <Salix/assets/TextureAtlas.h>
+#include <Salix/assets/TextureCache.h>
+#include <Salix/rendering/SpriteBatch.h>
+#include <Tests/SalixEngine/mocking/rendering/MockITexture.h>
+#include <Tests/SalixEngine/mocking/rendering/MockIRenderer.h>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+    bool overlaps(const Salix::AtlasPlacement& a, const Salix::AtlasPlacement& b, int padding) {
+        if (a.page != b.page) return false;
+        return a.x - padding < b.x + b.width + padding && b.x - padding < a.x + a.width + padding &&
+               a.y - padding < b.y + b.height + padding && b.y - padding < a.y + a.height + padding;
+    }
+
+    std::string write_ppm(const std::filesystem::path& path, int width, int height) {
+        std::ofstream out(path.string(), std::ios::binary);
+        out << "P6\n" << width << " " << height << "\n255\n";
+        for (int i = 0; i < width * height * 3; ++i) out.put(static_cast<char>(i));
+        return path.string();
+    }
+}
+
+TEST_SUITE("Salix::assets::TextureAtlas") {
+    TEST_CASE("packed rectangles stay on the page and never overlap") {
+        std::vector<glm::ivec2> sizes;
+        for (int i = 0; i < 40; ++i) sizes.push_back(glm::ivec2(8 + (i * 7) % 40, 8 + (i * 13) % 30));
+        int page_count = 0;
+        const int padding = 2;
+        const auto placements = Salix::TextureAtlas::pack(sizes, 128, padding, &page_count);
+
+        REQUIRE(placements.size() == sizes.size());
+        CHECK(page_count >= 2);
+        for (size_t i = 0; i < placements.size(); ++i) {
+            const auto& p = placements[i];
+            REQUIRE(p.page >= 0);
+            CHECK(p.width == sizes[i].x);
+            CHECK(p.height == sizes[i].y);
+            CHECK(p.x >= padding);
+            CHECK(p.y >= padding);
+            CHECK(p.x + p.width + padding <= 128);
+            CHECK(p.y + p.height + padding <= 128);
+            for (size_t j = i + 1; j < placements.size(); ++j) {
+                CHECK_FALSE(overlaps(p, placements[j], padding));
+            }
+        }
+    }
+
+    TEST_CASE("images that cannot fit are left unplaced") {
+        int page_count = -1;
+        const auto placements = Salix::TextureAtlas::pack({ glm::ivec2(200, 10), glm::ivec2(10, 10) }, 128, 1, &page_count);
+        CHECK(placements[0].page == -1);
+        CHECK(placements[1].page == 0);
+        CHECK(page_count == 1);
+    }
+
+    TEST_CASE("building an atlas gives regions that bind their page") {
+        const std::filesystem::path dir = std::filesystem::temp_directory_path() / "salix_atlas_test";
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+        const std::vector<std::string> paths = {
+            write_ppm(dir / "a.ppm", 16, 8),
+            write_ppm(dir / "b.ppm", 4, 4),
+            write_ppm(dir / "big.ppm", 80, 80),            // More than half a page.
+            (dir / "missing.ppm").string()
+        };
+
+        MockIRenderer renderer;
+        renderer.supports_create_texture = true;
+        Salix::TextureAtlas atlas;
+        CHECK(atlas.build(renderer, paths, {}, 128, 2) == 2);
+        CHECK(atlas.get_page_count() == 1);
+        CHECK(atlas.find(paths[2]) == nullptr);
+        CHECK(atlas.find(paths[3]) == nullptr);
+
+        Salix::ITexture* a = atlas.find(paths[0]);
+        Salix::ITexture* b = atlas.find(paths[1]);
+        REQUIRE(a != nullptr);
+        REQUIRE(b != nullptr);
+        Salix::ITexture* page = atlas.get_page(0);
+        CHECK(a->get_base_texture() == page);
+        CHECK(b->get_base_texture() == page);
+        CHECK(a->get_width() == 16);
+        CHECK(a->get_height() == 8);
+        CHECK(page->get_width() == 128);
+        CHECK(page->get_height() == 16);   // Trimmed to the power of two it needs.
+
+        const glm::vec4 uv = a->get_uv_rect();
+        CHECK(uv.z == doctest::Approx(16.0f / 128.0f));
+        CHECK(uv.w == doctest::Approx(8.0f / 16.0f));
+
+        // Sprites from one page share a single run.
+        Salix::SpriteBatch batch;
+        batch.begin();
+        batch.submit(a, glm::mat4(1.0f), Salix::Color(), 0);
+        batch.submit(b, glm::mat4(1.0f), Salix::Color(), 0);
+        batch.submit(a, glm::mat4(1.0f), Salix::Color(), 0);
+        batch.end();
+        REQUIRE(batch.get_runs().size() == 1);
+        CHECK(batch.get_runs()[0].texture == page);
+        CHECK(batch.get_instances()[1].uv_rect == b->get_uv_rect());
+
+        atlas.clear();
+        CHECK(atlas.get_region_count() == 0);
+        std::filesystem::remove_all(dir);
+    }
+
+    TEST_CASE("atlas images are read through the cooked cache") {
+        const std::filesystem::path dir = std::filesystem::temp_directory_path() / "salix_atlas_cache_test";
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+        const std::string cache_directory = (dir / "cache").string();
+        const std::vector<std::string> paths = { write_ppm(dir / "a.ppm", 8, 8), write_ppm(dir / "b.ppm", 4, 2) };
+
+        MockIRenderer renderer;
+        renderer.supports_create_texture = true;
+        Salix::TextureAtlas atlas;
+        CHECK(atlas.build(renderer, paths, cache_directory, 64, 1) == 2);
+
+        // The first build cooked both images, so the next one maps them.
+        Salix::TextureCache cache(cache_directory);
+        for (const std::string& path : paths) {
+            std::unique_ptr<Salix::CookedTexture> cooked = cache.open(path);
+            REQUIRE(cooked != nullptr);
+            CHECK(cooked->is_mapped());
+        }
+        CHECK(atlas.build(renderer, paths, cache_directory, 64, 1) == 2);
+        REQUIRE(atlas.find(paths[1]) != nullptr);
+        CHECK(atlas.find(paths[1])->get_width() == 4);
+        CHECK(atlas.find(paths[1])->get_height() == 2);
+
+        atlas.clear();
+        std::filesystem::remove_all(dir);
+    }
+
+    TEST_CASE("the asset manager reports which images the atlas holds") {
+        const std::filesystem::path dir = std::filesystem::temp_directory_path() / "salix_atlas_manager_test";
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+        const std::string a = write_ppm(dir / "a.ppm", 8, 8);
+        const std::string b = write_ppm(dir / "b.ppm", 4, 4);
+
+        MockIRenderer renderer;
+        renderer.supports_create_texture = true;
+        Salix::AssetManager asset_manager;
+        asset_manager.initialize(&renderer);
+        CHECK_FALSE(asset_manager.is_in_texture_atlas(a));
+
+        CHECK(asset_manager.build_texture_atlas({ a }) == 1);
+        CHECK(asset_manager.is_in_texture_atlas(a));
+        CHECK_FALSE(asset_manager.is_in_texture_atlas(b));
+        CHECK_FALSE(asset_manager.is_in_texture_atlas(""));
+
+        asset_manager.shutdown();
+        std::filesystem::remove_all(dir);
+    }
+}
@@ -0,0 +1,154 @@
+// =================================================================================
+// Filename:    src/Tests/SalixEngine/assets/TextureCache.test.cpp
+// Description: Contains unit tests and a cold-start benchmark for the cooked
+//              texture cache.
+// =================================================================================
+#include <doctest.h>
+#include <Salix/assets/TextureCache.h>
+#include <stb/stb_image.h>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+    struct TempDir {
+        std::filesystem::path path;
+        explicit TempDir(const std::string& name) : path(std::filesystem::temp_directory_path() / name) {
+            std::filesystem::remove_all(path);
+            std::filesystem::create_directories(path);
+        }
+        ~TempDir() {
+            std::error_code error;
+            std::filesystem::remove_all(path, error);
+        }
+    };
+
+    // The cache only looks at the source's size and write time, so any bytes will do.
+    std::string write_source(const std::filesystem::path& path, const std::string& contents) {
+        std::ofstream out(path.string(), std::ios::binary);
+        out << contents;
+        return path.string();
+    }
+}
+
+TEST_SUITE("Salix::assets::TextureCache") {
+    TEST_CASE("mip count goes down to 1x1") {
+        CHECK(Salix::TextureCache::get_mip_count_for(1, 1) == 1);
+        CHECK(Salix::TextureCache::get_mip_count_for(4, 2) == 3);
+        CHECK(Salix::TextureCache::get_mip_count_for(256, 256) == 9);
+        CHECK(Salix::TextureCache::get_mip_count_for(5, 3) == 3);
+    }
+
+    TEST_CASE("cooking converts to RGBA8 and builds the mip chain") {
+        // 2x2 RGB: red, green / blue, white.
+        const unsigned char pixels[] = { 255, 0, 0,   0, 255, 0,   0, 0, 255,   255, 255, 255 };
+        Salix::TextureCache cache("");
+        CHECK_FALSE(cache.is_enabled());
+
+        std::unique_ptr<Salix::CookedTexture> cooked = cache.cook("unused.png", pixels, 2, 2, 3);
+        REQUIRE(cooked != nullptr);
+        CHECK_FALSE(cooked->is_mapped());
+        CHECK(cooked->get_mip_count() == 2);
+        CHECK(cooked->get_data_size() == 2 * 2 * 4 + 4);
+
+        const unsigned char* base = cooked->get_mip_data(0);
+        CHECK(base[0] == 255);
+        CHECK(base[3] == 255);     // Alpha added.
+        CHECK(base[4 * 3 + 2] == 255);
+
+        const unsigned char* smallest = cooked->get_mip_data(1);
+        CHECK(cooked->get_mip_width(1) == 1);
+        CHECK(smallest[0] == 128);   // (255 + 0 + 0 + 255) / 4, rounded.
+        CHECK(smallest[1] == 128);
+        CHECK(smallest[2] == 128);
+        CHECK(smallest[3] == 255);
+    }
+
+    TEST_CASE("a cooked file is mapped back until its source changes") {
+        TempDir dir("salix_texture_cache_test");
+        const std::string source = write_source(dir.path / "image.png", "first");
+        Salix::TextureCache cache((dir.path / "cooked").string());
+
+        CHECK(cache.open(source) == nullptr);   // Nothing cooked yet.
+
+        const unsigned char pixels[] = { 10, 20, 30, 40,   50, 60, 70, 80 };
+        std::unique_ptr<Salix::CookedTexture> cooked = cache.cook(source, pixels, 2, 1, 4);
+        REQUIRE(cooked != nullptr);
+        CHECK(std::filesystem::exists(cache.get_cooked_path(source)));
+
+        std::unique_ptr<Salix::CookedTexture> mapped = cache.open(source);
+        REQUIRE(mapped != nullptr);
+        CHECK(mapped->is_mapped());
+        CHECK(mapped->get_width() == 2);
+        CHECK(mapped->get_height() == 1);
+        CHECK(mapped->get_mip_count() == cooked->get_mip_count());
+        CHECK(std::memcmp(mapped->get_mip_data(0), pixels, sizeof(pixels)) == 0);
+        CHECK(std::memcmp(mapped->get_mip_data(1), cooked->get_mip_data(1), 4) == 0);
+        mapped.reset();
+
+        write_source(dir.path / "image.png", "second, longer");
+        CHECK(cache.open(source) == nullptr);   // Stale.
+    }
+
+    TEST_CASE("sources in different folders get different cooked files") {
+        Salix::TextureCache cache("cache");
+        CHECK(cache.get_cooked_path("a/sprite.png") != cache.get_cooked_path("b/sprite.png"));
+        CHECK(cache.get_cooked_path("a/../a/sprite.png") == cache.get_cooked_path("a/sprite.png"));
+    }
+
+    // Cold start for a texture-heavy realm: decoding every source and building
+    // its mips versus mapping the cooked copies. The sources are uncompressed
+    // PPMs, so real PNGs (which also pay for inflate) widen the gap further.
+    // Run with --no-skip to include it.
+    TEST_CASE("benchmark: cold start from sources vs cooked cache" * doctest::skip()) {
+        constexpr int texture_count = 32;
+        constexpr int size = 512;
+        TempDir dir("salix_texture_cache_benchmark");
+        Salix::TextureCache cache((dir.path / "cooked").string());
+
+        std::vector<std::string> sources;
+        std::vector<char> pixels(static_cast<size_t>(size) * size * 3);
+        for (size_t i = 0; i < pixels.size(); ++i) pixels[i] = static_cast<char>(i * 7);
+        for (int i = 0; i < texture_count; ++i) {
+            std::filesystem::path path = dir.path / ("texture_" + std::to_string(i) + ".ppm");
+            std::ofstream out(path.string(), std::ios::binary);
+            out << "P6\n" << size << " " << size << "\n255\n";
+            out.write(pixels.data(), static_cast<std::streamsize>(pixels.size()));
+            sources.push_back(path.string());
+        }
+
+        using clock = std::chrono::high_resolution_clock;
+        size_t decoded_bytes = 0;
+        auto decode_start = clock::now();
+        for (const std::string& source : sources) {
+            int width = 0, height = 0, channels = 0;
+            unsigned char* data = stbi_load(source.c_str(), &width, &height, &channels, 0);
+            REQUIRE(data != nullptr);
+            decoded_bytes += cache.cook(source, data, width, height, channels)->get_data_size();   // Also fills the cache.
+            stbi_image_free(data);
+        }
+        auto decode_time = std::chrono::duration<double, std::milli>(clock::now() - decode_start).count();
+
+        size_t mapped_bytes = 0;
+        unsigned int checksum = 0;
+        auto mapped_start = clock::now();
+        for (const std::string& source : sources) {
+            std::unique_ptr<Salix::CookedTexture> cooked = cache.open(source);
+            REQUIRE(cooked != nullptr);
+            mapped_bytes += cooked->get_data_size();
+            const unsigned char* data = cooked->get_mip_data(0);
+            for (size_t i = 0; i < cooked->get_data_size(); i += 4096) checksum += data[i];   // Touch every page, as an upload would.
+        }
+        auto mapped_time = std::chrono::duration<double, std::milli>(clock::now() - mapped_start).count();
+
+        std::cout << "[benchmark] " << texture_count << " textures of " << size << "x" << size << "\n"
+                  << "  decode + mips + cook: " << decode_time << " ms\n"
+                  << "  map cooked:           " << mapped_time << " ms (checksum " << checksum << ")\n";
+        CHECK(mapped_bytes == decoded_bytes);
+    }
+}
@@ -31,5 +31,10 @@ TEST_SUITE("Salix::core::ApplicationConfig") {
         CHECK(config.gui_settings.dialog_height_ratio == doctest::Approx(0.75f));
         CHECK(config.gui_settings.font_scaling == doctest::Approx(1.0f));
         CHECK(config.gui_settings.global_dpi_scaling == doctest::Approx(1.0f));
+
+        // Check nested SimulationSettings members
+        CHECK(config.simulation.fixed_timestep == false);
+        CHECK(config.simulation.tick_rate == 60);
+        CHECK(config.simulation.max_catch_up_steps == 5);
     }
 }
\ No newline at end of file
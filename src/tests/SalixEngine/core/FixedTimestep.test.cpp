@@ -0,0 +1,50 @@
+// =================================================================================
+// Filename:    src/Tests/SalixEngine/core/FixedTimestep.test.cpp
+// Description: Contains unit tests for the FixedTimestep accumulator.
+// =================================================================================
+#include <doctest.h>
+#include <Salix/core/FixedTimestep.h>
+
+TEST_SUITE("Salix::core::FixedTimestep") {
+
+    TEST_CASE("defaults to 60 ticks per second") {
+        Salix::FixedTimestep timestep;
+        CHECK(timestep.get_tick_rate() == 60);
+        CHECK(timestep.get_step() == doctest::Approx(1.0f / 60.0f));
+        CHECK(timestep.get_alpha() == 0.0f);
+    }
+
+    TEST_CASE("accumulates frame time into whole ticks") {
+        Salix::FixedTimestep timestep(100);
+
+        // 25ms at 100Hz: two ticks, half a tick left over.
+        CHECK(timestep.advance(0.025f) == 2);
+        CHECK(timestep.get_alpha() == doctest::Approx(0.5f).epsilon(0.001));
+
+        // The leftover carries into the next frame.
+        CHECK(timestep.advance(0.005f) == 1);
+        CHECK(timestep.get_alpha() == doctest::Approx(0.0f).epsilon(0.001));
+
+        // Short frames can run no ticks at all.
+        CHECK(timestep.advance(0.004f) == 0);
+        CHECK(timestep.get_alpha() == doctest::Approx(0.4f).epsilon(0.001));
+    }
+
+    TEST_CASE("clamps catch-up after a stall and drops the backlog") {
+        Salix::FixedTimestep timestep(60, 4);
+
+        CHECK(timestep.advance(1.0f) == 4);
+        CHECK(timestep.get_dropped_time() == doctest::Approx(56.0 / 60.0).epsilon(0.001));
+        CHECK(timestep.get_alpha() < 1.0f);
+
+        // The following frame is back to normal rather than paying for the stall.
+        CHECK(timestep.advance(1.0f / 60.0f) == 1);
+    }
+
+    TEST_CASE("invalid settings are clamped") {
+        Salix::FixedTimestep timestep(0, 0);
+        CHECK(timestep.get_tick_rate() == 1);
+        CHECK(timestep.get_max_catch_up_steps() == 1);
+        CHECK(timestep.advance(-1.0f) == 0);
+    }
+}
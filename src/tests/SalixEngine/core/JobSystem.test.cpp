@@ -0,0 +1,80 @@
+// =================================================================================
+// Filename:    src/Tests/SalixEngine/core/JobSystem.test.cpp
+// Description: Contains unit tests for the work-stealing JobSystem.
+// =================================================================================
+#include <doctest.h>
+#include <Salix/core/JobSystem.h>
+#include <atomic>
+#include <vector>
+
+TEST_SUITE("Salix::core::JobSystem") {
+
+    TEST_CASE("parallel_for visits every index exactly once") {
+        Salix::JobSystem jobs(3);
+        CHECK(jobs.get_worker_count() == 3);
+
+        std::vector<std::atomic<int>> visits(1000);
+        jobs.parallel_for(visits.size(), [&visits](size_t i) {
+            visits[i].fetch_add(1);
+        });
+        bool all_once = true;
+        for (auto& count : visits) {
+            all_once = all_once && count.load() == 1;
+        }
+        CHECK(all_once);
+    }
+
+    TEST_CASE("a system without workers runs everything on the caller") {
+        Salix::JobSystem jobs(0);
+        CHECK(jobs.get_worker_count() == 0);
+
+        int sum = 0;
+        jobs.parallel_for(10, [&sum](size_t i) { sum += static_cast<int>(i); });
+        CHECK(sum == 45);
+
+        Salix::JobGroup group;
+        bool ran = false;
+        jobs.submit(group, [&ran]() { ran = true; });
+        jobs.wait(group);
+        CHECK(ran);
+        CHECK(group.is_done());
+    }
+
+    TEST_CASE("wait returns after all submitted jobs have finished") {
+        Salix::JobSystem jobs(2);
+        Salix::JobGroup group;
+        std::atomic<int> finished{0};
+        for (int i = 0; i < 200; ++i) {
+            jobs.submit(group, [&finished]() { finished.fetch_add(1); });
+        }
+        jobs.wait(group);
+        CHECK(finished.load() == 200);
+    }
+
+    TEST_CASE("jobs can run nested parallel work without deadlocking") {
+        Salix::JobSystem jobs(2);
+        std::atomic<int> inner_calls{0};
+        jobs.parallel_for(8, [&jobs, &inner_calls](size_t) {
+            jobs.parallel_for(8, [&inner_calls](size_t) { inner_calls.fetch_add(1); });
+        });
+        CHECK(inner_calls.load() == 64);
+    }
+
+    TEST_CASE("after shutdown the system keeps working without workers") {
+        Salix::JobSystem jobs(3);
+        Salix::JobGroup group;
+        std::atomic<int> finished{0};
+        for (int i = 0; i < 50; ++i) {
+            jobs.submit(group, [&finished]() { finished.fetch_add(1); });
+        }
+        jobs.shutdown();
+        jobs.wait(group);
+        CHECK(finished.load() == 50);
+        CHECK(jobs.get_worker_count() == 0);
+
+        std::atomic<int> calls{0};
+        jobs.parallel_for(10, [&calls](size_t) { calls.fetch_add(1); });
+        CHECK(calls.load() == 10);
+        jobs.shutdown();
+    }
+}
@@ -0,0 +1,77 @@
+// =================================================================================
+// Filename:    src/Tests/SalixEngine/core/PoolAllocator.test.cpp
+// Description: Contains unit tests for the size-class PoolAllocator.
+// =================================================================================
+#include <doctest.h>
+#include <Salix/core/PoolAllocator.h>
+#include <cstdint>
+#include <vector>
+
+TEST_SUITE("Salix::core::PoolAllocator") {
+
+    TEST_CASE("blocks are aligned and recycled per size class") {
+        void* first = Salix::PoolAllocator::allocate(40);
+        REQUIRE(first != nullptr);
+        CHECK(reinterpret_cast<std::uintptr_t>(first) % Salix::PoolAllocator::POOL_GRANULARITY == 0);
+
+        Salix::PoolAllocator::deallocate(first, 40);
+        // 33..48 bytes share a size class, so the freed block comes straight back.
+        void* second = Salix::PoolAllocator::allocate(48);
+        CHECK(second == first);
+        Salix::PoolAllocator::deallocate(second, 48);
+    }
+
+    TEST_CASE("counters track pool traffic and system allocations") {
+        constexpr std::size_t block_size = 208;
+        Salix::PoolAllocator::reset_stats();
+        Salix::PoolStats before = Salix::PoolAllocator::get_stats_for_size(block_size);
+
+        std::vector<void*> blocks;
+        for (int i = 0; i < 10; ++i) {
+            blocks.push_back(Salix::PoolAllocator::allocate(block_size));
+        }
+        Salix::PoolStats during = Salix::PoolAllocator::get_stats_for_size(block_size);
+        CHECK(during.allocations == 10);
+        CHECK(during.live_blocks == before.live_blocks + 10);
+
+        for (void* block : blocks) {
+            Salix::PoolAllocator::deallocate(block, block_size);
+        }
+        const uint64_t warm_system_allocations = Salix::PoolAllocator::get_stats_for_size(block_size).system_allocations;
+
+        // The same churn again must be served entirely from the free list.
+        blocks.clear();
+        for (int i = 0; i < 10; ++i) {
+            blocks.push_back(Salix::PoolAllocator::allocate(block_size));
+        }
+        for (void* block : blocks) {
+            Salix::PoolAllocator::deallocate(block, block_size);
+        }
+        Salix::PoolStats after = Salix::PoolAllocator::get_stats_for_size(block_size);
+        CHECK(after.system_allocations == warm_system_allocations);
+        CHECK(after.deallocations == 20);
+        CHECK(after.live_blocks == before.live_blocks);
+    }
+
+    TEST_CASE("oversize requests fall through to the system heap") {
+        const std::size_t big = Salix::PoolAllocator::MAX_POOLED_SIZE + 1;
+        Salix::PoolAllocator::reset_stats();
+        const uint64_t heap_before = Salix::PoolAllocator::get_thread_heap_allocations();
+        void* block = Salix::PoolAllocator::allocate(big);
+        REQUIRE(block != nullptr);
+        CHECK(Salix::PoolAllocator::get_stats_for_size(big).system_allocations == 1);
+        // Test builds count the operator new call behind it.
+        CHECK(Salix::PoolAllocator::get_thread_heap_allocations() == heap_before + 1);
+        Salix::PoolAllocator::deallocate(block, big);
+        CHECK(Salix::PoolAllocator::get_stats_for_size(big).deallocations == 1);
+    }
+
+    TEST_CASE("std containers can use the pool") {
+        std::vector<int, Salix::PoolStdAllocator<int>> values;
+        for (int i = 0; i < 100; ++i) {
+            values.push_back(i);
+        }
+        CHECK(values.size() == 100);
+        CHECK(values[99] == 99);
+    }
+}
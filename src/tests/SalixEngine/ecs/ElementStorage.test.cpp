@@ -0,0 +1,193 @@
+// =================================================================================
+// Filename:    src/Tests/SalixEngine/ecs/ElementStorage.test.cpp
+// Description: Contains unit tests and a layout benchmark for the chunked
+//              structure-of-arrays ElementStorage.
+// =================================================================================
+
+#include <doctest.h>
+#include <Salix/ecs/ElementStorage.h>
+#include <Salix/ecs/Entity.h>
+#include <Salix/ecs/Transform.h>
+#include <Salix/ecs/BoxCollider.h>
+#include <Salix/ecs/Sprite2D.h>
+#include <Salix/math/Vector3.h>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+
+TEST_SUITE("Salix::ecs::ElementStorage") {
+
+    TEST_CASE("released slots are reused before new ones are handed out") {
+        Salix::ChunkedElementStorage<Salix::BoxColliderChunk> storage;
+        Salix::BoxCollider* owner = reinterpret_cast<Salix::BoxCollider*>(0x1);
+
+        uint32_t first = storage.allocate(owner);
+        uint32_t second = storage.allocate(owner);
+        CHECK(first == 0);
+        CHECK(second == 1);
+        CHECK(storage.get_live_count() == 2);
+
+        storage.release(first);
+        CHECK(storage.get_live_count() == 1);
+        CHECK(storage.allocate(owner) == first);
+        CHECK(storage.get_chunk_count() == 1);
+    }
+
+    TEST_CASE("storage grows by whole chunks and keeps earlier chunks in place") {
+        Salix::ChunkedElementStorage<Salix::BoxColliderChunk> storage;
+        Salix::BoxCollider* owner = reinterpret_cast<Salix::BoxCollider*>(0x1);
+
+        uint32_t first = storage.allocate(owner);
+        Salix::Vector3* first_size = &storage.get_chunk_of(first).sizes[storage.get_index_in_chunk(first)];
+        for (uint32_t i = 1; i < Salix::ELEMENT_CHUNK_CAPACITY + 1; ++i) {
+            storage.allocate(owner);
+        }
+
+        CHECK(storage.get_chunk_count() == 2);
+        CHECK(storage.get_used_in_chunk(1) == 1);
+        CHECK(first_size == &storage.get_chunk_of(first).sizes[storage.get_index_in_chunk(first)]);
+    }
+
+    TEST_CASE("for_each_live skips released slots") {
+        Salix::ChunkedElementStorage<Salix::BoxColliderChunk> storage;
+        Salix::BoxCollider* owner = reinterpret_cast<Salix::BoxCollider*>(0x1);
+        storage.allocate(owner);
+        uint32_t middle = storage.allocate(owner);
+        storage.allocate(owner);
+        storage.release(middle);
+
+        int visited = 0;
+        storage.for_each_live([&](Salix::BoxColliderChunk&, uint32_t) { ++visited; });
+        CHECK(visited == 2);
+    }
+
+    TEST_CASE("chunks can be read while other threads grow the storage") {
+        Salix::ChunkedElementStorage<Salix::BoxColliderChunk> storage;
+        Salix::BoxCollider* owner = reinterpret_cast<Salix::BoxCollider*>(0x1);
+        const uint32_t first = storage.allocate(owner);
+        Salix::BoxColliderChunk* first_chunk = &storage.get_chunk_of(first);
+
+        std::vector<std::thread> writers;
+        for (int t = 0; t < 4; ++t) {
+            writers.emplace_back([&] {
+                for (uint32_t i = 0; i < Salix::ELEMENT_CHUNK_CAPACITY * 4; ++i) storage.allocate(owner);
+            });
+        }
+        size_t seen = 0;
+        for (int pass = 0; pass < 50; ++pass) {
+            CHECK(&storage.get_chunk_of(first) == first_chunk);
+            storage.for_each_live([&](Salix::BoxColliderChunk&, uint32_t) { ++seen; });
+        }
+        for (auto& writer : writers) writer.join();
+
+        CHECK(seen > 0);
+        CHECK(storage.get_live_count() == 1 + 4 * Salix::ELEMENT_CHUNK_CAPACITY * 4);
+        CHECK(storage.get_chunk_count() == 17);
+    }
+
+    TEST_CASE("built-in elements keep their data in the shared chunks") {
+        Salix::Entity entity;
+        Salix::Transform* transform = entity.get_transform();
+        Salix::BoxCollider* collider = entity.get_element<Salix::BoxCollider>();
+        Salix::Sprite2D* sprite = entity.add_element<Salix::Sprite2D>();
+        REQUIRE(transform != nullptr);
+        REQUIRE(collider != nullptr);
+
+        transform->set_position(1.0f, 2.0f, 3.0f);
+        collider->set_size(Salix::Vector3(4.0f, 5.0f, 6.0f));
+        sprite->sorting_layer = 7;
+        sprite->color = Salix::Black;
+
+        Salix::ElementStorage& storage = Salix::ElementStorage::get();
+
+        uint32_t t_slot = transform->get_storage_slot();
+        auto& t_chunk = storage.transforms().get_chunk_of(t_slot);
+        CHECK(&t_chunk.positions[Salix::ChunkedElementStorage<Salix::TransformChunk>::get_index_in_chunk(t_slot)] == &transform->get_position());
+
+        uint32_t c_slot = collider->get_storage_slot();
+        auto& c_chunk = storage.box_colliders().get_chunk_of(c_slot);
+        CHECK(c_chunk.sizes[Salix::ChunkedElementStorage<Salix::BoxColliderChunk>::get_index_in_chunk(c_slot)] == Salix::Vector3(4.0f, 5.0f, 6.0f));
+
+        uint32_t s_slot = sprite->get_storage_slot();
+        auto& s_chunk = storage.sprites().get_chunk_of(s_slot);
+        uint32_t s_index = Salix::ChunkedElementStorage<Salix::Sprite2DChunk>::get_index_in_chunk(s_slot);
+        CHECK(s_chunk.sorting_layers[s_index] == 7);
+        CHECK(s_chunk.colors[s_index] == Salix::Black);
+        CHECK(s_chunk.owners[s_index] == sprite);
+    }
+
+    TEST_CASE("destroying an element frees its slot") {
+        Salix::ElementStorage& storage = Salix::ElementStorage::get();
+        uint32_t live_before = storage.transforms().get_live_count();
+        {
+            Salix::Transform transform;
+            CHECK(storage.transforms().get_live_count() == live_before + 1);
+        }
+        CHECK(storage.transforms().get_live_count() == live_before);
+
+        // A recycled slot must come back with default values.
+        uint32_t reused_slot;
+        {
+            Salix::Transform transform;
+            transform.set_position(9.0f, 9.0f, 9.0f);
+            reused_slot = transform.get_storage_slot();
+        }
+        Salix::Transform fresh;
+        CHECK(fresh.get_storage_slot() == reused_slot);
+        CHECK(fresh.get_position() == Salix::Vector3(0.0f, 0.0f, 0.0f));
+        CHECK(fresh.get_scale() == Salix::Vector3(1.0f, 1.0f, 1.0f));
+    }
+
+
+    // Compares a transform-data sweep over the old layout (one heap-allocated
+    // object plus one heap-allocated pimpl per element) with a sweep over the
+    // chunked arrays. Run with --no-skip to include it.
+    TEST_CASE("benchmark: SoA chunks vs per-element pimpl layout" * doctest::skip()) {
+        constexpr int entity_count = 50000;
+        constexpr int iterations = 50;
+
+        struct LegacyTransformPimpl { Salix::Vector3 position; Salix::Vector3 rotation; Salix::Vector3 scale; };
+        struct LegacyTransform { std::unique_ptr<LegacyTransformPimpl> pimpl = std::make_unique<LegacyTransformPimpl>(); };
+
+        std::vector<std::unique_ptr<LegacyTransform>> legacy;
+        std::vector<std::unique_ptr<Salix::Transform>> chunked;
+        std::vector<std::unique_ptr<int>> heap_noise;  // Interleaved so the legacy objects are not neighbours.
+        legacy.reserve(entity_count);
+        chunked.reserve(entity_count);
+        for (int i = 0; i < entity_count; ++i) {
+            legacy.push_back(std::make_unique<LegacyTransform>());
+            heap_noise.push_back(std::make_unique<int>(i));
+            chunked.push_back(std::make_unique<Salix::Transform>());
+        }
+
+        using clock = std::chrono::high_resolution_clock;
+        float legacy_sum = 0.0f;
+        auto legacy_start = clock::now();
+        for (int it = 0; it < iterations; ++it) {
+            for (auto& t : legacy) {
+                t->pimpl->position.x += 1.0f;
+                legacy_sum += t->pimpl->position.x;
+            }
+        }
+        auto legacy_time = std::chrono::duration<double, std::milli>(clock::now() - legacy_start).count();
+
+        float chunked_sum = 0.0f;
+        auto& storage = Salix::ElementStorage::get().transforms();
+        auto chunked_start = clock::now();
+        for (int it = 0; it < iterations; ++it) {
+            storage.for_each_live([&](Salix::TransformChunk& chunk, uint32_t i) {
+                chunk.positions[i].x += 1.0f;
+                chunked_sum += chunk.positions[i].x;
+            });
+        }
+        auto chunked_time = std::chrono::duration<double, std::milli>(clock::now() - chunked_start).count();
+
+        std::cout << "[benchmark] " << entity_count << " transforms x " << iterations << " sweeps\n"
+                  << "  pimpl layout: " << legacy_time << " ms (checksum " << legacy_sum << ")\n"
+                  << "  SoA chunks:   " << chunked_time << " ms (checksum " << chunked_sum << ")\n";
+        CHECK(chunked_sum > 0.0f);
+    }
+}
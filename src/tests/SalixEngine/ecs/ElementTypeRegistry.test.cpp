@@ -0,0 +1,234 @@
+// =================================================================================
+// Filename:    src/Tests/SalixEngine/ecs/ElementTypeRegistry.test.cpp
+// Description: Contains unit tests for element type IDs and the constant-time
+//              typed element lookup in Entity, plus a lookup microbenchmark.
+// =================================================================================
+
+#include <doctest.h>
+#include <Salix/ecs/ElementTypeRegistry.h>
+#include <Salix/ecs/Entity.h>
+#include <Salix/ecs/Transform.h>
+#include <Salix/ecs/BoxCollider.h>
+#include <Salix/ecs/Sprite2D.h>
+#include <Salix/ecs/Camera.h>
+#include <Salix/ecs/RenderableElement.h>
+#include <Salix/rendering/ICamera.h>
+#include <cereal/archives/json.hpp>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+
+namespace {
+    class LookupTestElement : public Salix::Element {
+    public:
+        const char* get_class_name() const override { return "LookupTestElement"; }
+    };
+
+    class DerivedLookupTestElement : public LookupTestElement {
+    public:
+        const char* get_class_name() const override { return "DerivedLookupTestElement"; }
+    };
+
+    // Only ever looked up after an entity already holds a subclass.
+    class LateLookupTestElement : public Salix::Element {
+    public:
+        const char* get_class_name() const override { return "LateLookupTestElement"; }
+    };
+
+    class DerivedLateLookupTestElement : public LateLookupTestElement {
+    public:
+        const char* get_class_name() const override { return "DerivedLateLookupTestElement"; }
+    };
+}
+
+
+TEST_SUITE("Salix::ecs::ElementTypeRegistry") {
+
+    TEST_CASE("built-in element types have their fixed IDs") {
+        CHECK(Salix::ElementTypeRegistry::get_id(typeid(Salix::Transform)) == Salix::TRANSFORM_TYPE_ID);
+        CHECK(Salix::ElementTypeRegistry::get_id(typeid(Salix::BoxCollider)) == Salix::BOX_COLLIDER_TYPE_ID);
+        CHECK(Salix::ElementTypeRegistry::get_id(typeid(Salix::Sprite2D)) == Salix::SPRITE2D_TYPE_ID);
+        CHECK(Salix::ElementTypeRegistry::get_id(typeid(Salix::Camera)) == Salix::CAMERA_TYPE_ID);
+        CHECK(Salix::ElementTypeIdOf<Salix::Transform>::get() == Salix::TRANSFORM_TYPE_ID);
+    }
+
+    TEST_CASE("other types get a stable ID on first use") {
+        Salix::ElementTypeId first = Salix::ElementTypeIdOf<LookupTestElement>::get();
+        CHECK(first != Salix::INVALID_ELEMENT_TYPE_ID);
+        CHECK(first == Salix::ElementTypeRegistry::get_id(typeid(LookupTestElement)));
+        CHECK(first != Salix::ElementTypeIdOf<DerivedLookupTestElement>::get());
+    }
+
+    TEST_CASE("class names map back to their type IDs") {
+        const Salix::ElementClassNameIds& ids = Salix::ElementTypeRegistry::get_ids_for_class_name("Transform");
+        REQUIRE(ids.size() == 1);
+        CHECK(ids[0] == Salix::TRANSFORM_TYPE_ID);
+        CHECK_FALSE(ids.has_unmapped());
+        CHECK(Salix::ElementTypeRegistry::get_ids_for_class_name("NoSuchElement").size() == 0);
+
+        // The list is interned: every lookup returns the same one, and it grows
+        // in place when another type registers the name.
+        CHECK(&Salix::ElementTypeRegistry::get_ids_for_class_name(std::string("Transform")) == &ids);
+        const Salix::ElementClassNameIds& shared = Salix::ElementTypeRegistry::get_ids_for_class_name("SharedLookupName");
+        CHECK(shared.size() == 0);
+        Salix::ElementTypeRegistry::register_class(typeid(LookupTestElement), "SharedLookupName");
+        Salix::ElementTypeRegistry::register_class(typeid(DerivedLookupTestElement), "SharedLookupName");
+        const Salix::ElementClassNameIds& registered = Salix::ElementTypeRegistry::get_ids_for_class_name("SharedLookupName");
+        REQUIRE(registered.size() == 2);
+        CHECK(registered[0] == Salix::ElementTypeIdOf<LookupTestElement>::get());
+        CHECK(registered[1] == Salix::ElementTypeIdOf<DerivedLookupTestElement>::get());
+        CHECK(&Salix::ElementTypeRegistry::get_ids_for_class_name("SharedLookupName") == &registered);
+    }
+
+    TEST_CASE("built-in element types are matched from the start") {
+        // Their matchers predate any entity, so no slot table is ever filled
+        // without them.
+        const Salix::ElementTypeId first_epoch = Salix::CAMERA_TYPE_ID + 1;
+        CHECK(Salix::ElementTypeRegistry::has_matcher_at(Salix::TRANSFORM_TYPE_ID, first_epoch));
+        CHECK(Salix::ElementTypeRegistry::has_matcher_at(Salix::BOX_COLLIDER_TYPE_ID, first_epoch));
+        CHECK(Salix::ElementTypeRegistry::has_matcher_at(Salix::SPRITE2D_TYPE_ID, first_epoch));
+        CHECK(Salix::ElementTypeRegistry::has_matcher_at(Salix::CAMERA_TYPE_ID, first_epoch));
+
+        const Salix::ElementMatcher sprite_matcher =
+            Salix::ElementTypeRegistry::get_matcher(Salix::SPRITE2D_TYPE_ID, first_epoch);
+        REQUIRE(sprite_matcher != nullptr);
+        Salix::Sprite2D sprite;
+        Salix::Transform transform;
+        CHECK(sprite_matcher(&sprite));
+        CHECK_FALSE(sprite_matcher(&transform));
+    }
+
+    TEST_CASE("entity keeps a bitmask of its concrete element types") {
+        Salix::Entity entity;
+        Salix::ElementTypeMask expected = Salix::element_type_bit(Salix::TRANSFORM_TYPE_ID) |
+                                          Salix::element_type_bit(Salix::BOX_COLLIDER_TYPE_ID);
+        CHECK(entity.get_element_mask() == expected);
+
+        entity.add_element<Salix::Sprite2D>();
+        CHECK((entity.get_element_mask() & Salix::element_type_bit(Salix::SPRITE2D_TYPE_ID)) != 0);
+    }
+
+    TEST_CASE("lookups through base classes and interfaces still work") {
+        Salix::Entity entity;
+        CHECK(entity.get_element<Salix::RenderableElement>() == nullptr);
+        CHECK(entity.get_element<Salix::ICamera>() == nullptr);
+
+        // Adding elements must invalidate the cached "not present" answers above.
+        Salix::Sprite2D* sprite = entity.add_element<Salix::Sprite2D>();
+        Salix::Camera* camera = entity.add_element<Salix::Camera>();
+
+        CHECK(entity.get_element<Salix::RenderableElement>() == sprite);
+        CHECK(entity.get_element<Salix::ICamera>() == static_cast<Salix::ICamera*>(camera));
+        CHECK(entity.get_element<Salix::Camera>() == camera);
+    }
+
+    TEST_CASE("a derived element satisfies a query for its base type") {
+        Salix::Entity entity;
+        CHECK(entity.has_element<LookupTestElement>() == false);
+
+        auto* derived = entity.add_element<DerivedLookupTestElement>();
+        CHECK(entity.get_element<LookupTestElement>() == derived);
+        CHECK(entity.get_element_by_type_name("DerivedLookupTestElement") == derived);
+        CHECK(entity.get_element_by_type_name("LookupTestElement") == nullptr);
+    }
+
+    TEST_CASE("lookups only read the entity, even for a type first queried late") {
+        Salix::Entity entity;
+        auto* derived = entity.add_element<DerivedLateLookupTestElement>();
+
+        // Many threads ask at once; none of them may fill the table.
+        std::atomic<int> found{0};
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 4; ++t) {
+            readers.emplace_back([&] {
+                for (int i = 0; i < 1000; ++i) {
+                    if (entity.get_element<LateLookupTestElement>() == derived &&
+                        entity.get_element<Salix::Transform>() != nullptr) {
+                        ++found;
+                    }
+                }
+            });
+        }
+        for (auto& reader : readers) reader.join();
+        CHECK(found == 4000);
+
+        // The next add refills the table with the new type in it.
+        entity.add_element<Salix::Sprite2D>();
+        CHECK(entity.get_element<LateLookupTestElement>() == derived);
+        CHECK(entity.get_element_by_type_name("DerivedLateLookupTestElement") == derived);
+    }
+
+    TEST_CASE("lookup table follows deserialized elements") {
+        std::stringstream stream;
+        {
+            Salix::Entity original;
+            original.add_element<Salix::Sprite2D>()->sorting_layer = 4;
+            cereal::JSONOutputArchive out_archive(stream);
+            out_archive(original);
+        }
+
+        Salix::Entity loaded;
+        {
+            cereal::JSONInputArchive in_archive(stream);
+            in_archive(loaded);
+        }
+        Salix::Sprite2D* sprite = loaded.get_element<Salix::Sprite2D>();
+        REQUIRE(sprite != nullptr);
+        CHECK(sprite->sorting_layer == 4);
+        CHECK(loaded.get_element_by_type_name("Sprite2D") == sprite);
+        CHECK(loaded.get_all_elements().size() == 3);
+    }
+
+
+    // Compares the slot-table lookup with the previous implementation, which
+    // copied the element list and dynamic_cast every entry. Run with --no-skip.
+    TEST_CASE("benchmark: typed element lookup vs dynamic_cast scan" * doctest::skip()) {
+        constexpr int lookups = 1000000;
+        Salix::Entity entity;
+        entity.add_element<Salix::Camera>();
+        entity.add_element<Salix::Sprite2D>();
+
+        using clock = std::chrono::high_resolution_clock;
+        size_t scan_hits = 0;
+        auto scan_start = clock::now();
+        for (int i = 0; i < lookups; ++i) {
+            for (Salix::Element* element : entity.get_all_elements()) {
+                if (dynamic_cast<Salix::Sprite2D*>(element)) {
+                    ++scan_hits;
+                    break;
+                }
+            }
+        }
+        auto scan_time = std::chrono::duration<double, std::milli>(clock::now() - scan_start).count();
+
+        size_t slot_hits = 0;
+        auto slot_start = clock::now();
+        for (int i = 0; i < lookups; ++i) {
+            if (entity.get_element<Salix::Sprite2D>()) {
+                ++slot_hits;
+            }
+        }
+        auto slot_time = std::chrono::duration<double, std::milli>(clock::now() - slot_start).count();
+
+        size_t name_hits = 0;
+        const std::string type_name = "Sprite2D";
+        auto name_start = clock::now();
+        for (int i = 0; i < lookups; ++i) {
+            if (entity.get_element_by_type_name(type_name)) {
+                ++name_hits;
+            }
+        }
+        auto name_time = std::chrono::duration<double, std::milli>(clock::now() - name_start).count();
+
+        std::cout << "[benchmark] " << lookups << " get_element<Sprite2D>() calls\n"
+                  << "  copy + dynamic_cast scan: " << scan_time << " ms\n"
+                  << "  slot table:               " << slot_time << " ms\n"
+                  << "  by type name:             " << name_time << " ms\n";
+        CHECK(scan_hits == slot_hits);
+        CHECK(name_hits == slot_hits);
+    }
+}
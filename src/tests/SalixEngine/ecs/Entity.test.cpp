@@ -10,6 +10,7 @@
 #include <Salix/ecs/BoxCollider.h>
 #include <Salix/core/SimpleGuid.h>
 #include <Salix/ecs/Sprite2D.h>
+#include <Salix/ecs/Camera.h>
 #include <cereal/archives/json.hpp>
 #include <Salix/rendering/IRenderer.h>
 #include <Salix/assets/AssetManager.h>
@@ -181,6 +182,25 @@ TEST_SUITE("Salix::ecs::Entity") {
             CHECK(cameras.empty() == true);
         }
 
+        SUBCASE("visiting every element of a type") {
+            Salix::Sprite2D* first = entity.add_element<Salix::Sprite2D>();
+            Salix::Sprite2D* second = entity.add_element<Salix::Sprite2D>();
+
+            std::vector<Salix::Sprite2D*> visited;
+            entity.for_each_element<Salix::Sprite2D>([&visited](Salix::Sprite2D& sprite) { visited.push_back(&sprite); });
+            REQUIRE(visited.size() == 2);
+            CHECK(visited[0] == first);
+            CHECK(visited[1] == second);
+
+            // Base types match too; absent types are never called.
+            int renderables = 0;
+            entity.for_each_element<Salix::RenderableElement>([&renderables](Salix::RenderableElement&) { ++renderables; });
+            CHECK(renderables == 2);
+            bool called = false;
+            entity.for_each_element<Salix::Camera>([&called](Salix::Camera&) { called = true; });
+            CHECK_FALSE(called);
+        }
+
          SUBCASE("purging a parent orphans its immediate children") {
             // ARRANGE
             Salix::Entity parent;
@@ -0,0 +1,151 @@
+// =================================================================================
+// Filename:    src/Tests/SalixEngine/ecs/EntityCommandBuffer.test.cpp
+// Description: Contains unit tests for deferred structural changes recorded in
+//              an EntityCommandBuffer and applied by the Realm.
+// =================================================================================
+
+#include <doctest.h>
+#include <Salix/ecs/EntityCommandBuffer.h>
+#include <Salix/ecs/Realm.h>
+#include <Salix/ecs/Entity.h>
+#include <Salix/ecs/Element.h>
+#include <Salix/ecs/Sprite2D.h>
+#include <Salix/core/InitContext.h>
+#include <Salix/core/JobSystem.h>
+#include <Salix/events/EventManager.h>
+#include <Salix/events/IEventListener.h>
+#include <Salix/events/BeforeEntityPurgedEvent.h>
+#include <Salix/assets/AssetManager.h>
+#include <Tests/SalixEngine/mocking/rendering/MockIRenderer.h>
+#include <memory>
+
+
+namespace {
+    // Spawns one child entity through the command buffer every update.
+    class SpawnerElement : public Salix::Element {
+    public:
+        const char* get_class_name() const override { return "SpawnerElement"; }
+        bool is_update_thread_safe() const override { return thread_safe; }
+        bool wants_parallel_update() const override { return thread_safe; }
+        void update(float) override {
+            Salix::EntityCommandBuffer& commands = owner->get_realm()->get_command_buffer();
+            auto spawned = commands.create_entity("Spawned");
+            commands.set_parent(spawned, owner);
+        }
+        bool thread_safe = false;
+    };
+
+    class PurgeListener : public Salix::IEventListener {
+    public:
+        void on_event(Salix::IEvent& event) override {
+            if (event.get_event_type() == Salix::EventType::BeforeEntityPurged) {
+                ++event_count;
+                entity_count += static_cast<Salix::BeforeEntityPurgedEvent&>(event).entities.size();
+            }
+        }
+        int event_count = 0;
+        size_t entity_count = 0;
+    };
+}
+
+
+TEST_SUITE("Salix::ecs::EntityCommandBuffer") {
+
+    TEST_CASE("commands are deferred until the buffer is applied") {
+        Salix::Realm realm;
+        Salix::Entity* parent = realm.create_entity("Parent");
+        Salix::EntityCommandBuffer commands;
+
+        auto child = commands.create_entity("Child");
+        commands.set_parent(child, parent);
+        commands.add_element<Salix::Sprite2D>(child);
+        CHECK(commands.get_command_count() == 3);
+        CHECK(realm.get_entity_by_name("Child") == nullptr);
+
+        commands.apply(realm);
+        CHECK(commands.is_empty());
+        Salix::Entity* created = realm.get_entity_by_name("Child");
+        REQUIRE(created != nullptr);
+        CHECK(created->get_parent() == parent);
+        CHECK(created->has_element<Salix::Sprite2D>());
+    }
+
+    TEST_CASE("destroy purges on apply and commands on purged entities are skipped") {
+        Salix::Realm realm;
+        Salix::Entity* doomed = realm.create_entity("Doomed");
+        Salix::EntityCommandBuffer commands;
+
+        commands.destroy_entity(doomed);
+        commands.add_element<Salix::Sprite2D>(doomed);
+        commands.apply(realm);
+        CHECK(doomed->is_purged());
+        CHECK(doomed->has_element<Salix::Sprite2D>() == false);
+    }
+
+    TEST_CASE("appended buffers keep their pending entity references") {
+        Salix::Realm realm;
+        Salix::EntityCommandBuffer first;
+        Salix::EntityCommandBuffer second;
+        first.create_entity("A");
+        auto parent = second.create_entity("B");
+        auto child = second.create_entity("C");
+        second.set_parent(child, parent);
+
+        first.append(std::move(second));
+        CHECK(second.is_empty());
+        first.apply(realm);
+        CHECK(realm.get_entity_by_name("C")->get_parent() == realm.get_entity_by_name("B"));
+    }
+
+    TEST_CASE("entities can be spawned from inside Realm::update") {
+        Salix::JobSystem jobs(2);
+        for (bool thread_safe : { false, true }) {
+            Salix::Realm realm;
+            realm.set_job_system(&jobs);
+            for (int i = 0; i < 100; ++i) {
+                // The entity reads the flags when the element is added.
+                auto spawner = std::make_unique<SpawnerElement>();
+                spawner->thread_safe = thread_safe;
+                realm.create_entity("Spawner")->add_element(std::move(spawner));
+            }
+            realm.update(0.016f);
+
+            // Spawned entities exist after the update, each under its spawner.
+            size_t spawned = 0;
+            bool parented = true;
+            for (Salix::Entity* entity : realm.get_entities()) {
+                if (entity->get_name() != "Spawned") continue;
+                ++spawned;
+                parented = parented && entity->get_parent() && entity->get_parent()->get_name() == "Spawner";
+            }
+            CHECK(spawned == 100);
+            CHECK(parented);
+        }
+    }
+
+    TEST_CASE("maintain sends a single purge event for the whole batch") {
+        Salix::EventManager events;
+        PurgeListener listener;
+        events.subscribe(Salix::EventCategory::Editor, &listener);
+        // Realm::set_context() ignores contexts without an AssetManager.
+        MockIRenderer mock_renderer;
+        Salix::AssetManager asset_manager;
+        asset_manager.initialize(&mock_renderer);
+        Salix::InitContext context;
+        context.asset_manager = &asset_manager;
+        context.event_manager = &events;
+
+        Salix::Realm realm;
+        realm.set_context(context);
+        for (int i = 0; i < 10; ++i) {
+            realm.get_command_buffer().destroy_entity(realm.create_entity("Temp"));
+        }
+        realm.maintain();
+        events.process_queue();
+
+        CHECK(listener.event_count == 1);
+        CHECK(listener.entity_count == 10);
+        CHECK(realm.get_entities().empty());
+        events.unsubscribe(Salix::EventCategory::Editor, &listener);
+    }
+}
@@ -0,0 +1,518 @@
+// =================================================================================
+// Filename:    src/Tests/SalixEngine/ecs/Realm.test.cpp
+// Description: Contains unit tests for Realm entity lookups, generational
+//              entity handles, pooled entity allocation, views and the JSON
+//              and binary realm files, plus a load-time benchmark.
+// =================================================================================
+
+#include <doctest.h>
+#include <Salix/ecs/Realm.h>
+#include <Salix/ecs/RealmView.h>
+#include <Salix/ecs/Entity.h>
+#include <Salix/ecs/EntityHandle.h>
+#include <Salix/ecs/Sprite2D.h>
+#include <Salix/ecs/Transform.h>
+#include <Salix/ecs/BoxCollider.h>
+#include <Salix/ecs/ElementTypeRegistry.h>
+#include <Salix/core/SimpleGuid.h>
+#include <Salix/core/PoolAllocator.h>
+#include <Salix/core/JobSystem.h>
+#include <Salix/events/EventManager.h>
+#include <Salix/events/IEventListener.h>
+#include <Salix/core/InitContext.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+namespace {
+    class UpdateOrderEvent : public Salix::IEvent {
+    public:
+        explicit UpdateOrderEvent(int value) : value(value) {}
+        Salix::EventType get_event_type() const override { return Salix::EventType::AppUpdate; }
+        const char* get_name() const override { return "UpdateOrderEvent"; }
+        int get_category_flags() const override { return static_cast<int>(Salix::EventCategory::Application); }
+        std::unique_ptr<Salix::IEvent> clone() const override { return std::make_unique<UpdateOrderEvent>(*this); }
+        int value;
+    };
+
+    class UpdateOrderListener : public Salix::IEventListener {
+    public:
+        void on_event(Salix::IEvent& event) override {
+            values.push_back(static_cast<UpdateOrderEvent&>(event).value);
+        }
+        std::vector<int> values;
+    };
+
+    // Safe to update on a worker: only touches itself, reports through events.
+    class WorkerElement : public Salix::Element {
+    public:
+        const char* get_class_name() const override { return "WorkerElement"; }
+        bool is_update_thread_safe() const override { return true; }
+        bool wants_parallel_update() const override { return true; }
+        void update(float) override {
+            ++updates;
+            events->dispatch(std::make_unique<UpdateOrderEvent>(value));
+        }
+        Salix::EventManager* events = nullptr;
+        int value = 0;
+        int updates = 0;
+    };
+
+    // Only registered, never instantiated; they use up the element mask bits.
+    template<size_t N> struct FillerType {};
+    template<size_t... Ns>
+    void register_filler_types(std::index_sequence<Ns...>) {
+        (Salix::ElementTypeRegistry::register_class(typeid(FillerType<Ns>), "FillerType"), ...);
+    }
+
+    class UnmappedElement : public Salix::Element {
+    public:
+        const char* get_class_name() const override { return "UnmappedElement"; }
+    };
+
+    // Keeps the default (not thread-safe), so it must run on the calling thread.
+    class MainThreadElement : public Salix::Element {
+    public:
+        const char* get_class_name() const override { return "MainThreadElement"; }
+        void update(float) override { update_thread = std::this_thread::get_id(); }
+        std::thread::id update_thread;
+    };
+}
+
+
+TEST_SUITE("Salix::ecs::Realm") {
+
+    TEST_CASE("entities can be found by id and by name") {
+        Salix::Realm realm("Test Realm");
+        Salix::Entity* player = realm.create_entity("Player");
+        Salix::Entity* enemy = realm.create_entity(Salix::SimpleGuid::from_value(4242), "Enemy");
+
+        CHECK(realm.get_entity_by_id(player->get_id()) == player);
+        CHECK(realm.get_entity_by_id(Salix::SimpleGuid::from_value(4242)) == enemy);
+        CHECK(realm.get_entity_by_name("Player") == player);
+        CHECK(realm.get_entity_by_name("Enemy") == enemy);
+        CHECK(realm.get_entity_by_name("Nobody") == nullptr);
+        CHECK(realm.get_entity_by_id(Salix::SimpleGuid::invalid()) == nullptr);
+    }
+
+    TEST_CASE("name lookups return the oldest entity with that name") {
+        Salix::Realm realm;
+        Salix::Entity* first = realm.create_entity("Crate");
+        realm.create_entity("Crate");
+        CHECK(realm.get_entity_by_name("Crate") == first);
+    }
+
+    TEST_CASE("indices follow renames and id changes") {
+        Salix::Realm realm;
+        Salix::Entity* entity = realm.create_entity("Old Name");
+
+        entity->set_name("New Name");
+        CHECK(realm.get_entity_by_name("Old Name") == nullptr);
+        CHECK(realm.get_entity_by_name("New Name") == entity);
+
+        Salix::SimpleGuid old_id = entity->get_id();
+        entity->set_id(Salix::SimpleGuid::from_value(777));
+        CHECK(realm.get_entity_by_id(old_id) == nullptr);
+        CHECK(realm.get_entity_by_id(Salix::SimpleGuid::from_value(777)) == entity);
+    }
+
+    TEST_CASE("maintain removes purged entities from the indices") {
+        Salix::Realm realm;
+        Salix::Entity* doomed = realm.create_entity("Doomed");
+        Salix::Entity* survivor = realm.create_entity("Survivor");
+        Salix::SimpleGuid doomed_id = doomed->get_id();
+
+        doomed->purge();
+        realm.maintain();
+
+        CHECK(realm.get_entity_by_id(doomed_id) == nullptr);
+        CHECK(realm.get_entity_by_name("Doomed") == nullptr);
+        CHECK(realm.get_entity_by_name("Survivor") == survivor);
+        CHECK(realm.get_entities().size() == 1);
+    }
+
+    TEST_CASE("purges keep the oldest name match and hand duplicate ids on") {
+        Salix::Realm realm;
+        Salix::Entity* first = realm.create_entity("Crate");
+        Salix::Entity* second = realm.create_entity("Crate");
+        Salix::Entity* third = realm.create_entity("Crate");
+        second->set_id(first->get_id());
+        third->set_id(first->get_id());
+        const Salix::SimpleGuid shared_id = first->get_id();
+
+        first->purge();
+        realm.maintain();
+        CHECK(realm.get_entity_by_name("Crate") == second);
+        CHECK(realm.get_entity_by_id(shared_id) == second);
+
+        third->set_name("Barrel");
+        third->set_name("Crate");
+        second->purge();
+        realm.maintain();
+        CHECK(realm.get_entity_by_name("Crate") == third);
+        CHECK(realm.get_entity_by_id(shared_id) == third);
+
+        third->purge();
+        realm.maintain();
+        CHECK(realm.get_entity_by_name("Crate") == nullptr);
+        CHECK(realm.get_entity_by_id(shared_id) == nullptr);
+    }
+
+    TEST_CASE("handles resolve while the entity lives and go stale after it is purged") {
+        Salix::Realm realm;
+        Salix::Entity* entity = realm.create_entity("Target");
+        Salix::EntityHandle handle = realm.get_entity_handle(entity);
+        REQUIRE(handle.is_valid());
+        CHECK(realm.resolve_entity_handle(handle) == entity);
+
+        entity->purge();
+        realm.maintain();
+        CHECK(realm.resolve_entity_handle(handle) == nullptr);
+
+        // The slot is recycled, but the old handle must not see the new entity.
+        Salix::Entity* replacement = realm.create_entity("Replacement");
+        Salix::EntityHandle new_handle = realm.get_entity_handle(replacement);
+        CHECK(new_handle.index == handle.index);
+        CHECK(new_handle != handle);
+        CHECK(realm.resolve_entity_handle(handle) == nullptr);
+        CHECK(realm.resolve_entity_handle(new_handle) == replacement);
+    }
+
+    TEST_CASE("clear_all_entities invalidates every handle and index") {
+        Salix::Realm realm;
+        Salix::Entity* entity = realm.create_entity("Temp");
+        Salix::EntityHandle handle = realm.get_entity_handle(entity);
+
+        realm.clear_all_entities();
+
+        CHECK(realm.resolve_entity_handle(handle) == nullptr);
+        CHECK(realm.get_entity_by_name("Temp") == nullptr);
+        CHECK(realm.get_entities().empty());
+    }
+
+    TEST_CASE("entities outside a realm have no handle") {
+        Salix::Realm realm;
+        Salix::Entity loose_entity;
+        CHECK(realm.get_entity_handle(&loose_entity).is_valid() == false);
+        CHECK(realm.resolve_entity_handle(Salix::EntityHandle::invalid()) == nullptr);
+    }
+
+    TEST_CASE("spawn/despawn churn makes no heap allocations once warm") {
+        Salix::Realm realm;
+        // Short enough to live in std::string's inline buffer.
+        const std::string name = "Projectile";
+        std::vector<Salix::Entity*> wave;
+        wave.reserve(64);
+        auto spawn_wave = [&]() {
+            for (int i = 0; i < 64; ++i) {
+                Salix::Entity* entity = realm.create_entity(name);
+                entity->add_element<Salix::Sprite2D>();
+                wave.push_back(entity);
+            }
+            // Parent a few so the child lists churn as well.
+            for (int i = 1; i < 8; ++i) {
+                wave[i]->set_parent(wave[0]);
+            }
+        };
+        auto despawn_wave = [&]() {
+            for (Salix::Entity* entity : wave) {
+                entity->simple_purge();
+            }
+            wave.clear();
+            realm.maintain();
+        };
+
+        // The first wave sizes the pools, the entity list and the indices.
+        spawn_wave();
+        despawn_wave();
+
+        Salix::PoolAllocator::reset_stats();
+        const uint64_t heap_before = Salix::PoolAllocator::get_thread_heap_allocations();
+        for (int round = 0; round < 4; ++round) {
+            spawn_wave();
+            despawn_wave();
+        }
+        const uint64_t heap_allocations = Salix::PoolAllocator::get_thread_heap_allocations() - heap_before;
+        Salix::PoolStats stats = Salix::PoolAllocator::get_stats();
+        CHECK(stats.allocations > 0);
+        CHECK(stats.allocations == stats.deallocations);
+        CHECK(stats.system_allocations == 0);
+        // Everything else an entity owns must come from the pools too.
+        CHECK(heap_allocations == 0);
+        CHECK(realm.get_entities().empty());
+    }
+
+    TEST_CASE("parallel update runs thread-safe entities on workers and forwards their events in order") {
+        Salix::JobSystem jobs(3);
+        Salix::EventManager events;
+        UpdateOrderListener listener;
+        events.subscribe(Salix::EventCategory::Application, &listener);
+
+        Salix::Realm realm;
+        realm.set_job_system(&jobs);
+        REQUIRE(realm.is_parallel_update_enabled());
+
+        constexpr int entity_count = 500;
+        std::vector<WorkerElement*> workers;
+        for (int i = 0; i < entity_count; ++i) {
+            WorkerElement* element = realm.create_entity("Worker")->add_element<WorkerElement>();
+            element->events = &events;
+            element->value = i;
+            workers.push_back(element);
+        }
+        Salix::Entity* scripted = realm.create_entity("Scripted");
+        MainThreadElement* main_thread_element = scripted->add_element<MainThreadElement>();
+        CHECK(scripted->wants_parallel_update() == false);
+        CHECK(realm.get_entity_by_name("Worker")->wants_parallel_update());
+        // The built-in elements are thread-safe but do not opt in.
+        Salix::Entity* plain = realm.create_entity("Plain");
+        plain->add_element<Salix::Sprite2D>();
+        CHECK(plain->is_update_thread_safe());
+        CHECK(plain->wants_parallel_update() == false);
+
+        realm.update(0.016f);
+        events.process_queue();
+
+        bool each_updated_once = true;
+        for (WorkerElement* element : workers) {
+            each_updated_once = each_updated_once && element->updates == 1;
+        }
+        CHECK(each_updated_once);
+        CHECK(main_thread_element->update_thread == std::this_thread::get_id());
+
+        REQUIRE(listener.values.size() == entity_count);
+        bool in_entity_order = true;
+        for (int i = 0; i < entity_count; ++i) {
+            in_entity_order = in_entity_order && listener.values[i] == i;
+        }
+        CHECK(in_entity_order);
+        events.unsubscribe(Salix::EventCategory::Application, &listener);
+    }
+
+    TEST_CASE("parallel update can be switched off") {
+        Salix::JobSystem jobs(2);
+        Salix::Realm realm;
+        realm.set_job_system(&jobs);
+        realm.set_parallel_update(false);
+        CHECK(realm.is_parallel_update_enabled() == false);
+
+        Salix::EventManager events;
+        WorkerElement* element = realm.create_entity()->add_element<WorkerElement>();
+        element->events = &events;
+        realm.update(0.016f);
+        CHECK(element->updates == 1);
+        CHECK(events.is_queue_empty() == false);
+    }
+
+    TEST_CASE("view visits only entities with every requested element") {
+        Salix::Realm realm;
+        Salix::Entity* plain = realm.create_entity("Plain");
+        Salix::Entity* sprited = realm.create_entity("Sprited");
+        sprited->add_element<Salix::Sprite2D>();
+
+        std::vector<Salix::Entity*> visited;
+        for (Salix::Entity* entity : realm.view<Salix::Transform, Salix::Sprite2D>()) {
+            visited.push_back(entity);
+        }
+        REQUIRE(visited.size() == 1);
+        CHECK(visited[0] == sprited);
+
+        // Every entity carries the mandatory Transform and BoxCollider.
+        int with_collider = 0;
+        realm.view<Salix::Transform, Salix::BoxCollider>().each(
+            [&with_collider](Salix::Entity&, Salix::Transform&, Salix::BoxCollider&) { ++with_collider; });
+        CHECK(with_collider == 2);
+        CHECK(plain->has_element<Salix::Sprite2D>() == false);
+    }
+
+    TEST_CASE("views follow element additions, new entities and purges") {
+        Salix::Realm realm;
+        Salix::Entity* first = realm.create_entity("First");
+        auto sprites = realm.view<Salix::Sprite2D>();
+        CHECK(sprites.empty());
+
+        first->add_element<Salix::Sprite2D>();
+        Salix::Entity* second = realm.create_entity("Second");
+        second->add_element<Salix::Sprite2D>();
+        CHECK(sprites.size() == 2);
+
+        // Purged entities are skipped straight away and dropped on maintain().
+        second->purge();
+        std::vector<Salix::Entity*> visited(sprites.begin(), sprites.end());
+        REQUIRE(visited.size() == 1);
+        CHECK(visited[0] == first);
+        realm.maintain();
+        CHECK(sprites.size() == 1);
+
+        realm.clear_all_entities();
+        CHECK(sprites.empty());
+    }
+
+    TEST_CASE("a view of a type without a mask bit matches only entities that have it") {
+        // Use up the mask bits so the next element type registered gets none.
+        register_filler_types(std::make_index_sequence<Salix::MAX_ELEMENT_TYPES>());
+        REQUIRE(Salix::ElementTypeRegistry::get_registered_count() >= Salix::MAX_ELEMENT_TYPES);
+
+        Salix::Realm realm;
+        realm.create_entity("Plain");
+        Salix::Entity* tagged = realm.create_entity("Tagged");
+        tagged->add_element<UnmappedElement>();
+        REQUIRE(Salix::element_type_bit(Salix::ElementTypeIdOf<UnmappedElement>::get()) == 0);
+
+        std::vector<Salix::Entity*> visited;
+        for (Salix::Entity* entity : realm.view<UnmappedElement>()) {
+            visited.push_back(entity);
+        }
+        REQUIRE(visited.size() == 1);
+        CHECK(visited[0] == tagged);
+        CHECK(realm.view<Salix::Sprite2D, UnmappedElement>().empty());
+    }
+}
+
+
+namespace {
+    std::string temp_realm_path(const std::string& file_name) {
+        return (std::filesystem::temp_directory_path() / file_name).string();
+    }
+
+    // Every entity gets the mandatory Transform and BoxCollider; every third a sprite too.
+    void fill_realm(Salix::Realm& realm, int entity_count) {
+        for (int i = 0; i < entity_count; ++i) {
+            Salix::Entity* entity = realm.create_entity(Salix::SimpleGuid::from_value(1000 + i),
+                                                        "Entity " + std::to_string(i));
+            entity->get_transform()->set_position(static_cast<float>(i), 2.0f, 3.0f);
+            if (i % 3 == 0) {
+                entity->add_element<Salix::Sprite2D>();
+            }
+        }
+    }
+}
+
+TEST_SUITE("Salix::ecs::Realm files") {
+
+    TEST_CASE("a binary realm loads back with the same entities and element order") {
+        Salix::Realm realm("Binary Realm", "Realms/binary.realm");
+        fill_realm(realm, 10);
+        realm.set_main_camera_entity(Salix::SimpleGuid::from_value(1003));
+        const std::string path = temp_realm_path("salix_realm_roundtrip.bin");
+        REQUIRE(realm.save_to_file(path, Salix::RealmFileFormat::Binary));
+        CHECK(Salix::Realm::detect_file_format(path) == Salix::RealmFileFormat::Binary);
+
+        Salix::InitContext context;
+        auto loaded = Salix::Realm::load_from_file(path, context);
+        REQUIRE(loaded);
+        CHECK(loaded->get_name() == "Binary Realm");
+        CHECK(loaded->get_path() == "Realms/binary.realm");
+        CHECK(loaded->get_main_camera_entity_id() == Salix::SimpleGuid::from_value(1003));
+        REQUIRE(loaded->get_entities().size() == 10);
+
+        Salix::Entity* sixth = loaded->get_entity_by_id(Salix::SimpleGuid::from_value(1006));
+        REQUIRE(sixth);
+        CHECK(sixth->get_name() == "Entity 6");
+        CHECK(sixth->get_transform()->get_position().x == doctest::Approx(6.0f));
+        CHECK(sixth->has_element<Salix::Sprite2D>());
+        CHECK_FALSE(loaded->get_entity_by_name("Entity 7")->has_element<Salix::Sprite2D>());
+
+        // Grouping by type must not reorder an entity's elements.
+        std::vector<Salix::Element*> original = realm.get_entity_by_name("Entity 6")->get_all_elements();
+        std::vector<Salix::Element*> reloaded = sixth->get_all_elements();
+        REQUIRE(original.size() == reloaded.size());
+        for (size_t i = 0; i < original.size(); ++i) {
+            CHECK(std::strcmp(original[i]->get_class_name(), reloaded[i]->get_class_name()) == 0);
+        }
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("JSON realms still load and convert to binary") {
+        Salix::Realm realm("Json Realm");
+        fill_realm(realm, 4);
+        const std::string json_path = temp_realm_path("salix_realm_convert.json");
+        const std::string binary_path = temp_realm_path("salix_realm_convert.bin");
+        REQUIRE(realm.save_to_file(json_path));
+        CHECK(Salix::Realm::detect_file_format(json_path) == Salix::RealmFileFormat::Json);
+        CHECK(Salix::Realm::detect_file_format(temp_realm_path("salix_realm_missing.bin")) == Salix::RealmFileFormat::Unknown);
+
+        REQUIRE(Salix::Realm::convert_file(json_path, binary_path, Salix::RealmFileFormat::Binary));
+        Salix::InitContext context;
+        auto from_json = Salix::Realm::load_from_file(json_path, context);
+        auto from_binary = Salix::Realm::load_from_file(binary_path, context);
+        REQUIRE(from_json);
+        REQUIRE(from_binary);
+        CHECK(from_json->get_entities().size() == 4);
+        CHECK(from_binary->get_entities().size() == 4);
+        CHECK(from_binary->get_entity_by_name("Entity 2")->get_id() == from_json->get_entity_by_name("Entity 2")->get_id());
+        std::filesystem::remove(json_path);
+        std::filesystem::remove(binary_path);
+    }
+
+    TEST_CASE("binary realms of another version, a damaged size or bad counts are refused") {
+        Salix::Realm realm("Versioned");
+        fill_realm(realm, 2);
+        const std::string path = temp_realm_path("salix_realm_version.bin");
+        REQUIRE(realm.save_to_file(path, Salix::RealmFileFormat::Binary));
+        Salix::InitContext context;
+
+        SUBCASE("other version") {
+            std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+            const uint32_t other_version = Salix::RealmBinary::VERSION + 1;
+            file.seekp(offsetof(Salix::RealmBinaryHeader, version));
+            file.write(reinterpret_cast<const char*>(&other_version), sizeof(other_version));
+        }
+        SUBCASE("truncated") {
+            std::filesystem::resize_file(path, std::filesystem::file_size(path) - 8);
+        }
+        SUBCASE("element count beyond the blocks") {
+            std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+            Salix::RealmBinaryHeader header;
+            file.read(reinterpret_cast<char*>(&header), sizeof(header));
+            const uint32_t huge_count = 0xFFFFFFF0u;
+            file.seekp(static_cast<std::streamoff>(header.entity_table_offset + offsetof(Salix::RealmBinaryEntity, element_count)));
+            file.write(reinterpret_cast<const char*>(&huge_count), sizeof(huge_count));
+        }
+        CHECK(Salix::Realm::load_from_file(path, context) == nullptr);
+        std::filesystem::remove(path);
+    }
+
+    // Saves a synthetic 100k-entity realm in both formats and times loading
+    // each. Run with --no-skip to include it.
+    TEST_CASE("benchmark: binary vs JSON realm load" * doctest::skip()) {
+        constexpr int entity_count = 100000;
+        const std::string json_path = temp_realm_path("salix_realm_bench.json");
+        const std::string binary_path = temp_realm_path("salix_realm_bench.bin");
+        {
+            Salix::Realm realm("Benchmark");
+            fill_realm(realm, entity_count);
+            REQUIRE(realm.save_to_file(json_path));
+            REQUIRE(realm.save_to_file(binary_path, Salix::RealmFileFormat::Binary));
+        }
+
+        using clock = std::chrono::high_resolution_clock;
+        Salix::InitContext context;
+        auto json_start = clock::now();
+        auto from_json = Salix::Realm::load_from_file(json_path, context);
+        auto json_time = std::chrono::duration<double, std::milli>(clock::now() - json_start).count();
+        REQUIRE(from_json);
+        from_json.reset();
+
+        auto binary_start = clock::now();
+        auto from_binary = Salix::Realm::load_from_file(binary_path, context);
+        auto binary_time = std::chrono::duration<double, std::milli>(clock::now() - binary_start).count();
+        REQUIRE(from_binary);
+
+        std::cout << "[benchmark] " << entity_count << " entity realm load\n"
+                  << "  JSON:   " << json_time << " ms (" << std::filesystem::file_size(json_path) << " bytes)\n"
+                  << "  binary: " << binary_time << " ms (" << std::filesystem::file_size(binary_path) << " bytes)\n";
+        CHECK(from_binary->get_entities().size() == entity_count);
+        std::filesystem::remove(json_path);
+        std::filesystem::remove(binary_path);
+    }
+}
@@ -16,6 +16,8 @@
 #include <Tests/SalixEngine/mocking/rendering/MockIRenderer.h>
 // #include <Salix/core/SerializationRegistrations.h>
 #include <memory>
+#include <filesystem>
+#include <fstream>
 #include <cereal/archives/json.hpp>
 
 TEST_SUITE("Salix::ecs::Sprite2D") {
@@ -199,6 +201,34 @@ TEST_SUITE("Salix::ecs::Sprite2D") {
         }
     }
 
+    TEST_CASE("a streamed texture's size is known without rendering") {
+        MockIRenderer mock_renderer;
+        mock_renderer.supports_create_texture = true;
+        Salix::AssetManager asset_manager;
+        asset_manager.initialize(&mock_renderer);
+
+        const std::string path = (std::filesystem::temp_directory_path() / "salix_sprite_stream.ppm").string();
+        {
+            std::ofstream out(path, std::ios::binary);
+            out << "P6\n" << 6 << " " << 3 << "\n255\n" << std::string(6 * 3 * 3, '\x7f');
+        }
+
+        Salix::Sprite2D sprite;
+        sprite.load_texture(&asset_manager, path);
+        CHECK_FALSE(sprite.is_texture_ready());
+        CHECK(sprite.get_texture_width() == 2); // The placeholder, until the upload.
+
+        // Editor panels read the size without ever calling render().
+        asset_manager.finish_texture_requests();
+        CHECK(sprite.is_texture_ready());
+        CHECK(sprite.get_texture_width() == 6);
+        CHECK(sprite.get_texture_height() == 3);
+
+        sprite.load_texture(&asset_manager, "");
+        asset_manager.shutdown();
+        std::filesystem::remove(path);
+    }
+
     TEST_CASE("render logic") {
         // ARRANGE
         // A unique_ptr is used here to match the change you made
@@ -5,6 +5,7 @@
 #pragma once
 #include <doctest.h>
 #include <Salix/ecs/Transform.h>
+#include <Salix/ecs/TransformHierarchyPass.h>
 #include <Salix/math/Vector3.h>
 #include <Salix/core/SimpleGuid.h>
 #include <glm/gtx/matrix_operation.hpp>
@@ -765,5 +766,133 @@ TEST_SUITE("Salix::ecs::Transform") {
         loaded_transform.reset();
         original_transform.reset();
     }
-    
-}
\ No newline at end of file
+
+    TEST_CASE("cached world matrices follow changes anywhere up the hierarchy") {
+        // ARRANGE: root -> middle -> leaf, with the leaf's cache already warm.
+        auto root = std::make_unique<Salix::Transform>();
+        auto middle = std::make_unique<Salix::Transform>();
+        auto leaf = std::make_unique<Salix::Transform>();
+        middle->set_parent(root.get());
+        leaf->set_parent(middle.get());
+        leaf->set_position(1.f, 0.f, 0.f);
+        check_vector3_approximate(leaf->get_world_position(), 1.f, 0.f, 0.f);
+
+        SUBCASE("moving the root moves the leaf") {
+            root->translate(0.f, 5.f, 0.f);
+            check_vector3_approximate(leaf->get_world_position(), 1.f, 5.f, 0.f);
+        }
+
+        SUBCASE("scaling the middle node updates the leaf's world scale") {
+            check_vector3_approximate(leaf->get_world_scale(), 1.f, 1.f, 1.f);
+            middle->set_scale(2.f, 2.f, 2.f);
+            check_vector3_approximate(leaf->get_world_scale(), 2.f, 2.f, 2.f);
+            check_vector3_approximate(leaf->get_world_position(), 2.f, 0.f, 0.f);
+        }
+
+        SUBCASE("rotating the root updates the leaf's world rotation") {
+            check_vector3_approximate(leaf->get_world_rotation(), 0.f, 0.f, 0.f);
+            root->set_rotation(0.f, 0.f, 90.f);
+            check_vector3_approximate(leaf->get_world_rotation(), 0.f, 0.f, 90.f);
+            check_vector3_approximate(leaf->get_world_position(), 0.f, 1.f, 0.f);
+        }
+
+        SUBCASE("reparenting invalidates the moved subtree") {
+            auto other_root = std::make_unique<Salix::Transform>();
+            other_root->set_position(0.f, 0.f, 10.f);
+            middle->set_parent(other_root.get());
+            // World state is preserved across the reparent...
+            check_vector3_approximate(leaf->get_world_position(), 1.f, 0.f, 0.f);
+            // ...and later moves of the new parent reach the leaf.
+            other_root->translate(0.f, 0.f, 1.f);
+            check_vector3_approximate(leaf->get_world_position(), 1.f, 0.f, 1.f);
+            middle->set_parent(nullptr);
+        }
+        leaf.reset();
+        middle.reset();
+        root.reset();
+    }
+
+    TEST_CASE("the cached model matrix matches a freshly composed one") {
+        Salix::Transform parent;
+        Salix::Transform child;
+        child.set_parent(&parent);
+        parent.set_position(3.f, -2.f, 7.f);
+        parent.set_rotation(10.f, 20.f, 30.f);
+        child.set_position(1.f, 2.f, 3.f);
+        child.set_scale(0.5f, 2.f, 1.f);
+        child.rotate(5.f, 0.f, 0.f);
+
+        auto compose = [](const Salix::Transform& t) {
+            glm::mat4 rotation = glm::rotate(glm::mat4(1.0f), glm::radians(t.get_rotation().z), glm::vec3(0.f, 0.f, 1.f)) *
+                                 glm::rotate(glm::mat4(1.0f), glm::radians(t.get_rotation().y), glm::vec3(0.f, 1.f, 0.f)) *
+                                 glm::rotate(glm::mat4(1.0f), glm::radians(t.get_rotation().x), glm::vec3(1.f, 0.f, 0.f));
+            return glm::translate(glm::mat4(1.0f), t.get_position().to_glm()) * rotation *
+                   glm::scale(glm::mat4(1.0f), t.get_scale().to_glm());
+        };
+        const glm::mat4 expected = compose(parent) * compose(child);
+        const glm::mat4 actual = child.get_model_matrix();
+        for (int column = 0; column < 4; ++column) {
+            for (int row = 0; row < 4; ++row) {
+                CHECK(actual[column][row] == doctest::Approx(expected[column][row]));
+            }
+        }
+        CHECK(&child.get_world_matrix() == &child.get_world_matrix());
+        child.set_parent(nullptr);
+    }
+
+    TEST_CASE("deserializing refreshes the cached matrices") {
+        Salix::Transform source;
+        source.set_position(4.f, 5.f, 6.f);
+        std::stringstream ss;
+        {
+            cereal::JSONOutputArchive output_archive(ss);
+            output_archive(source);
+        }
+
+        Salix::Transform loaded;
+        check_vector3_approximate(loaded.get_world_position(), 0.f, 0.f, 0.f);
+        {
+            cereal::JSONInputArchive input_archive(ss);
+            input_archive(loaded);
+        }
+        check_vector3_approximate(loaded.get_world_position(), 4.f, 5.f, 6.f);
+    }
+
+    TEST_CASE("interpolation blends between the captured and current state") {
+        Salix::Transform transform;
+        transform.set_position(10.f, 0.f, 0.f);
+        // Nothing captured yet: any alpha shows the current state.
+        check_vector3_approximate(transform.get_interpolated_position(0.f), 10.f, 0.f, 0.f);
+
+        Salix::TransformHierarchyPass::get().capture_previous_states();
+        transform.set_position(20.f, 0.f, 0.f);
+        transform.set_rotation(0.f, 0.f, 350.f);
+        transform.set_scale(2.f, 2.f, 2.f);
+
+        check_vector3_approximate(transform.get_interpolated_position(0.f), 10.f, 0.f, 0.f);
+        check_vector3_approximate(transform.get_interpolated_position(0.5f), 15.f, 0.f, 0.f);
+        check_vector3_approximate(transform.get_interpolated_position(1.f), 20.f, 0.f, 0.f);
+        check_vector3_approximate(transform.get_interpolated_scale(0.5f), 1.5f, 1.5f, 1.5f);
+        // 0 -> 350 degrees goes the short way, through -5.
+        check_vector3_approximate(transform.get_interpolated_rotation(0.5f), 0.f, 0.f, -5.f);
+
+        transform.reset_interpolation();
+        check_vector3_approximate(transform.get_interpolated_position(0.f), 20.f, 0.f, 0.f);
+    }
+
+    TEST_CASE("interpolated world matrix follows the parent chain") {
+        Salix::Transform parent;
+        Salix::Transform child;
+        child.set_parent(&parent);
+        child.set_position(1.f, 0.f, 0.f);
+        Salix::TransformHierarchyPass::get().capture_previous_states();
+
+        parent.set_position(4.f, 0.f, 0.f);
+        const glm::mat4 halfway = child.get_interpolated_world_matrix(0.5f);
+        CHECK(halfway[3][0] == doctest::Approx(3.f));
+
+        const glm::mat4 current = child.get_interpolated_world_matrix(1.f);
+        CHECK(current[3][0] == doctest::Approx(5.f));
+        child.set_parent(nullptr);
+    }
+}
@@ -0,0 +1,181 @@
+// =================================================================================
+// Filename:    src/Tests/SalixEngine/ecs/TransformHierarchyPass.test.cpp
+// Description: Contains unit tests for the batched world-transform pass, plus a
+//              microbenchmark against lazy per-node matrix queries.
+// =================================================================================
+
+#include <doctest.h>
+#include <Salix/ecs/TransformHierarchyPass.h>
+#include <Salix/ecs/Transform.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+
+namespace {
+    void check_matrix_approximate(const glm::mat4& actual, const glm::mat4& expected) {
+        for (int column = 0; column < 4; ++column) {
+            for (int row = 0; row < 4; ++row) {
+                CHECK(actual[column][row] == doctest::Approx(expected[column][row]));
+            }
+        }
+    }
+
+    glm::mat4 compose(const Salix::Transform& transform) {
+        const Salix::Vector3& rotation = transform.get_rotation();
+        glm::mat4 rotation_matrix = glm::rotate(glm::mat4(1.0f), glm::radians(rotation.z), glm::vec3(0.f, 0.f, 1.f)) *
+                                    glm::rotate(glm::mat4(1.0f), glm::radians(rotation.y), glm::vec3(0.f, 1.f, 0.f)) *
+                                    glm::rotate(glm::mat4(1.0f), glm::radians(rotation.x), glm::vec3(1.f, 0.f, 0.f));
+        return glm::translate(glm::mat4(1.0f), transform.get_position().to_glm()) * rotation_matrix *
+               glm::scale(glm::mat4(1.0f), transform.get_scale().to_glm());
+    }
+
+    // Builds 'roots' chains of 'depth' transforms each. Children are destroyed first.
+    struct Forest {
+        std::vector<std::unique_ptr<Salix::Transform>> transforms;
+
+        Forest(int roots, int depth) {
+            transforms.reserve(static_cast<size_t>(roots) * depth);
+            for (int r = 0; r < roots; ++r) {
+                Salix::Transform* parent = nullptr;
+                for (int d = 0; d < depth; ++d) {
+                    auto transform = std::make_unique<Salix::Transform>();
+                    transform->set_parent(parent);
+                    transform->set_position(1.f, static_cast<float>(r), 0.f);
+                    transform->set_rotation(0.f, 0.f, 5.f);
+                    parent = transform.get();
+                    transforms.push_back(std::move(transform));
+                }
+            }
+        }
+
+        ~Forest() {
+            while (!transforms.empty()) {
+                transforms.pop_back();
+            }
+        }
+    };
+}
+
+
+TEST_SUITE("Salix::ecs::TransformHierarchyPass") {
+
+    TEST_CASE("computes the same world matrices as the lazy path") {
+        Salix::Transform root;
+        Salix::Transform middle;
+        Salix::Transform leaf;
+        middle.set_parent(&root);
+        leaf.set_parent(&middle);
+        root.set_position(3.f, 0.f, -1.f);
+        root.set_rotation(0.f, 45.f, 0.f);
+        middle.set_position(0.f, 2.f, 0.f);
+        middle.set_scale(2.f, 2.f, 2.f);
+        leaf.set_position(1.f, 1.f, 1.f);
+        leaf.set_rotation(30.f, 0.f, 10.f);
+
+        Salix::TransformHierarchyPass::get().run();
+
+        check_matrix_approximate(leaf.get_world_matrix(), compose(root) * compose(middle) * compose(leaf));
+        check_matrix_approximate(middle.get_world_matrix(), compose(root) * compose(middle));
+
+        leaf.set_parent(nullptr);
+        middle.set_parent(nullptr);
+    }
+
+    TEST_CASE("only dirty subtrees are recomputed") {
+        Salix::TransformHierarchyPass& pass = Salix::TransformHierarchyPass::get();
+        Forest forest(3, 4);
+        pass.run();
+
+        pass.run();
+        CHECK(pass.get_last_updated_count() == 0);
+        CHECK(pass.get_last_visited_count() >= forest.transforms.size());
+
+        // Moving the second chain's root dirties exactly that chain.
+        forest.transforms[4]->translate(0.f, 1.f, 0.f);
+        pass.run();
+        CHECK(pass.get_last_updated_count() == 4);
+    }
+
+    TEST_CASE("hierarchy changes are picked up between runs") {
+        Salix::TransformHierarchyPass& pass = Salix::TransformHierarchyPass::get();
+        Salix::Transform parent;
+        Salix::Transform child;
+        parent.set_position(0.f, 10.f, 0.f);
+        pass.run();
+
+        child.set_parent(&parent);
+        child.set_position(0.f, 0.f, 0.f);
+        parent.translate(0.f, 1.f, 0.f);
+        pass.run();
+        CHECK(child.get_world_position().y == doctest::Approx(11.f));
+
+        child.set_parent(nullptr);
+    }
+
+    TEST_CASE("large forests are split across workers") {
+        Salix::TransformHierarchyPass& pass = Salix::TransformHierarchyPass::get();
+        const unsigned int previous_workers = pass.get_max_workers();
+        pass.set_max_workers(4);
+
+        Forest forest(64, 80);
+        REQUIRE(forest.transforms.size() >= Salix::TransformHierarchyPass::PARALLEL_THRESHOLD);
+        pass.run();
+        CHECK(pass.get_last_worker_count() > 1);
+
+        // The deepest node of a chain of 80 local offsets rotated by 5 degrees each.
+        glm::mat4 expected(1.0f);
+        for (int d = 0; d < 80; ++d) {
+            expected = expected * compose(*forest.transforms[d]);
+        }
+        check_matrix_approximate(forest.transforms[79]->get_world_matrix(), expected);
+
+        pass.set_max_workers(previous_workers);
+    }
+
+
+    // Compares querying every node's model matrix lazily (which walks and
+    // multiplies up the parent chain as needed) against one batched pass.
+    // Run with --no-skip.
+    TEST_CASE("benchmark: batched pass vs lazy per-node queries" * doctest::skip()) {
+        constexpr int frames = 100;
+        Forest forest(256, 32);
+        Salix::TransformHierarchyPass& pass = Salix::TransformHierarchyPass::get();
+        using clock = std::chrono::high_resolution_clock;
+
+        float lazy_sum = 0.0f;
+        auto lazy_start = clock::now();
+        for (int frame = 0; frame < frames; ++frame) {
+            for (size_t r = 0; r < forest.transforms.size(); r += 32) {
+                forest.transforms[r]->rotate(0.f, 0.f, 1.f);
+            }
+            for (const auto& transform : forest.transforms) {
+                lazy_sum += transform->get_model_matrix()[3].x;
+            }
+        }
+        auto lazy_time = std::chrono::duration<double, std::milli>(clock::now() - lazy_start).count();
+
+        float pass_sum = 0.0f;
+        auto pass_start = clock::now();
+        for (int frame = 0; frame < frames; ++frame) {
+            for (size_t r = 0; r < forest.transforms.size(); r += 32) {
+                forest.transforms[r]->rotate(0.f, 0.f, 1.f);
+            }
+            pass.run();
+            for (const auto& transform : forest.transforms) {
+                pass_sum += transform->get_world_matrix()[3].x;
+            }
+        }
+        auto pass_time = std::chrono::duration<double, std::milli>(clock::now() - pass_start).count();
+
+        std::cout << "[benchmark] " << forest.transforms.size() << " transforms x " << frames << " frames\n"
+                  << "  lazy get_model_matrix(): " << lazy_time << " ms\n"
+                  << "  batched pass + reads:    " << pass_time << " ms ("
+                  << pass.get_last_worker_count() << " workers)\n";
+        CHECK(lazy_sum != 0.0f);
+        CHECK(pass_sum != 0.0f);
+    }
+}
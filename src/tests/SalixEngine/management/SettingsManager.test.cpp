@@ -54,6 +54,10 @@ Window:
 Engine:
   initial_state: Editor
   target_fps: 144
+Simulation:
+  fixed_timestep: true
+  tick_rate: 30
+  max_catch_up_steps: 8
 Renderer:
   type: OpenGL
 GUI:
@@ -77,6 +81,9 @@ Timer:
         CHECK(config.target_fps == 144);
         CHECK(config.renderer_type == Salix::RendererType::OpenGL);
         CHECK(config.timer_type == Salix::TimerType::Chrono);
+        CHECK(config.simulation.fixed_timestep == true);
+        CHECK(config.simulation.tick_rate == 30);
+        CHECK(config.simulation.max_catch_up_steps == 8);
 
         // CLEANUP
         std::filesystem::remove(test_file);
@@ -156,6 +163,8 @@ Timer:
         config_to_save.initial_state = Salix::AppStateType::Options; // Covers the 'Options' branch
         config_to_save.gui_type = Salix::GuiType::None;             // Covers the 'None' branch
         config_to_save.timer_type = Salix::TimerType::Chrono;       // Covers the 'Chrono' branch
+        config_to_save.simulation.fixed_timestep = true;
+        config_to_save.simulation.tick_rate = 120;
 
         // ACT
         bool save_success = settings_manager.save_settings(test_save_file, config_to_save);
@@ -172,6 +181,8 @@ Timer:
         CHECK(loaded_config.initial_state == Salix::AppStateType::Options);
         CHECK(loaded_config.gui_type == Salix::GuiType::None);
         CHECK(loaded_config.timer_type == Salix::TimerType::Chrono);
+        CHECK(loaded_config.simulation.fixed_timestep == true);
+        CHECK(loaded_config.simulation.tick_rate == 120);
 
         // CLEANUP
         std::filesystem::remove(test_save_file);
@@ -1,6 +1,7 @@
 // Tests/SalixEngine/mocking/rendering/MockIRenderer.h
 #pragma once
 #include <Salix/rendering/IRenderer.h>
+#include <Salix/rendering/RenderCommandList.h>
 #include <Salix/window/WindowConfig.h>
 #include <Tests/SalixEngine/mocking/rendering/MockITexture.h>
 #include <iostream>
@@ -11,6 +12,36 @@ public:
     Salix::SpriteFlip last_flip_state = Salix::SpriteFlip::None;
     bool should_texture_load_fail = false;
 
+    // For sprite batching: batched sprites are recorded into a command list
+    // and executed through the same walk OpenGLRenderer draws it with, using
+    // the headless executor.
+    Salix::RenderCommandList commands;
+    bool sprite_batch_open = false;
+    Salix::RenderStats stats;
+    void begin_sprite_batch() override { sprite_batch_open = true; }
+    void end_sprite_batch() override {
+        if (!sprite_batch_open) return;
+        sprite_batch_open = false;
+        execute_commands();
+    }
+    void submit_sprite(Salix::ITexture* texture, const Salix::Transform* transform, const Salix::Color& color, Salix::SpriteFlip flip, int sorting_layer) override {
+        if (!sprite_batch_open) { draw_sprite(texture, transform, color, flip); return; }
+        last_flip_state = flip;
+        commands.add_sprite(texture, transform->get_world_matrix(), color, sorting_layer);
+    }
+    void submit_sprite(Salix::ITexture* texture, const glm::mat4& model_matrix, const Salix::Color& color, int sorting_layer) override {
+        if (!sprite_batch_open) { draw_sprite(texture, model_matrix, color); return; }
+        commands.add_sprite(texture, model_matrix, color, sorting_layer);
+    }
+    void submit_commands(const Salix::RenderCommandList& list) override { commands.append(list); }
+    void execute_commands() {
+        commands.sort();
+        Salix::RenderStatsExecutor executor;
+        commands.execute(executor, stats);
+        commands.clear();
+    }
+    Salix::RenderStats get_render_stats() const override { return stats; }
+
     // This is the core function your AssetManager test depends on.
     Salix::ITexture* load_texture(const char* file_path) override {
         if (should_texture_load_fail) {
@@ -21,14 +52,25 @@ public:
         return new MockITexture();
     }
 
+    // Off by default so AssetManager keeps its synchronous path; the streaming
+    // tests switch it on.
+    bool supports_create_texture = false;
+    int create_texture_call_count = 0;
+    Salix::ITexture* create_texture(const unsigned char* pixels, int width, int height, int channels) override {
+        (void)pixels; (void)channels;
+        if (!supports_create_texture) return nullptr;
+        ++create_texture_call_count;
+        return new MockITexture(width, height);
+    }
+
     // You must implement all other pure virtual functions from IRenderer.
     bool initialize(const Salix::WindowConfig& config) override { 
         (void)config; // Use (void) to suppress unused parameter warnings.
         return true; 
     }
     void shutdown() override {}
-    void begin_frame() override {}
-    void end_frame() override {}
+    void begin_frame() override { stats = Salix::RenderStats{}; }
+    void end_frame() override { execute_commands(); }
     void clear_depth_buffer() override {}
     void set_pixels_per_unit(float ppu) override { (void)ppu; }
     float get_pixels_per_unit() const override { return 100.0f; }
@@ -56,7 +98,12 @@ public:
          (void)texture; (void)transform; (void)color; (void)flip;
           draw_sprite_call_count++;
             last_flip_state = flip;
+            ++stats.shader_binds; ++stats.texture_binds; ++stats.draw_calls; ++stats.sprites;
         }
+    void draw_sprite(Salix::ITexture* texture, const glm::mat4& model_matrix, const Salix::Color& color) override {
+        (void)texture; (void)model_matrix; (void)color;
+        ++stats.shader_binds; ++stats.texture_binds; ++stats.draw_calls; ++stats.sprites;
+    }
     void draw_wire_box(const glm::mat4& model_matrix, const Salix::Color& color) override { (void)model_matrix; (void)color; }
     void draw_line(const glm::vec3& start, const glm::vec3& end, const Salix::Color& color) override { (void)start; (void)end; (void)color; }
     const float get_line_width() const override { return 1.0f; }
@@ -5,6 +5,7 @@ class MockITexture : public Salix::ITexture {
     public:
         // We only need to provide a default constructor and destructor for the mock.
         MockITexture() = default;
+        MockITexture(int texture_width, int texture_height) : width(texture_width), height(texture_height) {}
         ~MockITexture() override = default;
         int get_width() const override { return width;}
         int get_height() const override {return height;}
@@ -0,0 +1,69 @@
+// =================================================================================
+// Filename:    src/Tests/SalixEngine/reflection/ByteMirror.test.cpp
+// Description: Contains unit tests for ByteMirror's flattened per-type property
+//              tables and name lookups.
+// =================================================================================
+#include <doctest.h>
+#include <Salix/reflection/ByteMirror.h>
+#include <Salix/ecs/Transform.h>
+#include <Salix/ecs/Sprite2D.h>
+#include <Salix/math/Vector3.h>
+#include <string>
+#include <vector>
+
+TEST_SUITE("Salix::reflection::ByteMirror") {
+    TEST_CASE("a type's table holds its own properties, then its ancestors'") {
+        Salix::ByteMirror::register_all_types();
+        const Salix::TypeInfo* transform_info = Salix::ByteMirror::get_type_info(typeid(Salix::Transform));
+        const Salix::TypeInfo* element_info = Salix::ByteMirror::get_type_info(typeid(Salix::Element));
+        REQUIRE(transform_info);
+        REQUIRE(element_info);
+
+        const auto& properties = Salix::ByteMirror::get_all_properties_for_type(transform_info);
+        REQUIRE(properties.size() == transform_info->properties.size() + element_info->properties.size());
+        CHECK(properties.front().name == transform_info->properties.front().name);
+        CHECK(properties.back().name == element_info->properties.back().name);
+
+        // The same table every time; nothing is rebuilt or copied per call.
+        CHECK(&Salix::ByteMirror::get_all_properties_for_type(transform_info) == &properties);
+        CHECK(Salix::ByteMirror::get_all_properties_for_type(nullptr).empty());
+    }
+
+    TEST_CASE("properties are found by name, through ancestors too") {
+        Salix::ByteMirror::register_all_types();
+        const Salix::TypeInfo* transform_info = Salix::ByteMirror::get_type_info_by_name("Transform");
+        REQUIRE(transform_info == Salix::ByteMirror::get_type_info(typeid(Salix::Transform)));
+        CHECK(Salix::ByteMirror::get_type_info_by_name("Sprite2D") == Salix::ByteMirror::get_type_info(typeid(Salix::Sprite2D)));
+        CHECK(Salix::ByteMirror::get_type_info_by_name("NoSuchType") == nullptr);
+        CHECK(Salix::ByteMirror::get_type_info_by_name("") == nullptr);
+
+        const Salix::Property* position = Salix::ByteMirror::find_property(transform_info, "position");
+        REQUIRE(position);
+        CHECK(position->type == Salix::PropertyType::Vector3);
+        const Salix::Property* name = Salix::ByteMirror::find_property(transform_info, "name");
+        REQUIRE(name);
+        CHECK(name->type == Salix::PropertyType::String);
+        CHECK(Salix::ByteMirror::find_property(transform_info, "no_such_property") == nullptr);
+        CHECK(Salix::ByteMirror::find_property(nullptr, "position") == nullptr);
+
+        // The accessors in the table drive a live element.
+        Salix::Transform transform;
+        Salix::Vector3 moved(1.0f, 2.0f, 3.0f);
+        position->set_data(&transform, &moved);
+        CHECK(transform.get_position().x == doctest::Approx(1.0f));
+        const auto value = Salix::ByteMirror::get_property_value(&transform, "position");
+        REQUIRE(std::holds_alternative<Salix::Vector3>(value));
+        CHECK(std::get<Salix::Vector3>(value).z == doctest::Approx(3.0f));
+    }
+
+    TEST_CASE("registering again rebuilds the tables in place") {
+        Salix::ByteMirror::register_all_types();
+        const Salix::TypeInfo* sprite_info = Salix::ByteMirror::get_type_info_by_name("Sprite2D");
+        REQUIRE(sprite_info);
+        const size_t property_count = Salix::ByteMirror::get_all_properties_for_type(sprite_info).size();
+
+        Salix::ByteMirror::register_all_types();
+        CHECK(Salix::ByteMirror::get_type_info_by_name("Sprite2D") == sprite_info);
+        CHECK(Salix::ByteMirror::get_all_properties_for_type(sprite_info).size() == property_count);
+    }
+}
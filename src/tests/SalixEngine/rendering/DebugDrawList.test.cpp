@@ -0,0 +1,63 @@
+// =================================================================================
+// Filename:    src/Tests/SalixEngine/rendering/DebugDrawList.test.cpp
+// Description: Contains unit tests for the line geometry DebugDrawList builds.
+// =================================================================================
+
+#include <doctest.h>
+#include <Salix/rendering/DebugDrawList.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <cmath>
+
+
+TEST_SUITE("Salix::rendering::DebugDrawList") {
+
+    TEST_CASE("a line is two coloured vertices") {
+        Salix::DebugDrawList list;
+        CHECK(list.empty());
+
+        list.add_line({ 0.f, 0.f, 0.f }, { 1.f, 2.f, 3.f }, Salix::Color(1.f, 0.f, 0.f, 0.5f));
+        REQUIRE(list.get_vertex_count() == 2);
+        CHECK(list.get_line_count() == 1);
+        CHECK(list.get_vertices()[1].position == glm::vec3(1.f, 2.f, 3.f));
+        CHECK(list.get_vertices()[0].color == glm::vec4(1.f, 0.f, 0.f, 0.5f));
+
+        list.clear();
+        CHECK(list.empty());
+    }
+
+    TEST_CASE("a wire box outlines the transformed unit cube") {
+        Salix::DebugDrawList list;
+        const glm::mat4 model = glm::scale(glm::translate(glm::mat4(1.0f), { 10.f, 0.f, 0.f }), { 2.f, 2.f, 2.f });
+        list.add_wire_box(model, Salix::Color());
+
+        REQUIRE(list.get_line_count() == 12);
+        for (size_t i = 0; i < list.get_vertex_count(); i += 2) {
+            const auto& a = list.get_vertices()[i].position;
+            const auto& b = list.get_vertices()[i + 1].position;
+            // Every edge of a cube scaled by 2 is 2 long.
+            CHECK(glm::length(b - a) == doctest::Approx(2.0f));
+            CHECK(std::fabs(a.x - 10.f) == doctest::Approx(1.0f));
+        }
+    }
+
+    TEST_CASE("a wire sphere is three circles of the requested resolution") {
+        Salix::DebugDrawList list;
+        list.add_wire_sphere({ 0.f, 1.f, 0.f }, 2.0f, Salix::Color(), 8);
+
+        CHECK(list.get_line_count() == 24);
+        for (const auto& vertex : list.get_vertices()) {
+            CHECK(glm::length(vertex.position - glm::vec3(0.f, 1.f, 0.f)) == doctest::Approx(2.0f));
+        }
+    }
+
+    TEST_CASE("a grid does not draw minor lines over major ones") {
+        Salix::DebugDrawList list;
+        // Major lines at -2..2 (5 per axis); minor every 0.5 adds the 4 in between.
+        list.add_grid(2.0f, 1.0f, 0.5f, Salix::Color(1.f, 1.f, 1.f), Salix::Color(0.5f, 0.5f, 0.5f));
+        CHECK(list.get_line_count() == (5 + 4) * 2);
+
+        list.clear();
+        list.add_grid(2.0f, 1.0f, 0.0f, Salix::Color(), Salix::Color());
+        CHECK(list.get_line_count() == 5 * 2);
+    }
+}
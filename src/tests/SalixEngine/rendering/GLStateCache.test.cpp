@@ -0,0 +1,96 @@
+// =================================================================================
+// Filename:    src/Tests/SalixEngine/rendering/GLStateCache.test.cpp
+// Description: Contains unit tests for GLStateCache's redundant-bind filtering,
+//              including objects deleted and recreated under the same name.
+// =================================================================================
+
+#include <doctest.h>
+#include <Salix/rendering/opengl/GLStateCache.h>
+#include <vector>
+
+
+namespace {
+    // Every bind the cache lets through, as (function, name).
+    struct GLCall {
+        char function;
+        GLuint name;
+    };
+    std::vector<GLCall> calls;
+
+    void APIENTRY record_active_texture(GLenum) {}
+    void APIENTRY record_bind_texture(GLenum, GLuint texture) { calls.push_back({ 't', texture }); }
+    void APIENTRY record_bind_vertex_array(GLuint vao) { calls.push_back({ 'v', vao }); }
+    void APIENTRY record_bind_framebuffer(GLenum, GLuint framebuffer) { calls.push_back({ 'f', framebuffer }); }
+
+    // No context exists in the tests; the cache's GL entry points are pointed
+    // at recorders instead.
+    void install_recorders() {
+        glad_glActiveTexture = &record_active_texture;
+        glad_glBindTexture = &record_bind_texture;
+        glad_glBindVertexArray = &record_bind_vertex_array;
+        glad_glBindFramebuffer = &record_bind_framebuffer;
+        calls.clear();
+    }
+}
+
+
+TEST_SUITE("Salix::rendering::GLStateCache") {
+
+    TEST_CASE("repeated binds of the same object reach GL once") {
+        install_recorders();
+        Salix::GLStateCache state;
+        state.bind_texture(0, 5);
+        state.bind_texture(0, 5);
+        state.bind_vertex_array(3);
+        state.bind_vertex_array(3);
+        state.bind_framebuffer(2);
+        state.bind_framebuffer(2);
+        CHECK(calls.size() == 3);
+        CHECK(state.get_skipped_count() == 3);
+    }
+
+    TEST_CASE("a deleted and recreated texture is bound again") {
+        install_recorders();
+        Salix::GLStateCache state;
+        state.bind_texture(0, 5);
+        state.bind_texture(3, 5);
+        state.bind_texture(1, 6);
+
+        // glDeleteTextures(5), then glGenTextures hands 5 out again.
+        state.forget_texture(5);
+        calls.clear();
+        state.bind_texture(0, 5);
+        state.bind_texture(3, 5);
+        state.bind_texture(1, 6); // Untouched; still known.
+        REQUIRE(calls.size() == 2);
+        CHECK(calls[0].function == 't');
+        CHECK(calls[0].name == 5);
+        CHECK(calls[1].name == 5);
+    }
+
+    TEST_CASE("a deleted and recreated vertex array is bound again") {
+        install_recorders();
+        Salix::GLStateCache state;
+        state.bind_vertex_array(3);
+        state.forget_vertex_array(4); // Not the bound one.
+        state.bind_vertex_array(3);
+        CHECK(calls.size() == 1);
+
+        state.forget_vertex_array(3);
+        state.bind_vertex_array(3);
+        REQUIRE(calls.size() == 2);
+        CHECK(calls[1].function == 'v');
+        CHECK(calls[1].name == 3);
+    }
+
+    TEST_CASE("a deleted and recreated framebuffer is bound again") {
+        install_recorders();
+        Salix::GLStateCache state;
+        state.bind_framebuffer(2);
+        state.forget_framebuffer(2);
+        state.bind_framebuffer(2);
+        REQUIRE(calls.size() == 2);
+        CHECK(calls[1].function == 'f');
+        CHECK(calls[1].name == 2);
+    }
+}
@@ -0,0 +1,211 @@
+// =================================================================================
+// Filename:    src/Tests/SalixEngine/rendering/RenderCommandList.test.cpp
+// Description: Contains unit tests for RenderCommandList sort keys, sorting,
+//              merging lists recorded on several threads, executors and
+//              execution through a renderer.
+// =================================================================================
+
+#include <doctest.h>
+#include <Salix/rendering/RenderCommandList.h>
+#include <Tests/SalixEngine/mocking/rendering/MockITexture.h>
+#include <Tests/SalixEngine/mocking/rendering/MockIRenderer.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+
+namespace {
+    glm::mat4 at_x(float x) {
+        return glm::translate(glm::mat4(1.0f), glm::vec3(x, 0.0f, 0.0f));
+    }
+
+    // Records the runs it is handed; sprite runs on 'unbindable' fail.
+    struct RecordingExecutor : Salix::IRenderCommandExecutor {
+        std::vector<size_t> sprite_runs;
+        std::vector<size_t> debug_runs;
+        int spheres = 0;
+        const Salix::ITexture* unbindable = nullptr;
+
+        bool draw_sprites(const Salix::RenderCommand* commands, size_t count) override {
+            if (commands[0].texture == unbindable) return false;
+            sprite_runs.push_back(count);
+            return true;
+        }
+        bool draw_sphere(const Salix::RenderCommand&) override {
+            ++spheres;
+            return true;
+        }
+        bool draw_debug_shapes(const Salix::RenderCommand*, size_t count) override {
+            debug_runs.push_back(count);
+            return true;
+        }
+    };
+}
+
+
+TEST_SUITE("Salix::rendering::RenderCommandList") {
+
+    TEST_CASE("sort keys round-trip their fields") {
+        using namespace Salix;
+        const uint64_t key = RenderSortKey::make(RenderCommandPass::Sprites, -3, 2, 0xABCDE, 0.5f);
+        CHECK(RenderSortKey::get_pass(key) == RenderCommandPass::Sprites);
+        CHECK(RenderSortKey::get_layer(key) == -3);
+        CHECK(RenderSortKey::get_shader(key) == 2);
+        CHECK(RenderSortKey::get_texture(key) == 0xABCDE);
+
+        // Pass outranks layer, layer outranks depth.
+        CHECK(RenderSortKey::make(RenderCommandPass::World, 100, 0, 0, 1.0f) <
+              RenderSortKey::make(RenderCommandPass::Sprites, -100, 0, 0, 0.0f));
+        CHECK(RenderSortKey::make(RenderCommandPass::Sprites, -1, 0, 0, 1.0f) <
+              RenderSortKey::make(RenderCommandPass::Sprites, 0, 0, 0, 0.0f));
+    }
+
+    TEST_CASE("sort orders by pass and layer and is stable for equal keys") {
+        MockITexture texture;
+        Salix::RenderCommandList list;
+        list.add_line({ 0.f, 0.f, 0.f }, { 1.f, 0.f, 0.f }, Salix::Color());
+        list.add_sprite(&texture, at_x(0.f), Salix::Color(), 1);
+        list.add_sprite(&texture, at_x(1.f), Salix::Color(), 0);
+        list.add_sprite(&texture, at_x(2.f), Salix::Color(), 1);
+        list.add_sphere({ 0.f, 0.f, 0.f }, 1.0f, Salix::Color());
+        list.sort();
+
+        const auto& commands = list.get_commands();
+        REQUIRE(commands.size() == 5);
+        CHECK(commands[0].type == Salix::RenderCommandType::Sphere);
+        CHECK(commands[1].transform[3][0] == doctest::Approx(1.f));
+        CHECK(commands[2].transform[3][0] == doctest::Approx(0.f));
+        CHECK(commands[3].transform[3][0] == doctest::Approx(2.f));
+        CHECK(commands[4].type == Salix::RenderCommandType::Line);
+    }
+
+    TEST_CASE("lists recorded on several threads merge into one sorted list") {
+        MockITexture textures[4];
+        constexpr int THREAD_COUNT = 4;
+        constexpr int PER_THREAD = 500;
+        std::vector<Salix::RenderCommandList> lists(THREAD_COUNT);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < THREAD_COUNT; ++t) {
+            threads.emplace_back([&, t]() {
+                for (int i = 0; i < PER_THREAD; ++i) {
+                    lists[t].add_sprite(&textures[i % 4], at_x(static_cast<float>(i)), Salix::Color(), (t + i) % 3);
+                }
+            });
+        }
+        for (auto& thread : threads) thread.join();
+
+        Salix::RenderCommandList merged;
+        for (const auto& list : lists) merged.append(list);
+        merged.sort();
+
+        REQUIRE(merged.size() == THREAD_COUNT * PER_THREAD);
+        const auto& commands = merged.get_commands();
+        CHECK(std::is_sorted(commands.begin(), commands.end(),
+            [](const Salix::RenderCommand& a, const Salix::RenderCommand& b) { return a.sort_key < b.sort_key; }));
+
+        // Three layers of four textures: each (layer, texture) group is one draw.
+        const Salix::RenderStats stats = merged.replay_to_stats();
+        CHECK(stats.sprites == THREAD_COUNT * PER_THREAD);
+        CHECK(stats.shader_binds == 1);
+        CHECK(stats.draw_calls <= 12);
+    }
+
+    TEST_CASE("replay counts one draw per run of debug shapes") {
+        Salix::RenderCommandList list;
+        for (int i = 0; i < 100; ++i) {
+            list.add_wire_box(at_x(static_cast<float>(i)), Salix::Color());
+            list.add_line({ 0.f, 0.f, 0.f }, { 0.f, 1.f, 0.f }, Salix::Color());
+        }
+        list.sort();
+        const Salix::RenderStats stats = list.replay_to_stats();
+        CHECK(stats.draw_calls == 1);
+        CHECK(stats.shader_binds == 1);
+        CHECK(stats.sprites == 0);
+    }
+
+    TEST_CASE("execute submits sprites through the renderer's batch") {
+        MockIRenderer mock_renderer;
+        MockITexture texture_a;
+        MockITexture texture_b;
+        Salix::RenderCommandList list;
+        for (int i = 0; i < 50; ++i) {
+            list.add_sprite(i % 2 ? &texture_a : &texture_b, at_x(static_cast<float>(i)), Salix::Color(), 0);
+        }
+        list.sort();
+
+        mock_renderer.begin_frame();
+        list.execute(mock_renderer);
+        const Salix::RenderStats stats = mock_renderer.get_render_stats();
+        CHECK(mock_renderer.draw_sprite_call_count == 0);
+        CHECK(stats.sprites == 50);
+        CHECK(stats.draw_calls == 2);
+        CHECK_FALSE(mock_renderer.sprite_batch_open);
+    }
+
+    TEST_CASE("execute hands over one run per shared draw and counts only what was drawn") {
+        MockITexture texture_a;
+        MockITexture texture_b;
+        Salix::RenderCommandList list;
+        for (int i = 0; i < 6; ++i) {
+            list.add_sprite(i < 4 ? &texture_a : &texture_b, at_x(static_cast<float>(i)), Salix::Color(), 0);
+        }
+        list.add_sphere({ 0.f, 0.f, 0.f }, 1.0f, Salix::Color());
+        list.add_line({ 0.f, 0.f, 0.f }, { 1.f, 0.f, 0.f }, Salix::Color());
+        list.add_wire_box(at_x(0.f), Salix::Color());
+        list.sort();
+
+        RecordingExecutor executor;
+        Salix::RenderStats stats;
+        list.execute(executor, stats);
+        CHECK(executor.spheres == 1);
+        REQUIRE(executor.sprite_runs.size() == 2);
+        CHECK(executor.sprite_runs[0] + executor.sprite_runs[1] == 6);
+        REQUIRE(executor.debug_runs.size() == 1);
+        CHECK(executor.debug_runs[0] == 2);
+
+        // The headless executor counts the same walk.
+        const Salix::RenderStats replayed = list.replay_to_stats();
+        CHECK(replayed.draw_calls == stats.draw_calls);
+        CHECK(replayed.texture_binds == stats.texture_binds);
+        CHECK(replayed.shader_binds == stats.shader_binds);
+        CHECK(stats.draw_calls == 4);
+        CHECK(stats.texture_binds == 2);
+        CHECK(stats.shader_binds == 3);
+        CHECK(stats.sprites == 6);
+
+        // A run the executor could not draw costs nothing.
+        RecordingExecutor failing;
+        failing.unbindable = &texture_b;
+        Salix::RenderStats failing_stats;
+        list.execute(failing, failing_stats);
+        CHECK(failing_stats.sprites == 4);
+        CHECK(failing_stats.texture_binds == 1);
+        CHECK(failing_stats.draw_calls == 3);
+    }
+
+    TEST_CASE("a list recorded on another thread is drawn with the renderer's own batch") {
+        MockIRenderer mock_renderer;
+        MockITexture texture;
+        Salix::RenderCommandList worker_list;
+        std::thread worker([&]() {
+            for (int i = 0; i < 10; ++i) {
+                worker_list.add_sprite(&texture, at_x(static_cast<float>(i)), Salix::Color(), 1);
+            }
+        });
+        worker.join();
+
+        mock_renderer.begin_frame();
+        mock_renderer.begin_sprite_batch();
+        mock_renderer.submit_sprite(&texture, at_x(0.f), Salix::Color(), 0);
+        mock_renderer.submit_commands(worker_list);
+        mock_renderer.end_sprite_batch();
+
+        const Salix::RenderStats stats = mock_renderer.get_render_stats();
+        CHECK(stats.sprites == 11);
+        // Same texture across both layers: one run once sorted.
+        CHECK(stats.draw_calls == 1);
+        CHECK(stats.texture_binds == 1);
+        CHECK(mock_renderer.commands.empty());
+    }
+}
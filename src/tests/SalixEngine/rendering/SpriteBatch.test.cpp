@@ -0,0 +1,161 @@
+// =================================================================================
+// Filename:    src/Tests/SalixEngine/rendering/SpriteBatch.test.cpp
+// Description: Contains unit tests for SpriteBatch ordering and for the draw
+//              counts a batched Realm::render produces.
+// =================================================================================
+
+#include <doctest.h>
+#include <Salix/rendering/SpriteBatch.h>
+#include <Salix/ecs/Realm.h>
+#include <Salix/ecs/Entity.h>
+#include <Salix/ecs/Sprite2D.h>
+#include <Salix/assets/AssetManager.h>
+#include <Tests/SalixEngine/mocking/rendering/MockITexture.h>
+#include <Tests/SalixEngine/mocking/rendering/MockIRenderer.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <string>
+#include <vector>
+
+
+namespace {
+    glm::mat4 at_x(float x) {
+        return glm::translate(glm::mat4(1.0f), glm::vec3(x, 0.0f, 0.0f));
+    }
+}
+
+
+TEST_SUITE("Salix::rendering::SpriteBatch") {
+
+    TEST_CASE("groups by sorting layer, then texture, keeping submission order") {
+        MockITexture texture_a;
+        MockITexture texture_b;
+        Salix::SpriteBatch batch;
+
+        batch.begin();
+        CHECK(batch.is_active());
+        batch.submit(&texture_a, at_x(0.f), Salix::Color(), 1);
+        batch.submit(&texture_b, at_x(1.f), Salix::Color(), 0);
+        batch.submit(&texture_a, at_x(2.f), Salix::Color(), 1);
+        batch.submit(&texture_b, at_x(3.f), Salix::Color(), 0);
+        batch.submit(nullptr, at_x(4.f), Salix::Color(), 0);   // Ignored.
+        batch.end();
+        CHECK_FALSE(batch.is_active());
+
+        const auto& instances = batch.get_instances();
+        const auto& runs = batch.get_runs();
+        REQUIRE(instances.size() == 4);
+        REQUIRE(runs.size() == 2);
+
+        // Layer 0 first, its two sprites in the order they were submitted.
+        CHECK(runs[0].texture == &texture_b);
+        CHECK(runs[0].sorting_layer == 0);
+        CHECK(runs[0].first == 0);
+        CHECK(runs[0].count == 2);
+        CHECK(instances[0].model[3][0] == doctest::Approx(1.f));
+        CHECK(instances[1].model[3][0] == doctest::Approx(3.f));
+
+        CHECK(runs[1].texture == &texture_a);
+        CHECK(runs[1].first == 2);
+        CHECK(instances[2].model[3][0] == doctest::Approx(0.f));
+        CHECK(instances[3].model[3][0] == doctest::Approx(2.f));
+    }
+
+    TEST_CASE("a texture spanning two layers stays one run") {
+        MockITexture texture;
+        Salix::SpriteBatch batch;
+        batch.begin();
+        batch.submit(&texture, at_x(0.f), Salix::Color(), 2);
+        batch.submit(&texture, at_x(1.f), Salix::Color(), 1);
+        batch.end();
+
+        REQUIRE(batch.get_runs().size() == 1);
+        CHECK(batch.get_runs()[0].count == 2);
+        CHECK(batch.get_instances()[0].model[3][0] == doctest::Approx(1.f));
+    }
+
+    TEST_CASE("drawing the runs counts a bind per texture change and a draw per run") {
+        MockITexture texture_a;
+        MockITexture texture_b;
+        MockITexture texture_c;
+        Salix::SpriteBatch batch;
+        batch.begin();
+        batch.submit(&texture_a, at_x(0.f), Salix::Color(), 0);
+        batch.submit(&texture_b, at_x(1.f), Salix::Color(), 1);
+        batch.submit(&texture_b, at_x(2.f), Salix::Color(), 1);
+        batch.submit(&texture_c, at_x(3.f), Salix::Color(), 2);
+        batch.end();
+        REQUIRE(batch.get_runs().size() == 3);
+
+        // The renderer cannot draw texture_b's run: it is not counted, and
+        // texture_c still needs its own bind.
+        Salix::RenderStats stats;
+        std::vector<bool> binds;
+        batch.draw_runs(stats, [&](const Salix::SpriteRun& run, bool bind_texture) {
+            binds.push_back(bind_texture);
+            return run.texture != &texture_b;
+        });
+        CHECK(binds == std::vector<bool>{ true, true, true });
+        CHECK(stats.shader_binds == 1);
+        CHECK(stats.texture_binds == 2);
+        CHECK(stats.draw_calls == 2);
+        CHECK(stats.sprites == 2);
+
+        // An empty batch costs nothing, not even the program bind.
+        Salix::RenderStats empty_stats;
+        batch.begin();
+        batch.end();
+        batch.draw_runs(empty_stats, [](const Salix::SpriteRun&, bool) { return true; });
+        CHECK(empty_stats.shader_binds == 0);
+    }
+
+    TEST_CASE("tint is packed as rgba") {
+        MockITexture texture;
+        Salix::SpriteBatch batch;
+        batch.begin();
+        batch.submit(&texture, glm::mat4(1.0f), Salix::Color(0.1f, 0.2f, 0.3f, 0.4f), 0);
+        batch.end();
+
+        const glm::vec4& tint = batch.get_instances()[0].tint;
+        CHECK(tint.r == doctest::Approx(0.1f));
+        CHECK(tint.g == doctest::Approx(0.2f));
+        CHECK(tint.b == doctest::Approx(0.3f));
+        CHECK(tint.a == doctest::Approx(0.4f));
+    }
+
+    TEST_CASE("Realm::render draws a thousand sprites in a handful of draws") {
+        MockIRenderer mock_renderer;
+        Salix::AssetManager asset_manager;
+        asset_manager.initialize(&mock_renderer);
+        const std::string texture_paths[] = { "assets/a.png", "assets/b.png", "assets/c.png" };
+
+        Salix::Realm realm;
+        for (int i = 0; i < 1000; ++i) {
+            Salix::Entity* entity = realm.create_entity("Sprite");
+            Salix::Sprite2D* sprite = entity->add_element<Salix::Sprite2D>();
+            sprite->load_texture(&asset_manager, texture_paths[i % 3]);
+            sprite->set_sorting_layer(i % 2);
+        }
+
+        mock_renderer.begin_frame();
+        realm.render(&mock_renderer);
+        const Salix::RenderStats stats = mock_renderer.get_render_stats();
+
+        // Nothing went through the one-draw-per-sprite path.
+        CHECK(mock_renderer.draw_sprite_call_count == 0);
+        // Two layers of three textures: at most six runs, one draw each.
+        CHECK(stats.draw_calls <= 6);
+        CHECK(stats.sprites == 1000);
+        CHECK(stats.shader_binds == 1);
+    }
+
+    TEST_CASE("outside a batch sprites are drawn immediately") {
+        MockIRenderer mock_renderer;
+        MockITexture texture;
+        mock_renderer.begin_frame();
+        mock_renderer.submit_sprite(&texture, glm::mat4(1.0f), Salix::Color(), 0);
+        mock_renderer.submit_sprite(&texture, glm::mat4(1.0f), Salix::Color(), 0);
+
+        CHECK(mock_renderer.get_render_stats().draw_calls == 2);
+        CHECK(mock_renderer.get_render_stats().sprites == 2);
+    }
+}